@@ -139,11 +139,22 @@ void ADCSensor::dump_config() {
   }
 #endif  // USE_RP2040
   ESP_LOGCONFIG(TAG, "  Samples: %i", this->sample_count_);
+  if (this->filter_each_sample_)
+    ESP_LOGCONFIG(TAG, "  Filter Each Sample: YES");
   LOG_UPDATE_INTERVAL(this);
 }
 
 float ADCSensor::get_setup_priority() const { return setup_priority::DATA; }
 void ADCSensor::update() {
+  if (this->filter_each_sample_ && this->sample_count_ > 1) {
+    // Take the samples one at a time and leave combining them to the filters
+    this->samples_.clear();
+    for (uint8_t i = 0; i < this->sample_count_; i++)
+      this->samples_.push_back(this->read_(1));
+    ESP_LOGV(TAG, "'%s': Got %u samples", this->get_name().c_str(), this->sample_count_);
+    this->publish_samples(this->samples_.data(), this->samples_.size());
+    return;
+  }
   float value_v = this->sample();
   ESP_LOGV(TAG, "'%s': Got voltage=%.4fV", this->get_name().c_str(), value_v);
   this->publish_state(value_v);
@@ -155,17 +166,19 @@ void ADCSensor::set_sample_count(uint8_t sample_count) {
   }
 }
 
+float ADCSensor::sample() { return this->read_(this->sample_count_); }
+
 #ifdef USE_ESP8266
-float ADCSensor::sample() {
+float ADCSensor::read_(uint8_t sample_count) {
   uint32_t raw = 0;
-  for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+  for (uint8_t sample = 0; sample < sample_count; sample++) {
 #ifdef USE_ADC_SENSOR_VCC
     raw += ESP.getVcc();  // NOLINT(readability-static-accessed-through-instance)
 #else
     raw += analogRead(this->pin_->get_pin());  // NOLINT
 #endif
   }
-  raw = (raw + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+  raw = (raw + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
   if (this->output_raw_) {
     return raw;
   }
@@ -174,10 +187,10 @@ float ADCSensor::sample() {
 #endif
 
 #ifdef USE_ESP32
-float ADCSensor::sample() {
+float ADCSensor::read_(uint8_t sample_count) {
   if (!this->autorange_) {
     uint32_t sum = 0;
-    for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+    for (uint8_t sample = 0; sample < sample_count; sample++) {
       int raw = -1;
       if (this->channel1_ != ADC1_CHANNEL_MAX) {
         raw = adc1_get_raw(this->channel1_);
@@ -189,7 +202,7 @@ float ADCSensor::sample() {
       }
       sum += raw;
     }
-    sum = (sum + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+    sum = (sum + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
     if (this->output_raw_) {
       return sum;
     }
@@ -255,16 +268,16 @@ float ADCSensor::sample() {
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
-float ADCSensor::sample() {
+float ADCSensor::read_(uint8_t sample_count) {
   if (this->is_temperature_) {
     adc_set_temp_sensor_enabled(true);
     delay(1);
     adc_select_input(4);
     uint32_t raw = 0;
-    for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+    for (uint8_t sample = 0; sample < sample_count; sample++) {
       raw += adc_read();
     }
-    raw = (raw + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+    raw = (raw + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
     adc_set_temp_sensor_enabled(false);
     if (this->output_raw_) {
       return raw;
@@ -286,10 +299,10 @@ float ADCSensor::sample() {
     adc_select_input(pin - 26);
 
     uint32_t raw = 0;
-    for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+    for (uint8_t sample = 0; sample < sample_count; sample++) {
       raw += adc_read();
     }
-    raw = (raw + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+    raw = (raw + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
 
 #ifdef CYW43_USES_VSYS_PIN
     if (pin == PICO_VSYS_PIN) {
@@ -307,19 +320,19 @@ float ADCSensor::sample() {
 #endif
 
 #ifdef USE_LIBRETINY
-float ADCSensor::sample() {
+float ADCSensor::read_(uint8_t sample_count) {
   uint32_t raw = 0;
   if (this->output_raw_) {
-    for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+    for (uint8_t sample = 0; sample < sample_count; sample++) {
       raw += analogRead(this->pin_->get_pin());  // NOLINT
     }
-    raw = (raw + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+    raw = (raw + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
     return raw;
   }
-  for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
+  for (uint8_t sample = 0; sample < sample_count; sample++) {
     raw += analogReadVoltage(this->pin_->get_pin());  // NOLINT
   }
-  raw = (raw + (this->sample_count_ >> 1)) / this->sample_count_;  // NOLINT(clang-analyzer-core.DivideZero)
+  raw = (raw + (sample_count >> 1)) / sample_count;  // NOLINT(clang-analyzer-core.DivideZero)
   return raw / 1000.0f;
 }
 #endif  // USE_LIBRETINY
@@ -6,6 +6,8 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
 
+#include <vector>
+
 #ifdef USE_ESP32
 #include <esp_adc_cal.h>
 #include "driver/adc.h"
@@ -55,6 +57,8 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   void set_pin(InternalGPIOPin *pin) { this->pin_ = pin; }
   void set_output_raw(bool output_raw) { this->output_raw_ = output_raw; }
   void set_sample_count(uint8_t sample_count);
+  /// Publish all samples with publish_samples() instead of their average.
+  void set_filter_each_sample(bool filter_each_sample) { this->filter_each_sample_ = filter_each_sample; }
   float sample() override;
 
 #ifdef USE_ESP8266
@@ -66,9 +70,14 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
 #endif
 
  protected:
+  /// Read the ADC \p sample_count times and return the average.
+  float read_(uint8_t sample_count);
+
   InternalGPIOPin *pin_;
   bool output_raw_{false};
   uint8_t sample_count_{1};
+  bool filter_each_sample_{false};
+  std::vector<float> samples_;
 
 #ifdef USE_RP2040
   bool is_temperature_{false};
@@ -30,6 +30,7 @@ _LOGGER = logging.getLogger(__name__)
 AUTO_LOAD = ["voltage_sampler"]
 
 CONF_SAMPLES = "samples"
+CONF_FILTER_EACH_SAMPLE = "filter_each_sample"
 
 
 _attenuation = cv.enum(ATTENUATION_MODES, lower=True)
@@ -88,6 +89,8 @@ CONFIG_SCHEMA = cv.All(
                 cv.only_on_esp32, _attenuation
             ),
             cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
+            # Pass every sample through the filters instead of only their average
+            cv.Optional(CONF_FILTER_EACH_SAMPLE, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("60s")),
@@ -112,6 +115,8 @@ async def to_code(config):
 
     cg.add(var.set_output_raw(config[CONF_RAW]))
     cg.add(var.set_sample_count(config[CONF_SAMPLES]))
+    if config[CONF_FILTER_EACH_SAMPLE]:
+        cg.add(var.set_filter_each_sample(True))
 
     if attenuation := config.get(CONF_ATTENUATION):
         if attenuation == "auto":
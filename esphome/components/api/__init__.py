@@ -47,6 +47,8 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_BATCH_DELAY = "batch_delay"
+CONF_TX_BUFFER_SIZE = "tx_buffer_size"
 
 
 def validate_encryption_key(value):
@@ -71,6 +73,16 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(
             CONF_REBOOT_TIMEOUT, default="15min"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_BATCH_DELAY, default="10ms"
+        ): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+        ),
+        # Per client, holds the data the socket could not take yet
+        cv.Optional(CONF_TX_BUFFER_SIZE, default=4096): cv.All(
+            cv.validate_bytes, cv.int_range(min=2048, max=65536)
+        ),
         cv.Optional(CONF_SERVICES): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UserServiceTrigger),
@@ -107,6 +119,8 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    cg.add(var.set_tx_buffer_size(config[CONF_TX_BUFFER_SIZE]))
 
     for conf in config.get(CONF_SERVICES, []):
         template_args = []
@@ -1,4 +1,5 @@
 #include "api_connection.h"
+#include <algorithm>
 #include <cerrno>
 #include <cinttypes>
 #include <utility>
@@ -26,11 +27,11 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+/// Flush a batch once it reaches about one TCP segment of a 1500 byte MTU.
+static const uint32_t MAX_BATCH_SIZE_BYTES = 1400;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
-  this->proto_write_buffer_.reserve(64);
-
 #if defined(USE_API_PLAINTEXT)
   this->helper_ = std::unique_ptr<APIFrameHelper>{new APIPlaintextFrameHelper(std::move(sock))};
 #elif defined(USE_API_NOISE)
@@ -38,6 +39,7 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #else
 #error "No frame helper defined"
 #endif
+  this->helper_->set_tx_buffer_size(parent->get_tx_buffer_size());
 }
 void APIConnection::start() {
   this->last_traffic_ = millis();
@@ -113,10 +115,15 @@ void APIConnection::loop() {
     this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
     if (this->remove_)
       return;
+    // Don't hold back the response to a request
+    this->flush_batch_();
+    if (this->remove_)
+      return;
   }
 
-  this->list_entities_iterator_.advance();
-  this->initial_state_iterator_.advance();
+  this->process_pending_states_();
+  this->advance_iterator_(this->list_entities_iterator_);
+  this->advance_iterator_(this->initial_state_iterator_);
 
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
@@ -151,7 +158,8 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    // key: 5 bytes, data: up to 4 bytes + to_send, done: 2 bytes
+    auto buffer = this->create_buffer(11 + to_send);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
@@ -184,6 +192,42 @@ void APIConnection::loop() {
       }
     }
   }
+
+  if (!this->batch_packets_.empty()) {
+    // While iterating, send what was collected every loop to keep the initial sync going
+    bool iterating = !this->list_entities_iterator_.completed() || !this->initial_state_iterator_.completed();
+    // The first message after a quiet period goes out right away, only what follows it is held back
+    uint16_t batch_delay = this->parent_->get_batch_delay();
+    if (iterating || batch_delay == 0 || millis() - this->batch_start_time_ >= batch_delay ||
+        this->batch_start_time_ - this->last_flush_time_ >= batch_delay)
+      this->flush_batch_();
+  }
+}
+void APIConnection::queue_state_(EntityBase *entity, resend_state_t resend) {
+  // Only the entity is remembered, its latest state is read when the queue is drained
+  if (this->pending_entities_.insert(entity).second)
+    this->pending_states_.push_back(PendingState{entity, resend});
+}
+void APIConnection::process_pending_states_() {
+  while (!this->pending_states_.empty() && !this->remove_ && this->helper_->can_write_without_blocking()) {
+    // Taken off the queue first, if sending fails again the entity is queued at the back
+    PendingState pending = this->pending_states_.front();
+    this->pending_states_.pop_front();
+    this->pending_entities_.erase(pending.entity);
+    size_t queued = this->batch_packets_.size();
+    // The socket is backed up, or the batch filled up and was flushed
+    if (!pending.resend(this, pending.entity) || this->batch_packets_.size() < queued)
+      break;
+  }
+}
+void APIConnection::advance_iterator_(ComponentIterator &iterator) {
+  while (!iterator.completed() && !this->remove_ && this->helper_->can_write_without_blocking()) {
+    size_t queued = this->batch_packets_.size();
+    iterator.advance();
+    // The batch filled up and was flushed
+    if (this->batch_packets_.size() < queued)
+      break;
+  }
 }
 
 std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
@@ -207,12 +251,17 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(binary_sensor))
+    return true;
 
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  if (this->send_binary_sensor_state_response(resp))
+    return true;
+  this->queue_state_(binary_sensor, resend_state_<binary_sensor::BinarySensor, &ComponentIterator::on_binary_sensor>);
+  return false;
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -234,6 +283,8 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(cover))
+    return true;
 
   auto traits = cover->get_traits();
   CoverStateResponse resp{};
@@ -244,7 +295,10 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  if (this->send_cover_state_response(resp))
+    return true;
+  this->queue_state_(cover, resend_state_<cover::Cover, &ComponentIterator::on_cover>);
+  return false;
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -297,6 +351,8 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 bool APIConnection::send_fan_state(fan::Fan *fan) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(fan))
+    return true;
 
   auto traits = fan->get_traits();
   FanStateResponse resp{};
@@ -311,7 +367,10 @@ bool APIConnection::send_fan_state(fan::Fan *fan) {
     resp.direction = static_cast<enums::FanDirection>(fan->direction);
   if (traits.supports_preset_modes())
     resp.preset_mode = fan->preset_mode;
-  return this->send_fan_state_response(resp);
+  if (this->send_fan_state_response(resp))
+    return true;
+  this->queue_state_(fan, resend_state_<fan::Fan, &ComponentIterator::on_fan>);
+  return false;
 }
 bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
@@ -358,6 +417,8 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 bool APIConnection::send_light_state(light::LightState *light) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(light))
+    return true;
 
   auto traits = light->get_traits();
   auto values = light->remote_values;
@@ -378,7 +439,10 @@ bool APIConnection::send_light_state(light::LightState *light) {
   resp.warm_white = values.get_warm_white();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  if (this->send_light_state_response(resp))
+    return true;
+  this->queue_state_(light, resend_state_<light::LightState, &ComponentIterator::on_light>);
+  return false;
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -456,12 +520,17 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(sensor))
+    return true;
 
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  if (this->send_sensor_state_response(resp))
+    return true;
+  this->queue_state_(sensor, resend_state_<sensor::Sensor, &ComponentIterator::on_sensor>);
+  return false;
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -488,11 +557,16 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(a_switch))
+    return true;
 
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  if (this->send_switch_state_response(resp))
+    return true;
+  this->queue_state_(a_switch, resend_state_<switch_::Switch, &ComponentIterator::on_switch>);
+  return false;
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -525,12 +599,17 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(text_sensor))
+    return true;
 
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  if (this->send_text_sensor_state_response(resp))
+    return true;
+  this->queue_state_(text_sensor, resend_state_<text_sensor::TextSensor, &ComponentIterator::on_text_sensor>);
+  return false;
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -552,6 +631,8 @@ bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor)
 bool APIConnection::send_climate_state(climate::Climate *climate) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(climate))
+    return true;
 
   auto traits = climate->get_traits();
   ClimateStateResponse resp{};
@@ -581,7 +662,10 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.current_humidity = climate->current_humidity;
   if (traits.get_supports_target_humidity())
     resp.target_humidity = climate->target_humidity;
-  return this->send_climate_state_response(resp);
+  if (this->send_climate_state_response(resp))
+    return true;
+  this->queue_state_(climate, resend_state_<climate::Climate, &ComponentIterator::on_climate>);
+  return false;
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -660,12 +744,17 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 bool APIConnection::send_number_state(number::Number *number, float state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(number))
+    return true;
 
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !number->has_state();
-  return this->send_number_state_response(resp);
+  if (this->send_number_state_response(resp))
+    return true;
+  this->queue_state_(number, resend_state_<number::Number, &ComponentIterator::on_number>);
+  return false;
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
@@ -702,6 +791,8 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 bool APIConnection::send_date_state(datetime::DateEntity *date) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(date))
+    return true;
 
   DateStateResponse resp{};
   resp.key = date->get_object_id_hash();
@@ -709,7 +800,10 @@ bool APIConnection::send_date_state(datetime::DateEntity *date) {
   resp.year = date->year;
   resp.month = date->month;
   resp.day = date->day;
-  return this->send_date_state_response(resp);
+  if (this->send_date_state_response(resp))
+    return true;
+  this->queue_state_(date, resend_state_<datetime::DateEntity, &ComponentIterator::on_date>);
+  return false;
 }
 bool APIConnection::send_date_info(datetime::DateEntity *date) {
   ListEntitiesDateResponse msg;
@@ -739,6 +833,8 @@ void APIConnection::date_command(const DateCommandRequest &msg) {
 bool APIConnection::send_time_state(datetime::TimeEntity *time) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(time))
+    return true;
 
   TimeStateResponse resp{};
   resp.key = time->get_object_id_hash();
@@ -746,7 +842,10 @@ bool APIConnection::send_time_state(datetime::TimeEntity *time) {
   resp.hour = time->hour;
   resp.minute = time->minute;
   resp.second = time->second;
-  return this->send_time_state_response(resp);
+  if (this->send_time_state_response(resp))
+    return true;
+  this->queue_state_(time, resend_state_<datetime::TimeEntity, &ComponentIterator::on_time>);
+  return false;
 }
 bool APIConnection::send_time_info(datetime::TimeEntity *time) {
   ListEntitiesTimeResponse msg;
@@ -776,6 +875,8 @@ void APIConnection::time_command(const TimeCommandRequest &msg) {
 bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(datetime))
+    return true;
 
   DateTimeStateResponse resp{};
   resp.key = datetime->get_object_id_hash();
@@ -784,7 +885,10 @@ bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
     ESPTime state = datetime->state_as_esptime();
     resp.epoch_seconds = state.timestamp;
   }
-  return this->send_date_time_state_response(resp);
+  if (this->send_date_time_state_response(resp))
+    return true;
+  this->queue_state_(datetime, resend_state_<datetime::DateTimeEntity, &ComponentIterator::on_datetime>);
+  return false;
 }
 bool APIConnection::send_datetime_info(datetime::DateTimeEntity *datetime) {
   ListEntitiesDateTimeResponse msg;
@@ -814,12 +918,17 @@ void APIConnection::datetime_command(const DateTimeCommandRequest &msg) {
 bool APIConnection::send_text_state(text::Text *text, std::string state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(text))
+    return true;
 
   TextStateResponse resp{};
   resp.key = text->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text->has_state();
-  return this->send_text_state_response(resp);
+  if (this->send_text_state_response(resp))
+    return true;
+  this->queue_state_(text, resend_state_<text::Text, &ComponentIterator::on_text>);
+  return false;
 }
 bool APIConnection::send_text_info(text::Text *text) {
   ListEntitiesTextResponse msg;
@@ -852,12 +961,17 @@ void APIConnection::text_command(const TextCommandRequest &msg) {
 bool APIConnection::send_select_state(select::Select *select, std::string state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(select))
+    return true;
 
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !select->has_state();
-  return this->send_select_state_response(resp);
+  if (this->send_select_state_response(resp))
+    return true;
+  this->queue_state_(select, resend_state_<select::Select, &ComponentIterator::on_select>);
+  return false;
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
@@ -913,11 +1027,16 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(a_lock))
+    return true;
 
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
   resp.state = static_cast<enums::LockState>(state);
-  return this->send_lock_state_response(resp);
+  if (this->send_lock_state_response(resp))
+    return true;
+  this->queue_state_(a_lock, resend_state_<lock::Lock, &ComponentIterator::on_lock>);
+  return false;
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
@@ -957,12 +1076,17 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 bool APIConnection::send_valve_state(valve::Valve *valve) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(valve))
+    return true;
 
   ValveStateResponse resp{};
   resp.key = valve->get_object_id_hash();
   resp.position = valve->position;
   resp.current_operation = static_cast<enums::ValveOperation>(valve->current_operation);
-  return this->send_valve_state_response(resp);
+  if (this->send_valve_state_response(resp))
+    return true;
+  this->queue_state_(valve, resend_state_<valve::Valve, &ComponentIterator::on_valve>);
+  return false;
 }
 bool APIConnection::send_valve_info(valve::Valve *valve) {
   auto traits = valve->get_traits();
@@ -999,6 +1123,8 @@ void APIConnection::valve_command(const ValveCommandRequest &msg) {
 bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(media_player))
+    return true;
 
   MediaPlayerStateResponse resp{};
   resp.key = media_player->get_object_id_hash();
@@ -1009,7 +1135,10 @@ bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_pla
   resp.state = static_cast<enums::MediaPlayerState>(report_state);
   resp.volume = media_player->volume;
   resp.muted = media_player->is_muted();
-  return this->send_media_player_state_response(resp);
+  if (this->send_media_player_state_response(resp))
+    return true;
+  this->queue_state_(media_player, resend_state_<media_player::MediaPlayer, &ComponentIterator::on_media_player>);
+  return false;
 }
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
@@ -1209,11 +1338,17 @@ void APIConnection::on_voice_assistant_timer_event_response(const VoiceAssistant
 bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(a_alarm_control_panel))
+    return true;
 
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
-  return this->send_alarm_control_panel_state_response(resp);
+  if (this->send_alarm_control_panel_state_response(resp))
+    return true;
+  this->queue_state_(a_alarm_control_panel,
+                     resend_state_<alarm_control_panel::AlarmControlPanel, &ComponentIterator::on_alarm_control_panel>);
+  return false;
 }
 bool APIConnection::send_alarm_control_panel_info(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   ListEntitiesAlarmControlPanelResponse msg;
@@ -1291,6 +1426,8 @@ bool APIConnection::send_event_info(event::Event *event) {
 bool APIConnection::send_update_state(update::UpdateEntity *update) {
   if (!this->state_subscription_)
     return false;
+  if (this->is_state_pending_(update))
+    return true;
 
   UpdateStateResponse resp{};
   resp.key = update->get_object_id_hash();
@@ -1308,7 +1445,10 @@ bool APIConnection::send_update_state(update::UpdateEntity *update) {
     resp.release_url = update->update_info.release_url;
   }
 
-  return this->send_update_state_response(resp);
+  if (this->send_update_state_response(resp))
+    return true;
+  this->queue_state_(update, resend_state_<update::UpdateEntity, &ComponentIterator::on_update>);
+  return false;
 }
 bool APIConnection::send_update_info(update::UpdateEntity *update) {
   ListEntitiesUpdateResponse msg;
@@ -1337,11 +1477,15 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  size_t line_length = strlen(line);
+  uint32_t msg_size = 0;
+  ProtoSize::add_uint32_field(msg_size, 1, static_cast<uint32_t>(level));
+  msg_size += 1 + ProtoSize::varint(static_cast<uint32_t>(line_length)) + line_length;
+  auto buffer = this->create_buffer(msg_size);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_length);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1445,10 +1589,28 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+ProtoWriteBuffer APIConnection::create_buffer(uint32_t reserve_size) {
+  // FIXME: ensure no recursive writes can happen
+  // Messages are appended to the current batch, each with room for the frame header in front of it and the frame
+  // footer after it, so the frame helper can frame all of them in place
+  this->batch_message_start_ = this->proto_write_buffer_.size();
+  const uint8_t header_padding = this->helper_->frame_header_padding();
+  size_t needed = this->batch_message_start_ + header_padding + reserve_size + this->helper_->frame_footer_size();
+  if (this->proto_write_buffer_.capacity() < needed) {
+    this->proto_write_buffer_.reserve(
+        std::max<size_t>({needed, MAX_BATCH_SIZE_BYTES, this->proto_write_buffer_.capacity() * 2}));
+  }
+  this->proto_write_buffer_.resize(this->batch_message_start_ + header_padding);
+  return {&this->proto_write_buffer_};
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
+  // Nested writes (e.g. from logging) may change batch_message_start_
+  const uint32_t message_start = this->batch_message_start_;
   if (this->remove_)
     return false;
-  if (!this->helper_->can_write_without_blocking()) {
+  // The whole batch, including this message, has to fit in the send buffer once it is flushed
+  const size_t batch_size = this->proto_write_buffer_.size() + this->helper_->frame_footer_size();
+  if (!this->helper_->can_write_without_blocking() || !this->helper_->can_buffer(batch_size)) {
     delay(0);
     APIError err = this->helper_->loop();
     if (err != APIError::OK) {
@@ -1457,7 +1619,9 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
                api_error_to_str(err), errno);
       return false;
     }
-    if (!this->helper_->can_write_without_blocking()) {
+    if (!this->helper_->can_write_without_blocking() || !this->helper_->can_buffer(batch_size)) {
+      // Drop the message from the batch
+      this->proto_write_buffer_.resize(message_start);
       // SubscribeLogsResponse
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
@@ -1467,9 +1631,27 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  uint32_t payload_size = this->proto_write_buffer_.size() - message_start - this->helper_->frame_header_padding();
+  this->proto_write_buffer_.resize(this->proto_write_buffer_.size() + this->helper_->frame_footer_size());
+  if (this->batch_packets_.empty())
+    this->batch_start_time_ = millis();
+  this->batch_packets_.emplace_back(message_type, message_start, payload_size);
+  // The message is part of the batch now, which is kept until it could be written even if that is not possible yet
+  if (this->proto_write_buffer_.size() >= MAX_BATCH_SIZE_BYTES)
+    this->flush_batch_();
+  return !this->remove_;
+}
+bool APIConnection::flush_batch_() {
+  if (this->batch_packets_.empty())
+    return true;
+  APIError err = this->helper_->write_protobuf_packets(ProtoWriteBuffer{&this->proto_write_buffer_},
+                                                       this->batch_packets_.data(), this->batch_packets_.size());
+  // Nothing of the batch was framed, it is tried again from the next loop()
   if (err == APIError::WOULD_BLOCK)
     return false;
+  this->proto_write_buffer_.clear();
+  this->batch_packets_.clear();
+  this->last_flush_time_ = millis();
   if (err != APIError::OK) {
     on_fatal_error();
     if (err == APIError::SOCKET_WRITE_FAILED && errno == ECONNRESET) {
@@ -1492,6 +1674,8 @@ void APIConnection::on_no_setup_connection() {
   ESP_LOGD(TAG, "%s: tried to access without full connection.", this->client_combined_info_.c_str());
 }
 void APIConnection::on_fatal_error() {
+  this->proto_write_buffer_.clear();
+  this->batch_packets_.clear();
   this->helper_->close();
   this->remove_ = true;
 }
@@ -8,6 +8,8 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 
+#include <deque>
+#include <unordered_set>
 #include <vector>
 
 namespace esphome {
@@ -192,6 +194,9 @@ class APIConnection : public APIServerConnection {
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->log_subscription_ = msg.level;
+#ifdef USE_LOGGER
+    this->parent_->update_log_level();
+#endif
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -212,11 +217,7 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
-    // FIXME: ensure no recursive writes can happen
-    this->proto_write_buffer_.clear();
-    return {&this->proto_write_buffer_};
-  }
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override;
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
 
   std::string get_client_combined_info() const { return this->client_combined_info_; }
@@ -225,6 +226,28 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+  /// Write all messages of the current batch to the socket.
+  bool flush_batch_();
+  /// Let \p iterator send entities until a full batch was flushed or the socket can't take more data.
+  void advance_iterator_(ComponentIterator &iterator);
+
+  /// Sends the latest state of an entity again, queueing it once more if that fails.
+  using resend_state_t = bool (*)(APIConnection *api, EntityBase *entity);
+  template<typename T, bool (ComponentIterator::*on_entity)(T *)>
+  static bool resend_state_(APIConnection *api, EntityBase *entity) {
+    return (api->initial_state_iterator_.*on_entity)(static_cast<T *>(entity));
+  }
+  /// An entity whose latest state still has to be sent, because the socket was backed up when it changed.
+  struct PendingState {
+    EntityBase *entity;
+    resend_state_t resend;
+  };
+  bool is_state_pending_(EntityBase *entity) const {
+    return !this->pending_entities_.empty() && this->pending_entities_.count(entity) != 0;
+  }
+  void queue_state_(EntityBase *entity, resend_state_t resend);
+  /// Send the latest state of queued entities, oldest first, while the socket can take more data.
+  void process_pending_states_();
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -234,9 +257,20 @@ class APIConnection : public APIServerConnection {
 
   bool remove_{false};
 
-  // Buffer used to encode proto messages
+  // Buffer the messages of the current batch are encoded into, each one surrounded by room for its frame
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
+  std::vector<PacketInfo> batch_packets_;
+  /// Offset of the message that is currently being encoded.
+  uint32_t batch_message_start_{0};
+  /// Time the first message of the current batch was queued.
+  uint32_t batch_start_time_{0};
+  /// Time the last batch was written to the socket.
+  uint32_t last_flush_time_{0};
+  /// Entities with unsent state changes, each at most once, oldest first.
+  std::deque<PendingState> pending_states_;
+  /// The entities in pending_states_. Keyed on the entity, object_id_hash is only unique within an entity type.
+  std::unordered_set<EntityBase *> pending_entities_;
   std::unique_ptr<APIFrameHelper> helper_;
 
   std::string client_info_;
@@ -5,6 +5,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <algorithm>
+#include <cinttypes>
 #include <cstring>
 
 namespace esphome {
@@ -20,6 +22,108 @@ bool is_would_block(ssize_t ret) {
   return ret == 0;
 }
 
+/// Maximum number of iovecs passed to a single write of APIFrameHelper::write_protobuf_packets().
+static const int MAX_BATCH_IOVECS = 16;
+
+/// Upper bound of the number of bytes the frames of a batch take on the wire.
+static size_t batch_frames_size(const PacketInfo *packets, size_t count, uint8_t padding, uint8_t footer) {
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++)
+    total += padding + packets[i].payload_size + footer;
+  return total;
+}
+
+/// Add a frame to the iovecs of a batch, merging it into the last one if the frames are adjacent in memory.
+static int append_frame_iov(struct iovec *iov, int iovcnt, uint8_t *frame, size_t len) {
+  if (iovcnt > 0) {
+    struct iovec &last = iov[iovcnt - 1];
+    if (reinterpret_cast<uint8_t *>(last.iov_base) + last.iov_len == frame) {
+      last.iov_len += len;
+      return iovcnt;
+    }
+  }
+  iov[iovcnt].iov_base = frame;
+  iov[iovcnt].iov_len = len;
+  return iovcnt + 1;
+}
+
+bool APITxBuffer::push(const uint8_t *data, size_t len) {
+  struct iovec iov;
+  iov.iov_base = const_cast<uint8_t *>(data);
+  iov.iov_len = len;
+  return this->push(&iov, 1, 0);
+}
+bool APITxBuffer::push(const struct iovec *iov, int iovcnt, size_t skip) {
+  size_t total = 0;
+  for (int i = 0; i < iovcnt; i++)
+    total += iov[i].iov_len;
+  if (skip >= total)
+    return true;
+  if (!this->can_fit(total - skip))
+    return false;
+  for (int i = 0; i < iovcnt; i++) {
+    if (skip >= iov[i].iov_len) {
+      skip -= iov[i].iov_len;
+      continue;
+    }
+    this->append_(reinterpret_cast<uint8_t *>(iov[i].iov_base) + skip, iov[i].iov_len - skip);
+    skip = 0;
+  }
+  return true;
+}
+void APITxBuffer::append_(const uint8_t *data, size_t len) {
+  if (this->size_ + len > this->allocated_)
+    this->reallocate_(std::max(this->size_ + len, this->capacity_));
+  size_t tail = (this->head_ + this->size_) % this->allocated_;
+  size_t first = std::min(len, this->allocated_ - tail);
+  memcpy(&this->data_[tail], data, first);
+  memcpy(&this->data_[0], data + first, len - first);
+  this->size_ += len;
+  if (this->size_ >= this->get_high_watermark())
+    this->congested_ = true;
+}
+int APITxBuffer::peek(struct iovec *iov) const {
+  if (this->size_ == 0)
+    return 0;
+  size_t first = std::min(this->size_, this->allocated_ - this->head_);
+  iov[0].iov_base = &this->data_[this->head_];
+  iov[0].iov_len = first;
+  if (first == this->size_)
+    return 1;
+  iov[1].iov_base = &this->data_[0];
+  iov[1].iov_len = this->size_ - first;
+  return 2;
+}
+void APITxBuffer::consume(size_t len) {
+  len = std::min(len, this->size_);
+  this->size_ -= len;
+  if (this->size_ <= this->get_low_watermark())
+    this->congested_ = false;
+  if (this->size_ == 0) {
+    this->head_ = 0;
+    // Give back a buffer that was enlarged for a single oversized write
+    if (this->allocated_ > this->capacity_) {
+      this->data_.reset();
+      this->allocated_ = 0;
+    }
+    return;
+  }
+  this->head_ = (this->head_ + len) % this->allocated_;
+}
+void APITxBuffer::reallocate_(size_t size) {
+  std::unique_ptr<uint8_t[]> data(new uint8_t[size]);  // NOLINT(cppcoreguidelines-owning-memory)
+  struct iovec iov[2];
+  int iovcnt = this->peek(iov);
+  size_t pos = 0;
+  for (int i = 0; i < iovcnt; i++) {
+    memcpy(&data[pos], iov[i].iov_base, iov[i].iov_len);
+    pos += iov[i].iov_len;
+  }
+  this->data_ = std::move(data);
+  this->allocated_ = size;
+  this->head_ = 0;
+}
+
 const char *api_error_to_str(APIError err) {
   // not using switch to ensure compiler doesn't try to build a big table out of it
   if (err == APIError::OK) {
@@ -466,8 +570,11 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   buffer->type = type;
   return APIError::OK;
 }
-bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+bool APINoiseFrameHelper::can_write_without_blocking() {
+  return state_ == State::DATA && !tx_buf_.is_congested();
+}
+APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                     size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -479,65 +586,79 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const uint8_t msg_offset = 3;
+  const uint8_t padding = this->frame_header_padding();
+  const uint8_t footer = this->frame_footer_size();
+  // Frames can't be taken back once they are encrypted, so make sure up front that they all fit in the send buffer
+  if (!tx_buf_.empty()) {
+    aerr = try_send_tx_buf_();
+    if (aerr != APIError::OK)
+      return aerr;
   }
+  if (!tx_buf_.can_fit(batch_frames_size(packets, count, padding, footer)))
+    return APIError::WOULD_BLOCK;
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  struct iovec iov[MAX_BATCH_IOVECS];
+  int iovcnt = 0;
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
-  }
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    // The encrypted message type, size, payload and MAC have to fit the 16 bit frame size
+    if (packet.payload_size > static_cast<uint32_t>(0xFFFF - 4 - footer)) {
+      HELPER_LOG("Packet too big to send: %" PRIu32, packet.payload_size);
+      return APIError::BAD_ARG;
+    }
+    size_t msg_len = 4 + packet.payload_size;
+    uint8_t *buf = raw_buffer->data() + packet.offset;
+
+    buf[0] = 0x01;  // indicator
+    // buf[1], buf[2] to be set later
+    buf[msg_offset + 0] = (uint8_t) (packet.message_type >> 8);  // type
+    buf[msg_offset + 1] = (uint8_t) packet.message_type;
+    buf[msg_offset + 2] = (uint8_t) (packet.payload_size >> 8);  // data_len
+    buf[msg_offset + 3] = (uint8_t) packet.payload_size;
+
+    // encrypt in place, the MAC goes into the footer space
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &buf[msg_offset], msg_len, padding - msg_offset + packet.payload_size + footer);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
+    buf[1] = (uint8_t) (mbuf.size >> 8);
+    buf[2] = (uint8_t) mbuf.size;
 
-  struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
-  iov.iov_len = total_len;
+    iovcnt = append_frame_iov(iov, iovcnt, buf, msg_offset + mbuf.size);
+    if (iovcnt == MAX_BATCH_IOVECS) {
+      // write raw to not have separate packets sent if NAGLE disabled
+      aerr = write_raw_(iov, iovcnt);
+      if (aerr != APIError::OK)
+        return aerr;
+      iovcnt = 0;
+    }
+  }
 
-  // write raw to not have two packets sent if NAGLE disabled
-  return write_raw_(&iov, 1);
+  return write_raw_(iov, iovcnt);
 }
 APIError APINoiseFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
-    if (sent == -1) {
-      if (errno == EWOULDBLOCK || errno == EAGAIN)
-        break;
+    struct iovec iov[2];
+    int iovcnt = tx_buf_.peek(iov);
+    ssize_t sent = socket_->writev(iov, iovcnt);
+    if (is_would_block(sent)) {
+      break;
+    } else if (sent == -1) {
       state_ = State::FAILED;
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
-    } else if (sent == 0) {
-      break;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    tx_buf_.consume(sent);
   }
 
   return APIError::OK;
@@ -570,9 +691,10 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
+    if (!tx_buf_.push(iov, iovcnt, 0)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   }
@@ -580,9 +702,10 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
   ssize_t sent = socket_->writev(iov, iovcnt);
   if (is_would_block(sent)) {
     // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
+    if (!tx_buf_.push(iov, iovcnt, 0)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   } else if (sent == -1) {
@@ -592,15 +715,10 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
     return APIError::SOCKET_WRITE_FAILED;
   } else if ((size_t) sent != total_write_len) {
     // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
+    if (!tx_buf_.push(iov, iovcnt, sent)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   }
@@ -902,32 +1020,59 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   buffer->type = rx_header_parsed_type_;
   return APIError::OK;
 }
-bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+bool APIPlaintextFrameHelper::can_write_without_blocking() {
+  return state_ == State::DATA && !tx_buf_.is_congested();
+}
+APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                         size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const uint8_t padding = this->frame_header_padding();
+  if (!tx_buf_.empty()) {
+    APIError aerr = try_send_tx_buf_();
+    if (aerr != APIError::OK)
+      return aerr;
+  }
+  if (!tx_buf_.can_fit(batch_frames_size(packets, count, padding, 0)))
+    return APIError::WOULD_BLOCK;
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  struct iovec iov[MAX_BATCH_IOVECS];
+  int iovcnt = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    // The header has a variable length, put it right in front of the payload and start the frame there
+    uint8_t header_len =
+        1 + ProtoSize::varint(packet.payload_size) + ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
+    if (header_len > padding) {
+      HELPER_LOG("Packet too big to send: %" PRIu32, packet.payload_size);
+      return APIError::BAD_ARG;
+    }
+    uint8_t *header = raw_buffer->data() + packet.offset + padding - header_len;
+    header[0] = 0x00;  // indicator
+    uint8_t *pos = ProtoVarInt(packet.payload_size).encode(header + 1);
+    ProtoVarInt(packet.message_type).encode(pos);
+
+    iovcnt = append_frame_iov(iov, iovcnt, header, header_len + packet.payload_size);
+    if (iovcnt == MAX_BATCH_IOVECS) {
+      APIError aerr = write_raw_(iov, iovcnt);
+      if (aerr != APIError::OK)
+        return aerr;
+      iovcnt = 0;
+    }
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  return write_raw_(iov, iovcnt);
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
+    struct iovec iov[2];
+    int iovcnt = tx_buf_.peek(iov);
+    ssize_t sent = socket_->writev(iov, iovcnt);
     if (is_would_block(sent)) {
       break;
     } else if (sent == -1) {
@@ -935,9 +1080,7 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    tx_buf_.consume(sent);
   }
 
   return APIError::OK;
@@ -970,9 +1113,10 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
+    if (!tx_buf_.push(iov, iovcnt, 0)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   }
@@ -980,9 +1124,10 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
   ssize_t sent = socket_->writev(iov, iovcnt);
   if (is_would_block(sent)) {
     // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
+    if (!tx_buf_.push(iov, iovcnt, 0)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   } else if (sent == -1) {
@@ -992,15 +1137,10 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
     return APIError::SOCKET_WRITE_FAILED;
   } else if ((size_t) sent != total_write_len) {
     // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
+    if (!tx_buf_.push(iov, iovcnt, sent)) {
+      state_ = State::FAILED;
+      HELPER_LOG("Send buffer full");
+      return APIError::OUT_OF_MEMORY;
     }
     return APIError::OK;
   }
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <deque>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -11,6 +12,7 @@
 #endif
 
 #include "api_noise_context.h"
+#include "proto.h"
 #include "esphome/components/socket/socket.h"
 
 namespace esphome {
@@ -23,6 +25,17 @@ struct ReadPacketBuffer {
   size_t data_len;
 };
 
+/// Location of one encoded message inside a buffer passed to APIFrameHelper::write_protobuf_packets().
+struct PacketInfo {
+  uint16_t message_type;
+  /// Offset of the frame header padding in front of the message.
+  uint32_t offset;
+  uint32_t payload_size;
+
+  PacketInfo(uint16_t message_type, uint32_t offset, uint32_t payload_size)
+      : message_type(message_type), offset(offset), payload_size(payload_size) {}
+};
+
 struct PacketBuffer {
   const std::vector<uint8_t> container;
   uint16_t type;
@@ -58,20 +71,92 @@ enum class APIError : int {
 
 const char *api_error_to_str(APIError err);
 
+/** Framed data that could not be written to the socket yet.
+ *
+ * A ring buffer, so data that was partially written is consumed in O(1). Writers check can_fit() before framing
+ * new data, which bounds the memory used per client by the capacity. The only exception is a single write larger
+ * than the whole capacity into an empty buffer, which is held in a buffer of its own size until it has been sent.
+ *
+ * The buffer becomes congested once it holds at least get_high_watermark() bytes, and stays so until it has drained
+ * down to get_low_watermark() bytes, so senders back off for a while instead of adding one message per write.
+ */
+class APITxBuffer {
+ public:
+  void set_capacity(size_t capacity) { this->capacity_ = capacity; }
+  size_t get_capacity() const { return this->capacity_; }
+  size_t get_high_watermark() const { return this->capacity_ / 2; }
+  size_t get_low_watermark() const { return this->capacity_ / 4; }
+
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool is_congested() const { return this->congested_; }
+  /// Whether \p len more bytes can be added without exceeding the capacity.
+  bool can_fit(size_t len) const {
+    return this->size_ == 0 || (this->size_ < this->capacity_ && len <= this->capacity_ - this->size_);
+  }
+
+  /// Append \p len bytes at the end, returns false without adding anything if they don't fit, see can_fit().
+  bool push(const uint8_t *data, size_t len);
+  /// Append the data of \p iov after its first \p skip bytes, either all of it or, if it doesn't fit, none of it.
+  bool push(const struct iovec *iov, int iovcnt, size_t skip);
+  /// Fill \p iov with the (at most two) contiguous regions of buffered data, returns the number of iovecs used.
+  int peek(struct iovec *iov) const;
+  /// Remove \p len bytes from the front.
+  void consume(size_t len);
+
+ protected:
+  void append_(const uint8_t *data, size_t len);
+  void reallocate_(size_t size);
+
+  std::unique_ptr<uint8_t[]> data_;
+  size_t allocated_{0};
+  size_t capacity_{4096};
+  size_t head_{0};
+  size_t size_{0};
+  bool congested_{false};
+};
+
 class APIFrameHelper {
  public:
   virtual ~APIFrameHelper() = default;
   virtual APIError init() = 0;
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
+  /// Whether the connection is ready for data and its send buffer is not congested.
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /// Whether \p len more bytes of frames fit in the send buffer, see APITxBuffer::can_fit().
+  bool can_buffer(size_t len) const { return this->tx_buf_.can_fit(len); }
+  void set_tx_buffer_size(size_t size) { this->tx_buf_.set_capacity(size); }
+  /// Number of bytes waiting in the send buffer.
+  size_t get_tx_buffered() const { return this->tx_buf_.size(); }
+  /** Write a message that was encoded into \p buffer after frame_header_padding() bytes of padding.
+   *
+   * The frame is built in place around the message, so the message itself is not copied again.
+   */
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+    PacketInfo packet(type, 0, buffer.get_buffer()->size() - this->frame_header_padding());
+    buffer.get_buffer()->resize(buffer.get_buffer()->size() + this->frame_footer_size());
+    return this->write_protobuf_packets(buffer, &packet, 1);
+  }
+  /** Write several messages that were encoded back to back into \p buffer with a single socket write.
+   *
+   * Every message must be preceded by frame_header_padding() and followed by frame_footer_size() bytes of space,
+   * starting at PacketInfo::offset.
+   */
+  virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) = 0;
+  /// Number of bytes to reserve in front of an encoded message for the frame header.
+  virtual uint8_t frame_header_padding() = 0;
+  /// Number of bytes to reserve after an encoded message for the frame footer.
+  virtual uint8_t frame_footer_size() = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
   virtual APIError shutdown(int how) = 0;
   // Give this helper a name for logging
   virtual void set_log_info(std::string info) = 0;
+
+ protected:
+  APITxBuffer tx_buf_;
 };
 
 #ifdef USE_API_NOISE
@@ -84,7 +169,11 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // Frame header (indicator, encrypted size) followed by the encrypted message type and size
+  uint8_t frame_header_padding() override { return 7; }
+  // MAC of the ChaChaPoly cipher
+  uint8_t frame_footer_size() override { return 16; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -116,7 +205,6 @@ class APINoiseFrameHelper : public APIFrameHelper {
   std::vector<uint8_t> rx_buf_;
   size_t rx_buf_len_ = 0;
 
-  std::vector<uint8_t> tx_buf_;
   std::vector<uint8_t> prologue_;
 
   std::shared_ptr<APINoiseContext> ctx_;
@@ -147,7 +235,10 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // Indicator, varint message size (up to 3 bytes) and varint message type (up to 2 bytes)
+  uint8_t frame_header_padding() override { return 6; }
+  uint8_t frame_footer_size() override { return 0; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -177,8 +268,6 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   std::vector<uint8_t> rx_buf_;
   size_t rx_buf_len_ = 0;
 
-  std::vector<uint8_t> tx_buf_;
-
   enum class State {
     INITIALIZE = 1,
     DATA = 2,
@@ -1,9 +1,10 @@
 // This file was automatically generated with a tool.
 // See scripts/api_protobuf/api_protobuf.py
 #include "api_pb2.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
-#include <cinttypes>
+#include <cstddef>
 
 namespace esphome {
 namespace api {
@@ -567,8071 +568,2603 @@ template<> const char *proto_enum_to_string<enums::ValveOperation>(enums::ValveO
   }
 }
 #endif
-bool HelloRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->api_version_major = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->api_version_minor = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->client_info = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void HelloRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->client_info);
-  buffer.encode_uint32(2, this->api_version_major);
-  buffer.encode_uint32(3, this->api_version_minor);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void HelloRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("HelloRequest {\n");
-  out.append("  client_info: ");
-  out.append("'").append(this->client_info).append("'");
-  out.append("\n");
-
-  out.append("  api_version_major: ");
-  sprintf(buffer, "%" PRIu32, this->api_version_major);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  api_version_minor: ");
-  sprintf(buffer, "%" PRIu32, this->api_version_minor);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool HelloResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->api_version_major = value.as_uint32();
-      return true;
-    }
-    case 2: {
-      this->api_version_minor = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool HelloResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->server_info = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->name = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void HelloResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint32(1, this->api_version_major);
-  buffer.encode_uint32(2, this->api_version_minor);
-  buffer.encode_string(3, this->server_info);
-  buffer.encode_string(4, this->name);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void HelloResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("HelloResponse {\n");
-  out.append("  api_version_major: ");
-  sprintf(buffer, "%" PRIu32, this->api_version_major);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  api_version_minor: ");
-  sprintf(buffer, "%" PRIu32, this->api_version_minor);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  server_info: ");
-  out.append("'").append(this->server_info).append("'");
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->password = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ConnectRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ConnectRequest {\n");
-  out.append("  password: ");
-  out.append("'").append(this->password).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->invalid_password = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ConnectResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ConnectResponse {\n");
-  out.append("  invalid_password: ");
-  out.append(YESNO(this->invalid_password));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
-#endif
-void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
-#endif
-void PingRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
-#endif
-void PingResponse::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
-#endif
-void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
-#endif
-bool DeviceInfoResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->uses_password = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->has_deep_sleep = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->webserver_port = value.as_uint32();
-      return true;
-    }
-    case 11: {
-      this->legacy_bluetooth_proxy_version = value.as_uint32();
-      return true;
-    }
-    case 15: {
-      this->bluetooth_proxy_feature_flags = value.as_uint32();
-      return true;
-    }
-    case 14: {
-      this->legacy_voice_assistant_version = value.as_uint32();
-      return true;
-    }
-    case 17: {
-      this->voice_assistant_feature_flags = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool DeviceInfoResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->mac_address = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->esphome_version = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->compilation_time = value.as_string();
-      return true;
-    }
-    case 6: {
-      this->model = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->project_name = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->project_version = value.as_string();
-      return true;
-    }
-    case 12: {
-      this->manufacturer = value.as_string();
-      return true;
-    }
-    case 13: {
-      this->friendly_name = value.as_string();
-      return true;
-    }
-    case 16: {
-      this->suggested_area = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bool(1, this->uses_password);
-  buffer.encode_string(2, this->name);
-  buffer.encode_string(3, this->mac_address);
-  buffer.encode_string(4, this->esphome_version);
-  buffer.encode_string(5, this->compilation_time);
-  buffer.encode_string(6, this->model);
-  buffer.encode_bool(7, this->has_deep_sleep);
-  buffer.encode_string(8, this->project_name);
-  buffer.encode_string(9, this->project_version);
-  buffer.encode_uint32(10, this->webserver_port);
-  buffer.encode_uint32(11, this->legacy_bluetooth_proxy_version);
-  buffer.encode_uint32(15, this->bluetooth_proxy_feature_flags);
-  buffer.encode_string(12, this->manufacturer);
-  buffer.encode_string(13, this->friendly_name);
-  buffer.encode_uint32(14, this->legacy_voice_assistant_version);
-  buffer.encode_uint32(17, this->voice_assistant_feature_flags);
-  buffer.encode_string(16, this->suggested_area);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DeviceInfoResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("DeviceInfoResponse {\n");
-  out.append("  uses_password: ");
-  out.append(YESNO(this->uses_password));
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  mac_address: ");
-  out.append("'").append(this->mac_address).append("'");
-  out.append("\n");
-
-  out.append("  esphome_version: ");
-  out.append("'").append(this->esphome_version).append("'");
-  out.append("\n");
-
-  out.append("  compilation_time: ");
-  out.append("'").append(this->compilation_time).append("'");
-  out.append("\n");
-
-  out.append("  model: ");
-  out.append("'").append(this->model).append("'");
-  out.append("\n");
-
-  out.append("  has_deep_sleep: ");
-  out.append(YESNO(this->has_deep_sleep));
-  out.append("\n");
-
-  out.append("  project_name: ");
-  out.append("'").append(this->project_name).append("'");
-  out.append("\n");
-
-  out.append("  project_version: ");
-  out.append("'").append(this->project_version).append("'");
-  out.append("\n");
-
-  out.append("  webserver_port: ");
-  sprintf(buffer, "%" PRIu32, this->webserver_port);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  legacy_bluetooth_proxy_version: ");
-  sprintf(buffer, "%" PRIu32, this->legacy_bluetooth_proxy_version);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  bluetooth_proxy_feature_flags: ");
-  sprintf(buffer, "%" PRIu32, this->bluetooth_proxy_feature_flags);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  manufacturer: ");
-  out.append("'").append(this->manufacturer).append("'");
-  out.append("\n");
-
-  out.append("  friendly_name: ");
-  out.append("'").append(this->friendly_name).append("'");
-  out.append("\n");
-
-  out.append("  legacy_voice_assistant_version: ");
-  sprintf(buffer, "%" PRIu32, this->legacy_voice_assistant_version);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  voice_assistant_feature_flags: ");
-  sprintf(buffer, "%" PRIu32, this->voice_assistant_feature_flags);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  suggested_area: ");
-  out.append("'").append(this->suggested_area).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
-#endif
-void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
-#endif
-void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
-#endif
-bool ListEntitiesBinarySensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->is_status_binary_sensor = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 9: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesBinarySensorResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesBinarySensorResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->device_class);
-  buffer.encode_bool(6, this->is_status_binary_sensor);
-  buffer.encode_bool(7, this->disabled_by_default);
-  buffer.encode_string(8, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(9, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesBinarySensorResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-
-  out.append("  is_status_binary_sensor: ");
-  out.append(YESNO(this->is_status_binary_sensor));
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BinarySensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BinarySensorStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BinarySensorStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BinarySensorStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesCoverResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 5: {
-      this->assumed_state = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->supports_position = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->supports_tilt = value.as_bool();
-      return true;
-    }
-    case 9: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 12: {
-      this->supports_stop = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesCoverResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    case 10: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesCoverResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_bool(5, this->assumed_state);
-  buffer.encode_bool(6, this->supports_position);
-  buffer.encode_bool(7, this->supports_tilt);
-  buffer.encode_string(8, this->device_class);
-  buffer.encode_bool(9, this->disabled_by_default);
-  buffer.encode_string(10, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
-  buffer.encode_bool(12, this->supports_stop);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesCoverResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesCoverResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  assumed_state: ");
-  out.append(YESNO(this->assumed_state));
-  out.append("\n");
-
-  out.append("  supports_position: ");
-  out.append(YESNO(this->supports_position));
-  out.append("\n");
-
-  out.append("  supports_tilt: ");
-  out.append(YESNO(this->supports_tilt));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  supports_stop: ");
-  out.append(YESNO(this->supports_stop));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool CoverStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->legacy_state = value.as_enum<enums::LegacyCoverState>();
-      return true;
-    }
-    case 5: {
-      this->current_operation = value.as_enum<enums::CoverOperation>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool CoverStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->position = value.as_float();
-      return true;
-    }
-    case 4: {
-      this->tilt = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::LegacyCoverState>(2, this->legacy_state);
-  buffer.encode_float(3, this->position);
-  buffer.encode_float(4, this->tilt);
-  buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void CoverStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("CoverStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  legacy_state: ");
-  out.append(proto_enum_to_string<enums::LegacyCoverState>(this->legacy_state));
-  out.append("\n");
-
-  out.append("  position: ");
-  sprintf(buffer, "%g", this->position);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  tilt: ");
-  sprintf(buffer, "%g", this->tilt);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  current_operation: ");
-  out.append(proto_enum_to_string<enums::CoverOperation>(this->current_operation));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool CoverCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_legacy_command = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->legacy_command = value.as_enum<enums::LegacyCoverCommand>();
-      return true;
-    }
-    case 4: {
-      this->has_position = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->has_tilt = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->stop = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool CoverCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 5: {
-      this->position = value.as_float();
-      return true;
-    }
-    case 7: {
-      this->tilt = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_legacy_command);
-  buffer.encode_enum<enums::LegacyCoverCommand>(3, this->legacy_command);
-  buffer.encode_bool(4, this->has_position);
-  buffer.encode_float(5, this->position);
-  buffer.encode_bool(6, this->has_tilt);
-  buffer.encode_float(7, this->tilt);
-  buffer.encode_bool(8, this->stop);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void CoverCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("CoverCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_legacy_command: ");
-  out.append(YESNO(this->has_legacy_command));
-  out.append("\n");
-
-  out.append("  legacy_command: ");
-  out.append(proto_enum_to_string<enums::LegacyCoverCommand>(this->legacy_command));
-  out.append("\n");
-
-  out.append("  has_position: ");
-  out.append(YESNO(this->has_position));
-  out.append("\n");
-
-  out.append("  position: ");
-  sprintf(buffer, "%g", this->position);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_tilt: ");
-  out.append(YESNO(this->has_tilt));
-  out.append("\n");
-
-  out.append("  tilt: ");
-  sprintf(buffer, "%g", this->tilt);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  stop: ");
-  out.append(YESNO(this->stop));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesFanResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 5: {
-      this->supports_oscillation = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->supports_speed = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->supports_direction = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->supported_speed_count = value.as_int32();
-      return true;
-    }
-    case 9: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesFanResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 10: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 12: {
-      this->supported_preset_modes.push_back(value.as_string());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesFanResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_bool(5, this->supports_oscillation);
-  buffer.encode_bool(6, this->supports_speed);
-  buffer.encode_bool(7, this->supports_direction);
-  buffer.encode_int32(8, this->supported_speed_count);
-  buffer.encode_bool(9, this->disabled_by_default);
-  buffer.encode_string(10, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
-  for (auto &it : this->supported_preset_modes) {
-    buffer.encode_string(12, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesFanResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesFanResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  supports_oscillation: ");
-  out.append(YESNO(this->supports_oscillation));
-  out.append("\n");
-
-  out.append("  supports_speed: ");
-  out.append(YESNO(this->supports_speed));
-  out.append("\n");
-
-  out.append("  supports_direction: ");
-  out.append(YESNO(this->supports_direction));
-  out.append("\n");
-
-  out.append("  supported_speed_count: ");
-  sprintf(buffer, "%" PRId32, this->supported_speed_count);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  for (const auto &it : this->supported_preset_modes) {
-    out.append("  supported_preset_modes: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool FanStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->oscillating = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->speed = value.as_enum<enums::FanSpeed>();
-      return true;
-    }
-    case 5: {
-      this->direction = value.as_enum<enums::FanDirection>();
-      return true;
-    }
-    case 6: {
-      this->speed_level = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool FanStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 7: {
-      this->preset_mode = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool FanStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-  buffer.encode_bool(3, this->oscillating);
-  buffer.encode_enum<enums::FanSpeed>(4, this->speed);
-  buffer.encode_enum<enums::FanDirection>(5, this->direction);
-  buffer.encode_int32(6, this->speed_level);
-  buffer.encode_string(7, this->preset_mode);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void FanStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("FanStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-
-  out.append("  oscillating: ");
-  out.append(YESNO(this->oscillating));
-  out.append("\n");
-
-  out.append("  speed: ");
-  out.append(proto_enum_to_string<enums::FanSpeed>(this->speed));
-  out.append("\n");
-
-  out.append("  direction: ");
-  out.append(proto_enum_to_string<enums::FanDirection>(this->direction));
-  out.append("\n");
-
-  out.append("  speed_level: ");
-  sprintf(buffer, "%" PRId32, this->speed_level);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  preset_mode: ");
-  out.append("'").append(this->preset_mode).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool FanCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->state = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->has_speed = value.as_bool();
-      return true;
-    }
-    case 5: {
-      this->speed = value.as_enum<enums::FanSpeed>();
-      return true;
-    }
-    case 6: {
-      this->has_oscillating = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->oscillating = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->has_direction = value.as_bool();
-      return true;
-    }
-    case 9: {
-      this->direction = value.as_enum<enums::FanDirection>();
-      return true;
-    }
-    case 10: {
-      this->has_speed_level = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->speed_level = value.as_int32();
-      return true;
-    }
-    case 12: {
-      this->has_preset_mode = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool FanCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 13: {
-      this->preset_mode = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool FanCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_state);
-  buffer.encode_bool(3, this->state);
-  buffer.encode_bool(4, this->has_speed);
-  buffer.encode_enum<enums::FanSpeed>(5, this->speed);
-  buffer.encode_bool(6, this->has_oscillating);
-  buffer.encode_bool(7, this->oscillating);
-  buffer.encode_bool(8, this->has_direction);
-  buffer.encode_enum<enums::FanDirection>(9, this->direction);
-  buffer.encode_bool(10, this->has_speed_level);
-  buffer.encode_int32(11, this->speed_level);
-  buffer.encode_bool(12, this->has_preset_mode);
-  buffer.encode_string(13, this->preset_mode);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void FanCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("FanCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_state: ");
-  out.append(YESNO(this->has_state));
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-
-  out.append("  has_speed: ");
-  out.append(YESNO(this->has_speed));
-  out.append("\n");
-
-  out.append("  speed: ");
-  out.append(proto_enum_to_string<enums::FanSpeed>(this->speed));
-  out.append("\n");
-
-  out.append("  has_oscillating: ");
-  out.append(YESNO(this->has_oscillating));
-  out.append("\n");
-
-  out.append("  oscillating: ");
-  out.append(YESNO(this->oscillating));
-  out.append("\n");
-
-  out.append("  has_direction: ");
-  out.append(YESNO(this->has_direction));
-  out.append("\n");
-
-  out.append("  direction: ");
-  out.append(proto_enum_to_string<enums::FanDirection>(this->direction));
-  out.append("\n");
-
-  out.append("  has_speed_level: ");
-  out.append(YESNO(this->has_speed_level));
-  out.append("\n");
-
-  out.append("  speed_level: ");
-  sprintf(buffer, "%" PRId32, this->speed_level);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_preset_mode: ");
-  out.append(YESNO(this->has_preset_mode));
-  out.append("\n");
-
-  out.append("  preset_mode: ");
-  out.append("'").append(this->preset_mode).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesLightResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 12: {
-      this->supported_color_modes.push_back(value.as_enum<enums::ColorMode>());
-      return true;
-    }
-    case 5: {
-      this->legacy_supports_brightness = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->legacy_supports_rgb = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->legacy_supports_white_value = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->legacy_supports_color_temperature = value.as_bool();
-      return true;
-    }
-    case 13: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 15: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesLightResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 11: {
-      this->effects.push_back(value.as_string());
-      return true;
-    }
-    case 14: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesLightResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 9: {
-      this->min_mireds = value.as_float();
-      return true;
-    }
-    case 10: {
-      this->max_mireds = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  for (auto &it : this->supported_color_modes) {
-    buffer.encode_enum<enums::ColorMode>(12, it, true);
-  }
-  buffer.encode_bool(5, this->legacy_supports_brightness);
-  buffer.encode_bool(6, this->legacy_supports_rgb);
-  buffer.encode_bool(7, this->legacy_supports_white_value);
-  buffer.encode_bool(8, this->legacy_supports_color_temperature);
-  buffer.encode_float(9, this->min_mireds);
-  buffer.encode_float(10, this->max_mireds);
-  for (auto &it : this->effects) {
-    buffer.encode_string(11, it, true);
-  }
-  buffer.encode_bool(13, this->disabled_by_default);
-  buffer.encode_string(14, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(15, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesLightResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesLightResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  for (const auto &it : this->supported_color_modes) {
-    out.append("  supported_color_modes: ");
-    out.append(proto_enum_to_string<enums::ColorMode>(it));
-    out.append("\n");
-  }
-
-  out.append("  legacy_supports_brightness: ");
-  out.append(YESNO(this->legacy_supports_brightness));
-  out.append("\n");
-
-  out.append("  legacy_supports_rgb: ");
-  out.append(YESNO(this->legacy_supports_rgb));
-  out.append("\n");
-
-  out.append("  legacy_supports_white_value: ");
-  out.append(YESNO(this->legacy_supports_white_value));
-  out.append("\n");
-
-  out.append("  legacy_supports_color_temperature: ");
-  out.append(YESNO(this->legacy_supports_color_temperature));
-  out.append("\n");
-
-  out.append("  min_mireds: ");
-  sprintf(buffer, "%g", this->min_mireds);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  max_mireds: ");
-  sprintf(buffer, "%g", this->max_mireds);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->effects) {
-    out.append("  effects: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool LightStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->color_mode = value.as_enum<enums::ColorMode>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LightStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 9: {
-      this->effect = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LightStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->brightness = value.as_float();
-      return true;
-    }
-    case 10: {
-      this->color_brightness = value.as_float();
-      return true;
-    }
-    case 4: {
-      this->red = value.as_float();
-      return true;
-    }
-    case 5: {
-      this->green = value.as_float();
-      return true;
-    }
-    case 6: {
-      this->blue = value.as_float();
-      return true;
-    }
-    case 7: {
-      this->white = value.as_float();
-      return true;
-    }
-    case 8: {
-      this->color_temperature = value.as_float();
-      return true;
-    }
-    case 12: {
-      this->cold_white = value.as_float();
-      return true;
-    }
-    case 13: {
-      this->warm_white = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-  buffer.encode_float(3, this->brightness);
-  buffer.encode_enum<enums::ColorMode>(11, this->color_mode);
-  buffer.encode_float(10, this->color_brightness);
-  buffer.encode_float(4, this->red);
-  buffer.encode_float(5, this->green);
-  buffer.encode_float(6, this->blue);
-  buffer.encode_float(7, this->white);
-  buffer.encode_float(8, this->color_temperature);
-  buffer.encode_float(12, this->cold_white);
-  buffer.encode_float(13, this->warm_white);
-  buffer.encode_string(9, this->effect);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void LightStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("LightStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-
-  out.append("  brightness: ");
-  sprintf(buffer, "%g", this->brightness);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  color_mode: ");
-  out.append(proto_enum_to_string<enums::ColorMode>(this->color_mode));
-  out.append("\n");
-
-  out.append("  color_brightness: ");
-  sprintf(buffer, "%g", this->color_brightness);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  red: ");
-  sprintf(buffer, "%g", this->red);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  green: ");
-  sprintf(buffer, "%g", this->green);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  blue: ");
-  sprintf(buffer, "%g", this->blue);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  white: ");
-  sprintf(buffer, "%g", this->white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  color_temperature: ");
-  sprintf(buffer, "%g", this->color_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  cold_white: ");
-  sprintf(buffer, "%g", this->cold_white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  warm_white: ");
-  sprintf(buffer, "%g", this->warm_white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  effect: ");
-  out.append("'").append(this->effect).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool LightCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->state = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->has_brightness = value.as_bool();
-      return true;
-    }
-    case 22: {
-      this->has_color_mode = value.as_bool();
-      return true;
-    }
-    case 23: {
-      this->color_mode = value.as_enum<enums::ColorMode>();
-      return true;
-    }
-    case 20: {
-      this->has_color_brightness = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->has_rgb = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->has_white = value.as_bool();
-      return true;
-    }
-    case 12: {
-      this->has_color_temperature = value.as_bool();
-      return true;
-    }
-    case 24: {
-      this->has_cold_white = value.as_bool();
-      return true;
-    }
-    case 26: {
-      this->has_warm_white = value.as_bool();
-      return true;
-    }
-    case 14: {
-      this->has_transition_length = value.as_bool();
-      return true;
-    }
-    case 15: {
-      this->transition_length = value.as_uint32();
-      return true;
-    }
-    case 16: {
-      this->has_flash_length = value.as_bool();
-      return true;
-    }
-    case 17: {
-      this->flash_length = value.as_uint32();
-      return true;
-    }
-    case 18: {
-      this->has_effect = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LightCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 19: {
-      this->effect = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LightCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 5: {
-      this->brightness = value.as_float();
-      return true;
-    }
-    case 21: {
-      this->color_brightness = value.as_float();
-      return true;
-    }
-    case 7: {
-      this->red = value.as_float();
-      return true;
-    }
-    case 8: {
-      this->green = value.as_float();
-      return true;
-    }
-    case 9: {
-      this->blue = value.as_float();
-      return true;
-    }
-    case 11: {
-      this->white = value.as_float();
-      return true;
-    }
-    case 13: {
-      this->color_temperature = value.as_float();
-      return true;
-    }
-    case 25: {
-      this->cold_white = value.as_float();
-      return true;
-    }
-    case 27: {
-      this->warm_white = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_state);
-  buffer.encode_bool(3, this->state);
-  buffer.encode_bool(4, this->has_brightness);
-  buffer.encode_float(5, this->brightness);
-  buffer.encode_bool(22, this->has_color_mode);
-  buffer.encode_enum<enums::ColorMode>(23, this->color_mode);
-  buffer.encode_bool(20, this->has_color_brightness);
-  buffer.encode_float(21, this->color_brightness);
-  buffer.encode_bool(6, this->has_rgb);
-  buffer.encode_float(7, this->red);
-  buffer.encode_float(8, this->green);
-  buffer.encode_float(9, this->blue);
-  buffer.encode_bool(10, this->has_white);
-  buffer.encode_float(11, this->white);
-  buffer.encode_bool(12, this->has_color_temperature);
-  buffer.encode_float(13, this->color_temperature);
-  buffer.encode_bool(24, this->has_cold_white);
-  buffer.encode_float(25, this->cold_white);
-  buffer.encode_bool(26, this->has_warm_white);
-  buffer.encode_float(27, this->warm_white);
-  buffer.encode_bool(14, this->has_transition_length);
-  buffer.encode_uint32(15, this->transition_length);
-  buffer.encode_bool(16, this->has_flash_length);
-  buffer.encode_uint32(17, this->flash_length);
-  buffer.encode_bool(18, this->has_effect);
-  buffer.encode_string(19, this->effect);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void LightCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("LightCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_state: ");
-  out.append(YESNO(this->has_state));
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-
-  out.append("  has_brightness: ");
-  out.append(YESNO(this->has_brightness));
-  out.append("\n");
-
-  out.append("  brightness: ");
-  sprintf(buffer, "%g", this->brightness);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_color_mode: ");
-  out.append(YESNO(this->has_color_mode));
-  out.append("\n");
-
-  out.append("  color_mode: ");
-  out.append(proto_enum_to_string<enums::ColorMode>(this->color_mode));
-  out.append("\n");
-
-  out.append("  has_color_brightness: ");
-  out.append(YESNO(this->has_color_brightness));
-  out.append("\n");
-
-  out.append("  color_brightness: ");
-  sprintf(buffer, "%g", this->color_brightness);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_rgb: ");
-  out.append(YESNO(this->has_rgb));
-  out.append("\n");
-
-  out.append("  red: ");
-  sprintf(buffer, "%g", this->red);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  green: ");
-  sprintf(buffer, "%g", this->green);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  blue: ");
-  sprintf(buffer, "%g", this->blue);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_white: ");
-  out.append(YESNO(this->has_white));
-  out.append("\n");
-
-  out.append("  white: ");
-  sprintf(buffer, "%g", this->white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_color_temperature: ");
-  out.append(YESNO(this->has_color_temperature));
-  out.append("\n");
-
-  out.append("  color_temperature: ");
-  sprintf(buffer, "%g", this->color_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_cold_white: ");
-  out.append(YESNO(this->has_cold_white));
-  out.append("\n");
-
-  out.append("  cold_white: ");
-  sprintf(buffer, "%g", this->cold_white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_warm_white: ");
-  out.append(YESNO(this->has_warm_white));
-  out.append("\n");
-
-  out.append("  warm_white: ");
-  sprintf(buffer, "%g", this->warm_white);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_transition_length: ");
-  out.append(YESNO(this->has_transition_length));
-  out.append("\n");
-
-  out.append("  transition_length: ");
-  sprintf(buffer, "%" PRIu32, this->transition_length);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_flash_length: ");
-  out.append(YESNO(this->has_flash_length));
-  out.append("\n");
-
-  out.append("  flash_length: ");
-  sprintf(buffer, "%" PRIu32, this->flash_length);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_effect: ");
-  out.append(YESNO(this->has_effect));
-  out.append("\n");
-
-  out.append("  effect: ");
-  out.append("'").append(this->effect).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesSensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 7: {
-      this->accuracy_decimals = value.as_int32();
-      return true;
-    }
-    case 8: {
-      this->force_update = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->state_class = value.as_enum<enums::SensorStateClass>();
-      return true;
-    }
-    case 11: {
-      this->legacy_last_reset_type = value.as_enum<enums::SensorLastResetType>();
-      return true;
-    }
-    case 12: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 13: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSensorResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 6: {
-      this->unit_of_measurement = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSensorResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_string(6, this->unit_of_measurement);
-  buffer.encode_int32(7, this->accuracy_decimals);
-  buffer.encode_bool(8, this->force_update);
-  buffer.encode_string(9, this->device_class);
-  buffer.encode_enum<enums::SensorStateClass>(10, this->state_class);
-  buffer.encode_enum<enums::SensorLastResetType>(11, this->legacy_last_reset_type);
-  buffer.encode_bool(12, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(13, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesSensorResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesSensorResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  unit_of_measurement: ");
-  out.append("'").append(this->unit_of_measurement).append("'");
-  out.append("\n");
-
-  out.append("  accuracy_decimals: ");
-  sprintf(buffer, "%" PRId32, this->accuracy_decimals);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  force_update: ");
-  out.append(YESNO(this->force_update));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-
-  out.append("  state_class: ");
-  out.append(proto_enum_to_string<enums::SensorStateClass>(this->state_class));
-  out.append("\n");
-
-  out.append("  legacy_last_reset_type: ");
-  out.append(proto_enum_to_string<enums::SensorLastResetType>(this->legacy_last_reset_type));
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SensorStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 2: {
-      this->state = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SensorStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SensorStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  sprintf(buffer, "%g", this->state);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesSwitchResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->assumed_state = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSwitchResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSwitchResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->assumed_state);
-  buffer.encode_bool(7, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
-  buffer.encode_string(9, this->device_class);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesSwitchResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  assumed_state: ");
-  out.append(YESNO(this->assumed_state));
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SwitchStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SwitchStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SwitchStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SwitchStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SwitchCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SwitchCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SwitchCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SwitchCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(YESNO(this->state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesTextSensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTextSensorResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTextSensorResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_string(8, this->device_class);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesTextSensorResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool TextSensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TextSensorStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TextSensorStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void TextSensorStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("TextSensorStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->level = value.as_enum<enums::LogLevel>();
-      return true;
-    }
-    case 2: {
-      this->dump_config = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_enum<enums::LogLevel>(1, this->level);
-  buffer.encode_bool(2, this->dump_config);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeLogsRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SubscribeLogsRequest {\n");
-  out.append("  level: ");
-  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
-  out.append("\n");
-
-  out.append("  dump_config: ");
-  out.append(YESNO(this->dump_config));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SubscribeLogsResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->level = value.as_enum<enums::LogLevel>();
-      return true;
-    }
-    case 4: {
-      this->send_failed = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SubscribeLogsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->message = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_enum<enums::LogLevel>(1, this->level);
-  buffer.encode_string(3, this->message);
-  buffer.encode_bool(4, this->send_failed);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeLogsResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SubscribeLogsResponse {\n");
-  out.append("  level: ");
-  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
-  out.append("\n");
-
-  out.append("  message: ");
-  out.append("'").append(this->message).append("'");
-  out.append("\n");
-
-  out.append("  send_failed: ");
-  out.append(YESNO(this->send_failed));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
-  out.append("SubscribeHomeassistantServicesRequest {}");
-}
-#endif
-bool HomeassistantServiceMap::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_string();
-      return true;
-    }
-    case 2: {
-      this->value = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->key);
-  buffer.encode_string(2, this->value);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void HomeassistantServiceMap::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("HomeassistantServiceMap {\n");
-  out.append("  key: ");
-  out.append("'").append(this->key).append("'");
-  out.append("\n");
-
-  out.append("  value: ");
-  out.append("'").append(this->value).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool HomeassistantServiceResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 5: {
-      this->is_event = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool HomeassistantServiceResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->service = value.as_string();
-      return true;
-    }
-    case 2: {
-      this->data.push_back(value.as_message<HomeassistantServiceMap>());
-      return true;
-    }
-    case 3: {
-      this->data_template.push_back(value.as_message<HomeassistantServiceMap>());
-      return true;
-    }
-    case 4: {
-      this->variables.push_back(value.as_message<HomeassistantServiceMap>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->service);
-  for (auto &it : this->data) {
-    buffer.encode_message<HomeassistantServiceMap>(2, it, true);
-  }
-  for (auto &it : this->data_template) {
-    buffer.encode_message<HomeassistantServiceMap>(3, it, true);
-  }
-  for (auto &it : this->variables) {
-    buffer.encode_message<HomeassistantServiceMap>(4, it, true);
-  }
-  buffer.encode_bool(5, this->is_event);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void HomeassistantServiceResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("HomeassistantServiceResponse {\n");
-  out.append("  service: ");
-  out.append("'").append(this->service).append("'");
-  out.append("\n");
-
-  for (const auto &it : this->data) {
-    out.append("  data: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-
-  for (const auto &it : this->data_template) {
-    out.append("  data_template: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-
-  for (const auto &it : this->variables) {
-    out.append("  variables: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-
-  out.append("  is_event: ");
-  out.append(YESNO(this->is_event));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
-  out.append("SubscribeHomeAssistantStatesRequest {}");
-}
-#endif
-bool SubscribeHomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->entity_id = value.as_string();
-      return true;
-    }
-    case 2: {
-      this->attribute = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->entity_id);
-  buffer.encode_string(2, this->attribute);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SubscribeHomeAssistantStateResponse {\n");
-  out.append("  entity_id: ");
-  out.append("'").append(this->entity_id).append("'");
-  out.append("\n");
-
-  out.append("  attribute: ");
-  out.append("'").append(this->attribute).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool HomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->entity_id = value.as_string();
-      return true;
-    }
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->attribute = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->entity_id);
-  buffer.encode_string(2, this->state);
-  buffer.encode_string(3, this->attribute);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void HomeAssistantStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("HomeAssistantStateResponse {\n");
-  out.append("  entity_id: ");
-  out.append("'").append(this->entity_id).append("'");
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-
-  out.append("  attribute: ");
-  out.append("'").append(this->attribute).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
-#endif
-bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->epoch_seconds = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void GetTimeResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("GetTimeResponse {\n");
-  out.append("  epoch_seconds: ");
-  sprintf(buffer, "%" PRIu32, this->epoch_seconds);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesServicesArgument::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->type = value.as_enum<enums::ServiceArgType>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesServicesArgument::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->name = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->name);
-  buffer.encode_enum<enums::ServiceArgType>(2, this->type);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesServicesArgument::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesServicesArgument {\n");
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  type: ");
-  out.append(proto_enum_to_string<enums::ServiceArgType>(this->type));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesServicesResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->args.push_back(value.as_message<ListEntitiesServicesArgument>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesServicesResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->name);
-  buffer.encode_fixed32(2, this->key);
-  for (auto &it : this->args) {
-    buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesServicesResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesServicesResponse {\n");
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->args) {
-    out.append("  args: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool ExecuteServiceArgument::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->bool_ = value.as_bool();
-      return true;
-    }
-    case 2: {
-      this->legacy_int = value.as_int32();
-      return true;
-    }
-    case 5: {
-      this->int_ = value.as_sint32();
-      return true;
-    }
-    case 6: {
-      this->bool_array.push_back(value.as_bool());
-      return true;
-    }
-    case 7: {
-      this->int_array.push_back(value.as_sint32());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ExecuteServiceArgument::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 4: {
-      this->string_ = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->string_array.push_back(value.as_string());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ExecuteServiceArgument::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 3: {
-      this->float_ = value.as_float();
-      return true;
-    }
-    case 8: {
-      this->float_array.push_back(value.as_float());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bool(1, this->bool_);
-  buffer.encode_int32(2, this->legacy_int);
-  buffer.encode_float(3, this->float_);
-  buffer.encode_string(4, this->string_);
-  buffer.encode_sint32(5, this->int_);
-  for (auto it : this->bool_array) {
-    buffer.encode_bool(6, it, true);
-  }
-  for (auto &it : this->int_array) {
-    buffer.encode_sint32(7, it, true);
-  }
-  for (auto &it : this->float_array) {
-    buffer.encode_float(8, it, true);
-  }
-  for (auto &it : this->string_array) {
-    buffer.encode_string(9, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ExecuteServiceArgument::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ExecuteServiceArgument {\n");
-  out.append("  bool_: ");
-  out.append(YESNO(this->bool_));
-  out.append("\n");
-
-  out.append("  legacy_int: ");
-  sprintf(buffer, "%" PRId32, this->legacy_int);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  float_: ");
-  sprintf(buffer, "%g", this->float_);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  string_: ");
-  out.append("'").append(this->string_).append("'");
-  out.append("\n");
-
-  out.append("  int_: ");
-  sprintf(buffer, "%" PRId32, this->int_);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto it : this->bool_array) {
-    out.append("  bool_array: ");
-    out.append(YESNO(it));
-    out.append("\n");
-  }
-
-  for (const auto &it : this->int_array) {
-    out.append("  int_array: ");
-    sprintf(buffer, "%" PRId32, it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  for (const auto &it : this->float_array) {
-    out.append("  float_array: ");
-    sprintf(buffer, "%g", it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  for (const auto &it : this->string_array) {
-    out.append("  string_array: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool ExecuteServiceRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->args.push_back(value.as_message<ExecuteServiceArgument>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ExecuteServiceRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  for (auto &it : this->args) {
-    buffer.encode_message<ExecuteServiceArgument>(2, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ExecuteServiceRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ExecuteServiceRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->args) {
-    out.append("  args: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool ListEntitiesCameraResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 5: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesCameraResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 6: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesCameraResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_bool(5, this->disabled_by_default);
-  buffer.encode_string(6, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesCameraResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesCameraResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool CameraImageResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->done = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool CameraImageResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool CameraImageResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->data);
-  buffer.encode_bool(3, this->done);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void CameraImageResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("CameraImageResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-
-  out.append("  done: ");
-  out.append(YESNO(this->done));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool CameraImageRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->single = value.as_bool();
-      return true;
-    }
-    case 2: {
-      this->stream = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bool(1, this->single);
-  buffer.encode_bool(2, this->stream);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void CameraImageRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("CameraImageRequest {\n");
-  out.append("  single: ");
-  out.append(YESNO(this->single));
-  out.append("\n");
-
-  out.append("  stream: ");
-  out.append(YESNO(this->stream));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesClimateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 5: {
-      this->supports_current_temperature = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->supports_two_point_target_temperature = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->supported_modes.push_back(value.as_enum<enums::ClimateMode>());
-      return true;
-    }
-    case 11: {
-      this->legacy_supports_away = value.as_bool();
-      return true;
-    }
-    case 12: {
-      this->supports_action = value.as_bool();
-      return true;
-    }
-    case 13: {
-      this->supported_fan_modes.push_back(value.as_enum<enums::ClimateFanMode>());
-      return true;
-    }
-    case 14: {
-      this->supported_swing_modes.push_back(value.as_enum<enums::ClimateSwingMode>());
-      return true;
-    }
-    case 16: {
-      this->supported_presets.push_back(value.as_enum<enums::ClimatePreset>());
-      return true;
-    }
-    case 18: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 20: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 22: {
-      this->supports_current_humidity = value.as_bool();
-      return true;
-    }
-    case 23: {
-      this->supports_target_humidity = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesClimateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 15: {
-      this->supported_custom_fan_modes.push_back(value.as_string());
-      return true;
-    }
-    case 17: {
-      this->supported_custom_presets.push_back(value.as_string());
-      return true;
-    }
-    case 19: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesClimateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 8: {
-      this->visual_min_temperature = value.as_float();
-      return true;
-    }
-    case 9: {
-      this->visual_max_temperature = value.as_float();
-      return true;
-    }
-    case 10: {
-      this->visual_target_temperature_step = value.as_float();
-      return true;
-    }
-    case 21: {
-      this->visual_current_temperature_step = value.as_float();
-      return true;
-    }
-    case 24: {
-      this->visual_min_humidity = value.as_float();
-      return true;
-    }
-    case 25: {
-      this->visual_max_humidity = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_bool(5, this->supports_current_temperature);
-  buffer.encode_bool(6, this->supports_two_point_target_temperature);
-  for (auto &it : this->supported_modes) {
-    buffer.encode_enum<enums::ClimateMode>(7, it, true);
-  }
-  buffer.encode_float(8, this->visual_min_temperature);
-  buffer.encode_float(9, this->visual_max_temperature);
-  buffer.encode_float(10, this->visual_target_temperature_step);
-  buffer.encode_bool(11, this->legacy_supports_away);
-  buffer.encode_bool(12, this->supports_action);
-  for (auto &it : this->supported_fan_modes) {
-    buffer.encode_enum<enums::ClimateFanMode>(13, it, true);
-  }
-  for (auto &it : this->supported_swing_modes) {
-    buffer.encode_enum<enums::ClimateSwingMode>(14, it, true);
-  }
-  for (auto &it : this->supported_custom_fan_modes) {
-    buffer.encode_string(15, it, true);
-  }
-  for (auto &it : this->supported_presets) {
-    buffer.encode_enum<enums::ClimatePreset>(16, it, true);
-  }
-  for (auto &it : this->supported_custom_presets) {
-    buffer.encode_string(17, it, true);
-  }
-  buffer.encode_bool(18, this->disabled_by_default);
-  buffer.encode_string(19, this->icon);
-  buffer.encode_enum<enums::EntityCategory>(20, this->entity_category);
-  buffer.encode_float(21, this->visual_current_temperature_step);
-  buffer.encode_bool(22, this->supports_current_humidity);
-  buffer.encode_bool(23, this->supports_target_humidity);
-  buffer.encode_float(24, this->visual_min_humidity);
-  buffer.encode_float(25, this->visual_max_humidity);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesClimateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesClimateResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  supports_current_temperature: ");
-  out.append(YESNO(this->supports_current_temperature));
-  out.append("\n");
-
-  out.append("  supports_two_point_target_temperature: ");
-  out.append(YESNO(this->supports_two_point_target_temperature));
-  out.append("\n");
-
-  for (const auto &it : this->supported_modes) {
-    out.append("  supported_modes: ");
-    out.append(proto_enum_to_string<enums::ClimateMode>(it));
-    out.append("\n");
-  }
-
-  out.append("  visual_min_temperature: ");
-  sprintf(buffer, "%g", this->visual_min_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  visual_max_temperature: ");
-  sprintf(buffer, "%g", this->visual_max_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  visual_target_temperature_step: ");
-  sprintf(buffer, "%g", this->visual_target_temperature_step);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  legacy_supports_away: ");
-  out.append(YESNO(this->legacy_supports_away));
-  out.append("\n");
-
-  out.append("  supports_action: ");
-  out.append(YESNO(this->supports_action));
-  out.append("\n");
-
-  for (const auto &it : this->supported_fan_modes) {
-    out.append("  supported_fan_modes: ");
-    out.append(proto_enum_to_string<enums::ClimateFanMode>(it));
-    out.append("\n");
-  }
-
-  for (const auto &it : this->supported_swing_modes) {
-    out.append("  supported_swing_modes: ");
-    out.append(proto_enum_to_string<enums::ClimateSwingMode>(it));
-    out.append("\n");
-  }
-
-  for (const auto &it : this->supported_custom_fan_modes) {
-    out.append("  supported_custom_fan_modes: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-
-  for (const auto &it : this->supported_presets) {
-    out.append("  supported_presets: ");
-    out.append(proto_enum_to_string<enums::ClimatePreset>(it));
-    out.append("\n");
-  }
-
-  for (const auto &it : this->supported_custom_presets) {
-    out.append("  supported_custom_presets: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  visual_current_temperature_step: ");
-  sprintf(buffer, "%g", this->visual_current_temperature_step);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  supports_current_humidity: ");
-  out.append(YESNO(this->supports_current_humidity));
-  out.append("\n");
-
-  out.append("  supports_target_humidity: ");
-  out.append(YESNO(this->supports_target_humidity));
-  out.append("\n");
-
-  out.append("  visual_min_humidity: ");
-  sprintf(buffer, "%g", this->visual_min_humidity);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  visual_max_humidity: ");
-  sprintf(buffer, "%g", this->visual_max_humidity);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ClimateStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->mode = value.as_enum<enums::ClimateMode>();
-      return true;
-    }
-    case 7: {
-      this->unused_legacy_away = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->action = value.as_enum<enums::ClimateAction>();
-      return true;
-    }
-    case 9: {
-      this->fan_mode = value.as_enum<enums::ClimateFanMode>();
-      return true;
-    }
-    case 10: {
-      this->swing_mode = value.as_enum<enums::ClimateSwingMode>();
-      return true;
-    }
-    case 12: {
-      this->preset = value.as_enum<enums::ClimatePreset>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ClimateStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 11: {
-      this->custom_fan_mode = value.as_string();
-      return true;
-    }
-    case 13: {
-      this->custom_preset = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ClimateStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->current_temperature = value.as_float();
-      return true;
-    }
-    case 4: {
-      this->target_temperature = value.as_float();
-      return true;
-    }
-    case 5: {
-      this->target_temperature_low = value.as_float();
-      return true;
-    }
-    case 6: {
-      this->target_temperature_high = value.as_float();
-      return true;
-    }
-    case 14: {
-      this->current_humidity = value.as_float();
-      return true;
-    }
-    case 15: {
-      this->target_humidity = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::ClimateMode>(2, this->mode);
-  buffer.encode_float(3, this->current_temperature);
-  buffer.encode_float(4, this->target_temperature);
-  buffer.encode_float(5, this->target_temperature_low);
-  buffer.encode_float(6, this->target_temperature_high);
-  buffer.encode_bool(7, this->unused_legacy_away);
-  buffer.encode_enum<enums::ClimateAction>(8, this->action);
-  buffer.encode_enum<enums::ClimateFanMode>(9, this->fan_mode);
-  buffer.encode_enum<enums::ClimateSwingMode>(10, this->swing_mode);
-  buffer.encode_string(11, this->custom_fan_mode);
-  buffer.encode_enum<enums::ClimatePreset>(12, this->preset);
-  buffer.encode_string(13, this->custom_preset);
-  buffer.encode_float(14, this->current_humidity);
-  buffer.encode_float(15, this->target_humidity);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ClimateStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ClimateStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  mode: ");
-  out.append(proto_enum_to_string<enums::ClimateMode>(this->mode));
-  out.append("\n");
-
-  out.append("  current_temperature: ");
-  sprintf(buffer, "%g", this->current_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  target_temperature: ");
-  sprintf(buffer, "%g", this->target_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  target_temperature_low: ");
-  sprintf(buffer, "%g", this->target_temperature_low);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  target_temperature_high: ");
-  sprintf(buffer, "%g", this->target_temperature_high);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  unused_legacy_away: ");
-  out.append(YESNO(this->unused_legacy_away));
-  out.append("\n");
-
-  out.append("  action: ");
-  out.append(proto_enum_to_string<enums::ClimateAction>(this->action));
-  out.append("\n");
-
-  out.append("  fan_mode: ");
-  out.append(proto_enum_to_string<enums::ClimateFanMode>(this->fan_mode));
-  out.append("\n");
-
-  out.append("  swing_mode: ");
-  out.append(proto_enum_to_string<enums::ClimateSwingMode>(this->swing_mode));
-  out.append("\n");
-
-  out.append("  custom_fan_mode: ");
-  out.append("'").append(this->custom_fan_mode).append("'");
-  out.append("\n");
-
-  out.append("  preset: ");
-  out.append(proto_enum_to_string<enums::ClimatePreset>(this->preset));
-  out.append("\n");
-
-  out.append("  custom_preset: ");
-  out.append("'").append(this->custom_preset).append("'");
-  out.append("\n");
-
-  out.append("  current_humidity: ");
-  sprintf(buffer, "%g", this->current_humidity);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  target_humidity: ");
-  sprintf(buffer, "%g", this->target_humidity);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ClimateCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_mode = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->mode = value.as_enum<enums::ClimateMode>();
-      return true;
-    }
-    case 4: {
-      this->has_target_temperature = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->has_target_temperature_low = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->has_target_temperature_high = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->unused_has_legacy_away = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->unused_legacy_away = value.as_bool();
-      return true;
-    }
-    case 12: {
-      this->has_fan_mode = value.as_bool();
-      return true;
-    }
-    case 13: {
-      this->fan_mode = value.as_enum<enums::ClimateFanMode>();
-      return true;
-    }
-    case 14: {
-      this->has_swing_mode = value.as_bool();
-      return true;
-    }
-    case 15: {
-      this->swing_mode = value.as_enum<enums::ClimateSwingMode>();
-      return true;
-    }
-    case 16: {
-      this->has_custom_fan_mode = value.as_bool();
-      return true;
-    }
-    case 18: {
-      this->has_preset = value.as_bool();
-      return true;
-    }
-    case 19: {
-      this->preset = value.as_enum<enums::ClimatePreset>();
-      return true;
-    }
-    case 20: {
-      this->has_custom_preset = value.as_bool();
-      return true;
-    }
-    case 22: {
-      this->has_target_humidity = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ClimateCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 17: {
-      this->custom_fan_mode = value.as_string();
-      return true;
-    }
-    case 21: {
-      this->custom_preset = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ClimateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 5: {
-      this->target_temperature = value.as_float();
-      return true;
-    }
-    case 7: {
-      this->target_temperature_low = value.as_float();
-      return true;
-    }
-    case 9: {
-      this->target_temperature_high = value.as_float();
-      return true;
-    }
-    case 23: {
-      this->target_humidity = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_mode);
-  buffer.encode_enum<enums::ClimateMode>(3, this->mode);
-  buffer.encode_bool(4, this->has_target_temperature);
-  buffer.encode_float(5, this->target_temperature);
-  buffer.encode_bool(6, this->has_target_temperature_low);
-  buffer.encode_float(7, this->target_temperature_low);
-  buffer.encode_bool(8, this->has_target_temperature_high);
-  buffer.encode_float(9, this->target_temperature_high);
-  buffer.encode_bool(10, this->unused_has_legacy_away);
-  buffer.encode_bool(11, this->unused_legacy_away);
-  buffer.encode_bool(12, this->has_fan_mode);
-  buffer.encode_enum<enums::ClimateFanMode>(13, this->fan_mode);
-  buffer.encode_bool(14, this->has_swing_mode);
-  buffer.encode_enum<enums::ClimateSwingMode>(15, this->swing_mode);
-  buffer.encode_bool(16, this->has_custom_fan_mode);
-  buffer.encode_string(17, this->custom_fan_mode);
-  buffer.encode_bool(18, this->has_preset);
-  buffer.encode_enum<enums::ClimatePreset>(19, this->preset);
-  buffer.encode_bool(20, this->has_custom_preset);
-  buffer.encode_string(21, this->custom_preset);
-  buffer.encode_bool(22, this->has_target_humidity);
-  buffer.encode_float(23, this->target_humidity);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ClimateCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ClimateCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_mode: ");
-  out.append(YESNO(this->has_mode));
-  out.append("\n");
-
-  out.append("  mode: ");
-  out.append(proto_enum_to_string<enums::ClimateMode>(this->mode));
-  out.append("\n");
-
-  out.append("  has_target_temperature: ");
-  out.append(YESNO(this->has_target_temperature));
-  out.append("\n");
-
-  out.append("  target_temperature: ");
-  sprintf(buffer, "%g", this->target_temperature);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_target_temperature_low: ");
-  out.append(YESNO(this->has_target_temperature_low));
-  out.append("\n");
-
-  out.append("  target_temperature_low: ");
-  sprintf(buffer, "%g", this->target_temperature_low);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_target_temperature_high: ");
-  out.append(YESNO(this->has_target_temperature_high));
-  out.append("\n");
-
-  out.append("  target_temperature_high: ");
-  sprintf(buffer, "%g", this->target_temperature_high);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  unused_has_legacy_away: ");
-  out.append(YESNO(this->unused_has_legacy_away));
-  out.append("\n");
-
-  out.append("  unused_legacy_away: ");
-  out.append(YESNO(this->unused_legacy_away));
-  out.append("\n");
-
-  out.append("  has_fan_mode: ");
-  out.append(YESNO(this->has_fan_mode));
-  out.append("\n");
-
-  out.append("  fan_mode: ");
-  out.append(proto_enum_to_string<enums::ClimateFanMode>(this->fan_mode));
-  out.append("\n");
-
-  out.append("  has_swing_mode: ");
-  out.append(YESNO(this->has_swing_mode));
-  out.append("\n");
-
-  out.append("  swing_mode: ");
-  out.append(proto_enum_to_string<enums::ClimateSwingMode>(this->swing_mode));
-  out.append("\n");
-
-  out.append("  has_custom_fan_mode: ");
-  out.append(YESNO(this->has_custom_fan_mode));
-  out.append("\n");
-
-  out.append("  custom_fan_mode: ");
-  out.append("'").append(this->custom_fan_mode).append("'");
-  out.append("\n");
-
-  out.append("  has_preset: ");
-  out.append(YESNO(this->has_preset));
-  out.append("\n");
-
-  out.append("  preset: ");
-  out.append(proto_enum_to_string<enums::ClimatePreset>(this->preset));
-  out.append("\n");
-
-  out.append("  has_custom_preset: ");
-  out.append(YESNO(this->has_custom_preset));
-  out.append("\n");
-
-  out.append("  custom_preset: ");
-  out.append("'").append(this->custom_preset).append("'");
-  out.append("\n");
-
-  out.append("  has_target_humidity: ");
-  out.append(YESNO(this->has_target_humidity));
-  out.append("\n");
-
-  out.append("  target_humidity: ");
-  sprintf(buffer, "%g", this->target_humidity);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesNumberResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 9: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 12: {
-      this->mode = value.as_enum<enums::NumberMode>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesNumberResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 11: {
-      this->unit_of_measurement = value.as_string();
-      return true;
-    }
-    case 13: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesNumberResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 6: {
-      this->min_value = value.as_float();
-      return true;
-    }
-    case 7: {
-      this->max_value = value.as_float();
-      return true;
-    }
-    case 8: {
-      this->step = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesNumberResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_float(6, this->min_value);
-  buffer.encode_float(7, this->max_value);
-  buffer.encode_float(8, this->step);
-  buffer.encode_bool(9, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(10, this->entity_category);
-  buffer.encode_string(11, this->unit_of_measurement);
-  buffer.encode_enum<enums::NumberMode>(12, this->mode);
-  buffer.encode_string(13, this->device_class);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesNumberResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesNumberResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  min_value: ");
-  sprintf(buffer, "%g", this->min_value);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  max_value: ");
-  sprintf(buffer, "%g", this->max_value);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  step: ");
-  sprintf(buffer, "%g", this->step);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  unit_of_measurement: ");
-  out.append("'").append(this->unit_of_measurement).append("'");
-  out.append("\n");
-
-  out.append("  mode: ");
-  out.append(proto_enum_to_string<enums::NumberMode>(this->mode));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool NumberStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool NumberStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 2: {
-      this->state = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void NumberStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("NumberStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  sprintf(buffer, "%g", this->state);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool NumberCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 2: {
-      this->state = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void NumberCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void NumberCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("NumberCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  sprintf(buffer, "%g", this->state);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesSelectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 7: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSelectResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 6: {
-      this->options.push_back(value.as_string());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesSelectResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  for (auto &it : this->options) {
-    buffer.encode_string(6, it, true);
-  }
-  buffer.encode_bool(7, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesSelectResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesSelectResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  for (const auto &it : this->options) {
-    out.append("  options: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SelectStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SelectStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SelectStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SelectStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SelectStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SelectStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SelectCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool SelectCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SelectCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SelectCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SelectCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesLockResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 8: {
-      this->assumed_state = value.as_bool();
-      return true;
-    }
-    case 9: {
-      this->supports_open = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->requires_code = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesLockResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 11: {
-      this->code_format = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesLockResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesLockResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_bool(8, this->assumed_state);
-  buffer.encode_bool(9, this->supports_open);
-  buffer.encode_bool(10, this->requires_code);
-  buffer.encode_string(11, this->code_format);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesLockResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesLockResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  assumed_state: ");
-  out.append(YESNO(this->assumed_state));
-  out.append("\n");
-
-  out.append("  supports_open: ");
-  out.append(YESNO(this->supports_open));
-  out.append("\n");
-
-  out.append("  requires_code: ");
-  out.append(YESNO(this->requires_code));
-  out.append("\n");
-
-  out.append("  code_format: ");
-  out.append("'").append(this->code_format).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool LockStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_enum<enums::LockState>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LockStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void LockStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::LockState>(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void LockStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("LockStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(proto_enum_to_string<enums::LockState>(this->state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool LockCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->command = value.as_enum<enums::LockCommand>();
-      return true;
-    }
-    case 3: {
-      this->has_code = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LockCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 4: {
-      this->code = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool LockCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void LockCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::LockCommand>(2, this->command);
-  buffer.encode_bool(3, this->has_code);
-  buffer.encode_string(4, this->code);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void LockCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("LockCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  command: ");
-  out.append(proto_enum_to_string<enums::LockCommand>(this->command));
-  out.append("\n");
-
-  out.append("  has_code: ");
-  out.append(YESNO(this->has_code));
-  out.append("\n");
-
-  out.append("  code: ");
-  out.append("'").append(this->code).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesButtonResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesButtonResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesButtonResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesButtonResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_string(8, this->device_class);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesButtonResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesButtonResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ButtonCommandRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->key); }
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ButtonCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ButtonCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesMediaPlayerResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 8: {
-      this->supports_pause = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesMediaPlayerResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesMediaPlayerResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_bool(8, this->supports_pause);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesMediaPlayerResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesMediaPlayerResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  supports_pause: ");
-  out.append(YESNO(this->supports_pause));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool MediaPlayerStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_enum<enums::MediaPlayerState>();
-      return true;
-    }
-    case 4: {
-      this->muted = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool MediaPlayerStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->volume = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void MediaPlayerStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::MediaPlayerState>(2, this->state);
-  buffer.encode_float(3, this->volume);
-  buffer.encode_bool(4, this->muted);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void MediaPlayerStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("MediaPlayerStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(proto_enum_to_string<enums::MediaPlayerState>(this->state));
-  out.append("\n");
-
-  out.append("  volume: ");
-  sprintf(buffer, "%g", this->volume);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  muted: ");
-  out.append(YESNO(this->muted));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool MediaPlayerCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_command = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->command = value.as_enum<enums::MediaPlayerCommand>();
-      return true;
-    }
-    case 4: {
-      this->has_volume = value.as_bool();
-      return true;
-    }
-    case 6: {
-      this->has_media_url = value.as_bool();
-      return true;
-    }
-    case 8: {
-      this->has_announcement = value.as_bool();
-      return true;
-    }
-    case 9: {
-      this->announcement = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool MediaPlayerCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 7: {
-      this->media_url = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool MediaPlayerCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 5: {
-      this->volume = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void MediaPlayerCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_command);
-  buffer.encode_enum<enums::MediaPlayerCommand>(3, this->command);
-  buffer.encode_bool(4, this->has_volume);
-  buffer.encode_float(5, this->volume);
-  buffer.encode_bool(6, this->has_media_url);
-  buffer.encode_string(7, this->media_url);
-  buffer.encode_bool(8, this->has_announcement);
-  buffer.encode_bool(9, this->announcement);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void MediaPlayerCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("MediaPlayerCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_command: ");
-  out.append(YESNO(this->has_command));
-  out.append("\n");
-
-  out.append("  command: ");
-  out.append(proto_enum_to_string<enums::MediaPlayerCommand>(this->command));
-  out.append("\n");
-
-  out.append("  has_volume: ");
-  out.append(YESNO(this->has_volume));
-  out.append("\n");
-
-  out.append("  volume: ");
-  sprintf(buffer, "%g", this->volume);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_media_url: ");
-  out.append(YESNO(this->has_media_url));
-  out.append("\n");
-
-  out.append("  media_url: ");
-  out.append("'").append(this->media_url).append("'");
-  out.append("\n");
-
-  out.append("  has_announcement: ");
-  out.append(YESNO(this->has_announcement));
-  out.append("\n");
-
-  out.append("  announcement: ");
-  out.append(YESNO(this->announcement));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SubscribeBluetoothLEAdvertisementsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->flags = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint32(1, this->flags);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeBluetoothLEAdvertisementsRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SubscribeBluetoothLEAdvertisementsRequest {\n");
-  out.append("  flags: ");
-  sprintf(buffer, "%" PRIu32, this->flags);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothServiceData::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->legacy_data.push_back(value.as_uint32());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothServiceData::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->uuid = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothServiceData::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->uuid);
-  for (auto &it : this->legacy_data) {
-    buffer.encode_uint32(2, it, true);
-  }
-  buffer.encode_string(3, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothServiceData::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothServiceData {\n");
-  out.append("  uuid: ");
-  out.append("'").append(this->uuid).append("'");
-  out.append("\n");
-
-  for (const auto &it : this->legacy_data) {
-    out.append("  legacy_data: ");
-    sprintf(buffer, "%" PRIu32, it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothLEAdvertisementResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 3: {
-      this->rssi = value.as_sint32();
-      return true;
-    }
-    case 7: {
-      this->address_type = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothLEAdvertisementResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->service_uuids.push_back(value.as_string());
-      return true;
-    }
-    case 5: {
-      this->service_data.push_back(value.as_message<BluetoothServiceData>());
-      return true;
-    }
-    case 6: {
-      this->manufacturer_data.push_back(value.as_message<BluetoothServiceData>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothLEAdvertisementResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_string(2, this->name);
-  buffer.encode_sint32(3, this->rssi);
-  for (auto &it : this->service_uuids) {
-    buffer.encode_string(4, it, true);
-  }
-  for (auto &it : this->service_data) {
-    buffer.encode_message<BluetoothServiceData>(5, it, true);
-  }
-  for (auto &it : this->manufacturer_data) {
-    buffer.encode_message<BluetoothServiceData>(6, it, true);
-  }
-  buffer.encode_uint32(7, this->address_type);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothLEAdvertisementResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothLEAdvertisementResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  rssi: ");
-  sprintf(buffer, "%" PRId32, this->rssi);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->service_uuids) {
-    out.append("  service_uuids: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-
-  for (const auto &it : this->service_data) {
-    out.append("  service_data: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-
-  for (const auto &it : this->manufacturer_data) {
-    out.append("  manufacturer_data: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-
-  out.append("  address_type: ");
-  sprintf(buffer, "%" PRIu32, this->address_type);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothLERawAdvertisement::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->rssi = value.as_sint32();
-      return true;
-    }
-    case 3: {
-      this->address_type = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothLERawAdvertisement::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 4: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_sint32(2, this->rssi);
-  buffer.encode_uint32(3, this->address_type);
-  buffer.encode_string(4, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothLERawAdvertisement::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothLERawAdvertisement {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  rssi: ");
-  sprintf(buffer, "%" PRId32, this->rssi);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  address_type: ");
-  sprintf(buffer, "%" PRIu32, this->address_type);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothLERawAdvertisementsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->advertisements.push_back(value.as_message<BluetoothLERawAdvertisement>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer buffer) const {
-  for (auto &it : this->advertisements) {
-    buffer.encode_message<BluetoothLERawAdvertisement>(1, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothLERawAdvertisementsResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothLERawAdvertisementsResponse {\n");
-  for (const auto &it : this->advertisements) {
-    out.append("  advertisements: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool BluetoothDeviceRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->request_type = value.as_enum<enums::BluetoothDeviceRequestType>();
-      return true;
-    }
-    case 3: {
-      this->has_address_type = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->address_type = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothDeviceRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_enum<enums::BluetoothDeviceRequestType>(2, this->request_type);
-  buffer.encode_bool(3, this->has_address_type);
-  buffer.encode_uint32(4, this->address_type);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothDeviceRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothDeviceRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  request_type: ");
-  out.append(proto_enum_to_string<enums::BluetoothDeviceRequestType>(this->request_type));
-  out.append("\n");
-
-  out.append("  has_address_type: ");
-  out.append(YESNO(this->has_address_type));
-  out.append("\n");
-
-  out.append("  address_type: ");
-  sprintf(buffer, "%" PRIu32, this->address_type);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothDeviceConnectionResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->connected = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->mtu = value.as_uint32();
-      return true;
-    }
-    case 4: {
-      this->error = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothDeviceConnectionResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_bool(2, this->connected);
-  buffer.encode_uint32(3, this->mtu);
-  buffer.encode_int32(4, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothDeviceConnectionResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothDeviceConnectionResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  connected: ");
-  out.append(YESNO(this->connected));
-  out.append("\n");
-
-  out.append("  mtu: ");
-  sprintf(buffer, "%" PRIu32, this->mtu);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  error: ");
-  sprintf(buffer, "%" PRId32, this->error);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTGetServicesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTGetServicesRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_uint64(1, this->address); }
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTGetServicesRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTGetServicesRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTDescriptor::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->uuid.push_back(value.as_uint64());
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTDescriptor::encode(ProtoWriteBuffer buffer) const {
-  for (auto &it : this->uuid) {
-    buffer.encode_uint64(1, it, true);
-  }
-  buffer.encode_uint32(2, this->handle);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTDescriptor::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTDescriptor {\n");
-  for (const auto &it : this->uuid) {
-    out.append("  uuid: ");
-    sprintf(buffer, "%llu", it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTCharacteristic::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->uuid.push_back(value.as_uint64());
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->properties = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTCharacteristic::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 4: {
-      this->descriptors.push_back(value.as_message<BluetoothGATTDescriptor>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTCharacteristic::encode(ProtoWriteBuffer buffer) const {
-  for (auto &it : this->uuid) {
-    buffer.encode_uint64(1, it, true);
-  }
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_uint32(3, this->properties);
-  for (auto &it : this->descriptors) {
-    buffer.encode_message<BluetoothGATTDescriptor>(4, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTCharacteristic::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTCharacteristic {\n");
-  for (const auto &it : this->uuid) {
-    out.append("  uuid: ");
-    sprintf(buffer, "%llu", it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  properties: ");
-  sprintf(buffer, "%" PRIu32, this->properties);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->descriptors) {
-    out.append("  descriptors: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool BluetoothGATTService::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->uuid.push_back(value.as_uint64());
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTService::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->characteristics.push_back(value.as_message<BluetoothGATTCharacteristic>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTService::encode(ProtoWriteBuffer buffer) const {
-  for (auto &it : this->uuid) {
-    buffer.encode_uint64(1, it, true);
-  }
-  buffer.encode_uint32(2, this->handle);
-  for (auto &it : this->characteristics) {
-    buffer.encode_message<BluetoothGATTCharacteristic>(3, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTService::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTService {\n");
-  for (const auto &it : this->uuid) {
-    out.append("  uuid: ");
-    sprintf(buffer, "%llu", it);
-    out.append(buffer);
-    out.append("\n");
-  }
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->characteristics) {
-    out.append("  characteristics: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool BluetoothGATTGetServicesResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTGetServicesResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->services.push_back(value.as_message<BluetoothGATTService>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTGetServicesResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  for (auto &it : this->services) {
-    buffer.encode_message<BluetoothGATTService>(2, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTGetServicesResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTGetServicesResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  for (const auto &it : this->services) {
-    out.append("  services: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool BluetoothGATTGetServicesDoneResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTGetServicesDoneResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTGetServicesDoneResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTGetServicesDoneResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTReadRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTReadRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTReadRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTReadRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTReadResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTReadResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTReadResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_string(3, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTReadResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTReadResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTWriteRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->response = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTWriteRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 4: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTWriteRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_bool(3, this->response);
-  buffer.encode_string(4, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTWriteRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTWriteRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  response: ");
-  out.append(YESNO(this->response));
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTReadDescriptorRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTReadDescriptorRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTReadDescriptorRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTReadDescriptorRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTWriteDescriptorRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTWriteDescriptorRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTWriteDescriptorRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_string(3, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTWriteDescriptorRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTWriteDescriptorRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTNotifyRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->enable = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTNotifyRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_bool(3, this->enable);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTNotifyRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTNotifyRequest {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  enable: ");
-  out.append(YESNO(this->enable));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTNotifyDataResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool BluetoothGATTNotifyDataResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTNotifyDataResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_string(3, this->data);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTNotifyDataResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTNotifyDataResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void SubscribeBluetoothConnectionsFreeRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeBluetoothConnectionsFreeRequest::dump_to(std::string &out) const {
-  out.append("SubscribeBluetoothConnectionsFreeRequest {}");
-}
-#endif
-bool BluetoothConnectionsFreeResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->free = value.as_uint32();
-      return true;
-    }
-    case 2: {
-      this->limit = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothConnectionsFreeResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint32(1, this->free);
-  buffer.encode_uint32(2, this->limit);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothConnectionsFreeResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothConnectionsFreeResponse {\n");
-  out.append("  free: ");
-  sprintf(buffer, "%" PRIu32, this->free);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  limit: ");
-  sprintf(buffer, "%" PRIu32, this->limit);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTErrorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->error = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTErrorResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-  buffer.encode_int32(3, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTErrorResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTErrorResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  error: ");
-  sprintf(buffer, "%" PRId32, this->error);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTWriteResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTWriteResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTWriteResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTWriteResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothGATTNotifyResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->handle = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothGATTNotifyResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_uint32(2, this->handle);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothGATTNotifyResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothGATTNotifyResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  handle: ");
-  sprintf(buffer, "%" PRIu32, this->handle);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothDevicePairingResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->paired = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->error = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothDevicePairingResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_bool(2, this->paired);
-  buffer.encode_int32(3, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothDevicePairingResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothDevicePairingResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  paired: ");
-  out.append(YESNO(this->paired));
-  out.append("\n");
-
-  out.append("  error: ");
-  sprintf(buffer, "%" PRId32, this->error);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool BluetoothDeviceUnpairingResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->success = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->error = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothDeviceUnpairingResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_bool(2, this->success);
-  buffer.encode_int32(3, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothDeviceUnpairingResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothDeviceUnpairingResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  success: ");
-  out.append(YESNO(this->success));
-  out.append("\n");
-
-  out.append("  error: ");
-  sprintf(buffer, "%" PRId32, this->error);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-void UnsubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void UnsubscribeBluetoothLEAdvertisementsRequest::dump_to(std::string &out) const {
-  out.append("UnsubscribeBluetoothLEAdvertisementsRequest {}");
-}
-#endif
-bool BluetoothDeviceClearCacheResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->address = value.as_uint64();
-      return true;
-    }
-    case 2: {
-      this->success = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->error = value.as_int32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void BluetoothDeviceClearCacheResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_bool(2, this->success);
-  buffer.encode_int32(3, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void BluetoothDeviceClearCacheResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("BluetoothDeviceClearCacheResponse {\n");
-  out.append("  address: ");
-  sprintf(buffer, "%llu", this->address);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  success: ");
-  out.append(YESNO(this->success));
-  out.append("\n");
-
-  out.append("  error: ");
-  sprintf(buffer, "%" PRId32, this->error);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool SubscribeVoiceAssistantRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->subscribe = value.as_bool();
-      return true;
-    }
-    case 2: {
-      this->flags = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void SubscribeVoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bool(1, this->subscribe);
-  buffer.encode_uint32(2, this->flags);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeVoiceAssistantRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("SubscribeVoiceAssistantRequest {\n");
-  out.append("  subscribe: ");
-  out.append(YESNO(this->subscribe));
-  out.append("\n");
-
-  out.append("  flags: ");
-  sprintf(buffer, "%" PRIu32, this->flags);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantAudioSettings::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->noise_suppression_level = value.as_uint32();
-      return true;
-    }
-    case 2: {
-      this->auto_gain = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool VoiceAssistantAudioSettings::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 3: {
-      this->volume_multiplier = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantAudioSettings::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint32(1, this->noise_suppression_level);
-  buffer.encode_uint32(2, this->auto_gain);
-  buffer.encode_float(3, this->volume_multiplier);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantAudioSettings::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantAudioSettings {\n");
-  out.append("  noise_suppression_level: ");
-  sprintf(buffer, "%" PRIu32, this->noise_suppression_level);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  auto_gain: ");
-  sprintf(buffer, "%" PRIu32, this->auto_gain);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  volume_multiplier: ");
-  sprintf(buffer, "%g", this->volume_multiplier);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->start = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->flags = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool VoiceAssistantRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->conversation_id = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->audio_settings = value.as_message<VoiceAssistantAudioSettings>();
-      return true;
-    }
-    case 5: {
-      this->wake_word_phrase = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bool(1, this->start);
-  buffer.encode_string(2, this->conversation_id);
-  buffer.encode_uint32(3, this->flags);
-  buffer.encode_message<VoiceAssistantAudioSettings>(4, this->audio_settings);
-  buffer.encode_string(5, this->wake_word_phrase);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantRequest {\n");
-  out.append("  start: ");
-  out.append(YESNO(this->start));
-  out.append("\n");
-
-  out.append("  conversation_id: ");
-  out.append("'").append(this->conversation_id).append("'");
-  out.append("\n");
-
-  out.append("  flags: ");
-  sprintf(buffer, "%" PRIu32, this->flags);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  audio_settings: ");
-  this->audio_settings.dump_to(out);
-  out.append("\n");
-
-  out.append("  wake_word_phrase: ");
-  out.append("'").append(this->wake_word_phrase).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->port = value.as_uint32();
-      return true;
-    }
-    case 2: {
-      this->error = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint32(1, this->port);
-  buffer.encode_bool(2, this->error);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantResponse {\n");
-  out.append("  port: ");
-  sprintf(buffer, "%" PRIu32, this->port);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  error: ");
-  out.append(YESNO(this->error));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantEventData::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 2: {
-      this->value = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantEventData::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->name);
-  buffer.encode_string(2, this->value);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantEventData::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantEventData {\n");
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  value: ");
-  out.append("'").append(this->value).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantEventResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->event_type = value.as_enum<enums::VoiceAssistantEvent>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool VoiceAssistantEventResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->data.push_back(value.as_message<VoiceAssistantEventData>());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantEventResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_enum<enums::VoiceAssistantEvent>(1, this->event_type);
-  for (auto &it : this->data) {
-    buffer.encode_message<VoiceAssistantEventData>(2, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantEventResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantEventResponse {\n");
-  out.append("  event_type: ");
-  out.append(proto_enum_to_string<enums::VoiceAssistantEvent>(this->event_type));
-  out.append("\n");
-
-  for (const auto &it : this->data) {
-    out.append("  data: ");
-    it.dump_to(out);
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool VoiceAssistantAudio::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->end = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool VoiceAssistantAudio::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->data = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantAudio::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->data);
-  buffer.encode_bool(2, this->end);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantAudio::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantAudio {\n");
-  out.append("  data: ");
-  out.append("'").append(this->data).append("'");
-  out.append("\n");
-
-  out.append("  end: ");
-  out.append(YESNO(this->end));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool VoiceAssistantTimerEventResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 1: {
-      this->event_type = value.as_enum<enums::VoiceAssistantTimerEvent>();
-      return true;
-    }
-    case 4: {
-      this->total_seconds = value.as_uint32();
-      return true;
-    }
-    case 5: {
-      this->seconds_left = value.as_uint32();
-      return true;
-    }
-    case 6: {
-      this->is_active = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool VoiceAssistantTimerEventResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->timer_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void VoiceAssistantTimerEventResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_enum<enums::VoiceAssistantTimerEvent>(1, this->event_type);
-  buffer.encode_string(2, this->timer_id);
-  buffer.encode_string(3, this->name);
-  buffer.encode_uint32(4, this->total_seconds);
-  buffer.encode_uint32(5, this->seconds_left);
-  buffer.encode_bool(6, this->is_active);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void VoiceAssistantTimerEventResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("VoiceAssistantTimerEventResponse {\n");
-  out.append("  event_type: ");
-  out.append(proto_enum_to_string<enums::VoiceAssistantTimerEvent>(this->event_type));
-  out.append("\n");
-
-  out.append("  timer_id: ");
-  out.append("'").append(this->timer_id).append("'");
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  total_seconds: ");
-  sprintf(buffer, "%" PRIu32, this->total_seconds);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  seconds_left: ");
-  sprintf(buffer, "%" PRIu32, this->seconds_left);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  is_active: ");
-  out.append(YESNO(this->is_active));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesAlarmControlPanelResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 8: {
-      this->supported_features = value.as_uint32();
-      return true;
-    }
-    case 9: {
-      this->requires_code = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->requires_code_to_arm = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesAlarmControlPanelResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesAlarmControlPanelResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesAlarmControlPanelResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_uint32(8, this->supported_features);
-  buffer.encode_bool(9, this->requires_code);
-  buffer.encode_bool(10, this->requires_code_to_arm);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesAlarmControlPanelResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesAlarmControlPanelResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  supported_features: ");
-  sprintf(buffer, "%" PRIu32, this->supported_features);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  requires_code: ");
-  out.append(YESNO(this->requires_code));
-  out.append("\n");
-
-  out.append("  requires_code_to_arm: ");
-  out.append(YESNO(this->requires_code_to_arm));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool AlarmControlPanelStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_enum<enums::AlarmControlPanelState>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool AlarmControlPanelStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void AlarmControlPanelStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::AlarmControlPanelState>(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void AlarmControlPanelStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("AlarmControlPanelStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append(proto_enum_to_string<enums::AlarmControlPanelState>(this->state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool AlarmControlPanelCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->command = value.as_enum<enums::AlarmControlPanelStateCommand>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool AlarmControlPanelCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 3: {
-      this->code = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool AlarmControlPanelCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void AlarmControlPanelCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_enum<enums::AlarmControlPanelStateCommand>(2, this->command);
-  buffer.encode_string(3, this->code);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void AlarmControlPanelCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("AlarmControlPanelCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  command: ");
-  out.append(proto_enum_to_string<enums::AlarmControlPanelStateCommand>(this->command));
-  out.append("\n");
-
-  out.append("  code: ");
-  out.append("'").append(this->code).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesTextResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 8: {
-      this->min_length = value.as_uint32();
-      return true;
-    }
-    case 9: {
-      this->max_length = value.as_uint32();
-      return true;
-    }
-    case 11: {
-      this->mode = value.as_enum<enums::TextMode>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTextResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 10: {
-      this->pattern = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTextResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesTextResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_uint32(8, this->min_length);
-  buffer.encode_uint32(9, this->max_length);
-  buffer.encode_string(10, this->pattern);
-  buffer.encode_enum<enums::TextMode>(11, this->mode);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesTextResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesTextResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  min_length: ");
-  sprintf(buffer, "%" PRIu32, this->min_length);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  max_length: ");
-  sprintf(buffer, "%" PRIu32, this->max_length);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  pattern: ");
-  out.append("'").append(this->pattern).append("'");
-  out.append("\n");
-
-  out.append("  mode: ");
-  out.append(proto_enum_to_string<enums::TextMode>(this->mode));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool TextStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TextStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TextStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void TextStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void TextStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("TextStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool TextCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->state = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TextCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void TextCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->state);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void TextCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("TextCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  state: ");
-  out.append("'").append(this->state).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesDateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesDateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesDateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesDateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesDateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesDateResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool DateStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->year = value.as_uint32();
-      return true;
-    }
-    case 4: {
-      this->month = value.as_uint32();
-      return true;
-    }
-    case 5: {
-      this->day = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool DateStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void DateStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->missing_state);
-  buffer.encode_uint32(3, this->year);
-  buffer.encode_uint32(4, this->month);
-  buffer.encode_uint32(5, this->day);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DateStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("DateStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-
-  out.append("  year: ");
-  sprintf(buffer, "%" PRIu32, this->year);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  month: ");
-  sprintf(buffer, "%" PRIu32, this->month);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  day: ");
-  sprintf(buffer, "%" PRIu32, this->day);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool DateCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->year = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->month = value.as_uint32();
-      return true;
-    }
-    case 4: {
-      this->day = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool DateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void DateCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_uint32(2, this->year);
-  buffer.encode_uint32(3, this->month);
-  buffer.encode_uint32(4, this->day);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DateCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("DateCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  year: ");
-  sprintf(buffer, "%" PRIu32, this->year);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  month: ");
-  sprintf(buffer, "%" PRIu32, this->month);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  day: ");
-  sprintf(buffer, "%" PRIu32, this->day);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesTimeResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTimeResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesTimeResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesTimeResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesTimeResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool TimeStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->hour = value.as_uint32();
-      return true;
-    }
-    case 4: {
-      this->minute = value.as_uint32();
-      return true;
-    }
-    case 5: {
-      this->second = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TimeStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void TimeStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->missing_state);
-  buffer.encode_uint32(3, this->hour);
-  buffer.encode_uint32(4, this->minute);
-  buffer.encode_uint32(5, this->second);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void TimeStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("TimeStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-
-  out.append("  hour: ");
-  sprintf(buffer, "%" PRIu32, this->hour);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  minute: ");
-  sprintf(buffer, "%" PRIu32, this->minute);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  second: ");
-  sprintf(buffer, "%" PRIu32, this->second);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool TimeCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->hour = value.as_uint32();
-      return true;
-    }
-    case 3: {
-      this->minute = value.as_uint32();
-      return true;
-    }
-    case 4: {
-      this->second = value.as_uint32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool TimeCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void TimeCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_uint32(2, this->hour);
-  buffer.encode_uint32(3, this->minute);
-  buffer.encode_uint32(4, this->second);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void TimeCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("TimeCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  hour: ");
-  sprintf(buffer, "%" PRIu32, this->hour);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  minute: ");
-  sprintf(buffer, "%" PRIu32, this->minute);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  second: ");
-  sprintf(buffer, "%" PRIu32, this->second);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesEventResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesEventResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->event_types.push_back(value.as_string());
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesEventResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesEventResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_string(8, this->device_class);
-  for (auto &it : this->event_types) {
-    buffer.encode_string(9, it, true);
-  }
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesEventResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesEventResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-
-  for (const auto &it : this->event_types) {
-    out.append("  event_types: ");
-    out.append("'").append(it).append("'");
-    out.append("\n");
-  }
-  out.append("}");
-}
-#endif
-bool EventResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 2: {
-      this->event_type = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool EventResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void EventResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_string(2, this->event_type);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void EventResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("EventResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  event_type: ");
-  out.append("'").append(this->event_type).append("'");
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesValveResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    case 9: {
-      this->assumed_state = value.as_bool();
-      return true;
-    }
-    case 10: {
-      this->supports_position = value.as_bool();
-      return true;
-    }
-    case 11: {
-      this->supports_stop = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesValveResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesValveResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesValveResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_string(8, this->device_class);
-  buffer.encode_bool(9, this->assumed_state);
-  buffer.encode_bool(10, this->supports_position);
-  buffer.encode_bool(11, this->supports_stop);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesValveResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesValveResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-
-  out.append("  assumed_state: ");
-  out.append(YESNO(this->assumed_state));
-  out.append("\n");
-
-  out.append("  supports_position: ");
-  out.append(YESNO(this->supports_position));
-  out.append("\n");
-
-  out.append("  supports_stop: ");
-  out.append(YESNO(this->supports_stop));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ValveStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 3: {
-      this->current_operation = value.as_enum<enums::ValveOperation>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ValveStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 2: {
-      this->position = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ValveStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->position);
-  buffer.encode_enum<enums::ValveOperation>(3, this->current_operation);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ValveStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ValveStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  position: ");
-  sprintf(buffer, "%g", this->position);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  current_operation: ");
-  out.append(proto_enum_to_string<enums::ValveOperation>(this->current_operation));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ValveCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->has_position = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->stop = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ValveCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->position = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ValveCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->has_position);
-  buffer.encode_float(3, this->position);
-  buffer.encode_bool(4, this->stop);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void ValveCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ValveCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  has_position: ");
-  out.append(YESNO(this->has_position));
-  out.append("\n");
-
-  out.append("  position: ");
-  sprintf(buffer, "%g", this->position);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  stop: ");
-  out.append(YESNO(this->stop));
-  out.append("\n");
-  out.append("}");
-}
-#endif
-bool ListEntitiesDateTimeResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesDateTimeResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesDateTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesDateTimeResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-}
+static constexpr uint32_t HELLO_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(HelloRequest, client_info), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(HelloRequest, api_version_major), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(HelloRequest, api_version_minor), 3, ProtoFieldType::UINT32),
+};
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesDateTimeResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesDateTimeResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-  out.append("}");
-}
+static const ProtoFieldDump HELLO_REQUEST_DUMP[] PROGMEM = {
+    {"client_info", nullptr},
+    {"api_version_major", nullptr},
+    {"api_version_minor", nullptr},
+};
 #endif
-bool DateTimeStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool DateTimeStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 3: {
-      this->epoch_seconds = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void DateTimeStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->missing_state);
-  buffer.encode_fixed32(3, this->epoch_seconds);
-}
+const ProtoMessageDescriptor HelloRequest::DESCRIPTOR PROGMEM = {
+    HELLO_REQUEST_FIELDS, nullptr, 3,
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void DateTimeStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("DateTimeStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-
-  out.append("  epoch_seconds: ");
-  sprintf(buffer, "%" PRIu32, this->epoch_seconds);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
+    "HelloRequest", HELLO_REQUEST_DUMP,
 #endif
-bool DateTimeCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 2: {
-      this->epoch_seconds = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void DateTimeCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_fixed32(2, this->epoch_seconds);
-}
-#ifdef HAS_PROTO_MESSAGE_DUMP
-void DateTimeCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("DateTimeCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  epoch_seconds: ");
-  sprintf(buffer, "%" PRIu32, this->epoch_seconds);
-  out.append(buffer);
-  out.append("\n");
-  out.append("}");
-}
+};
+static constexpr uint32_t HELLO_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(HelloResponse, api_version_major), 1, ProtoFieldType::UINT32),
+    proto_field(offsetof(HelloResponse, api_version_minor), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(HelloResponse, server_info), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(HelloResponse, name), 4, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump HELLO_RESPONSE_DUMP[] PROGMEM = {
+    {"api_version_major", nullptr},
+    {"api_version_minor", nullptr},
+    {"server_info", nullptr},
+    {"name", nullptr},
+};
+#endif
+const ProtoMessageDescriptor HelloResponse::DESCRIPTOR PROGMEM = {
+    HELLO_RESPONSE_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "HelloResponse", HELLO_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t CONNECT_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ConnectRequest, password), 1, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CONNECT_REQUEST_DUMP[] PROGMEM = {{"password", nullptr}};
+#endif
+const ProtoMessageDescriptor ConnectRequest::DESCRIPTOR PROGMEM = {
+    CONNECT_REQUEST_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ConnectRequest", CONNECT_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t CONNECT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ConnectResponse, invalid_password), 1, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CONNECT_RESPONSE_DUMP[] PROGMEM = {{"invalid_password", nullptr}};
 #endif
-bool ListEntitiesUpdateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 6: {
-      this->disabled_by_default = value.as_bool();
-      return true;
-    }
-    case 7: {
-      this->entity_category = value.as_enum<enums::EntityCategory>();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesUpdateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 1: {
-      this->object_id = value.as_string();
-      return true;
-    }
-    case 3: {
-      this->name = value.as_string();
-      return true;
-    }
-    case 4: {
-      this->unique_id = value.as_string();
-      return true;
-    }
-    case 5: {
-      this->icon = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->device_class = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool ListEntitiesUpdateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 2: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void ListEntitiesUpdateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_string(1, this->object_id);
-  buffer.encode_fixed32(2, this->key);
-  buffer.encode_string(3, this->name);
-  buffer.encode_string(4, this->unique_id);
-  buffer.encode_string(5, this->icon);
-  buffer.encode_bool(6, this->disabled_by_default);
-  buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
-  buffer.encode_string(8, this->device_class);
-}
+const ProtoMessageDescriptor ConnectResponse::DESCRIPTOR PROGMEM = {
+    CONNECT_RESPONSE_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ConnectResponse", CONNECT_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor DisconnectRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DisconnectRequest", nullptr,
+#endif
+};
+const ProtoMessageDescriptor DisconnectResponse::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DisconnectResponse", nullptr,
+#endif
+};
+const ProtoMessageDescriptor PingRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "PingRequest", nullptr,
+#endif
+};
+const ProtoMessageDescriptor PingResponse::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "PingResponse", nullptr,
+#endif
+};
+const ProtoMessageDescriptor DeviceInfoRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DeviceInfoRequest", nullptr,
+#endif
+};
+static constexpr uint32_t DEVICE_INFO_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(DeviceInfoResponse, uses_password), 1, ProtoFieldType::BOOL),
+    proto_field(offsetof(DeviceInfoResponse, name), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, mac_address), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, esphome_version), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, compilation_time), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, model), 6, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, has_deep_sleep), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(DeviceInfoResponse, project_name), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, project_version), 9, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, webserver_port), 10, ProtoFieldType::UINT32),
+    proto_field(offsetof(DeviceInfoResponse, legacy_bluetooth_proxy_version), 11, ProtoFieldType::UINT32),
+    proto_field(offsetof(DeviceInfoResponse, bluetooth_proxy_feature_flags), 15, ProtoFieldType::UINT32),
+    proto_field(offsetof(DeviceInfoResponse, manufacturer), 12, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, friendly_name), 13, ProtoFieldType::STRING),
+    proto_field(offsetof(DeviceInfoResponse, legacy_voice_assistant_version), 14, ProtoFieldType::UINT32),
+    proto_field(offsetof(DeviceInfoResponse, voice_assistant_feature_flags), 17, ProtoFieldType::UINT32),
+    proto_field(offsetof(DeviceInfoResponse, suggested_area), 16, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump DEVICE_INFO_RESPONSE_DUMP[] PROGMEM = {
+    {"uses_password", nullptr},
+    {"name", nullptr},
+    {"mac_address", nullptr},
+    {"esphome_version", nullptr},
+    {"compilation_time", nullptr},
+    {"model", nullptr},
+    {"has_deep_sleep", nullptr},
+    {"project_name", nullptr},
+    {"project_version", nullptr},
+    {"webserver_port", nullptr},
+    {"legacy_bluetooth_proxy_version", nullptr},
+    {"bluetooth_proxy_feature_flags", nullptr},
+    {"manufacturer", nullptr},
+    {"friendly_name", nullptr},
+    {"legacy_voice_assistant_version", nullptr},
+    {"voice_assistant_feature_flags", nullptr},
+    {"suggested_area", nullptr},
+};
+#endif
+const ProtoMessageDescriptor DeviceInfoResponse::DESCRIPTOR PROGMEM = {
+    DEVICE_INFO_RESPONSE_FIELDS, nullptr, 17,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DeviceInfoResponse", DEVICE_INFO_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor ListEntitiesRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesRequest", nullptr,
+#endif
+};
+const ProtoMessageDescriptor ListEntitiesDoneResponse::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesDoneResponse", nullptr,
+#endif
+};
+const ProtoMessageDescriptor SubscribeStatesRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeStatesRequest", nullptr,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_BINARY_SENSOR_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, device_class), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, is_status_binary_sensor), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, disabled_by_default), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, icon), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesBinarySensorResponse, entity_category), 9, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_BINARY_SENSOR_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"device_class", nullptr},
+    {"is_status_binary_sensor", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesBinarySensorResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_BINARY_SENSOR_RESPONSE_FIELDS, nullptr, 9,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesBinarySensorResponse", LIST_ENTITIES_BINARY_SENSOR_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BINARY_SENSOR_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BinarySensorStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(BinarySensorStateResponse, state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(BinarySensorStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BINARY_SENSOR_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BinarySensorStateResponse::DESCRIPTOR PROGMEM = {
+    BINARY_SENSOR_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BinarySensorStateResponse", BINARY_SENSOR_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_COVER_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesCoverResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCoverResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesCoverResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCoverResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCoverResponse, assumed_state), 5, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesCoverResponse, supports_position), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesCoverResponse, supports_tilt), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesCoverResponse, device_class), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCoverResponse, disabled_by_default), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesCoverResponse, icon), 10, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCoverResponse, entity_category), 11, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesCoverResponse, supports_stop), 12, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_COVER_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"assumed_state", nullptr},
+    {"supports_position", nullptr},
+    {"supports_tilt", nullptr},
+    {"device_class", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"supports_stop", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesCoverResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_COVER_RESPONSE_FIELDS, nullptr, 12,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesCoverResponse", LIST_ENTITIES_COVER_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t COVER_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(CoverStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(CoverStateResponse, legacy_state), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(CoverStateResponse, position), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(CoverStateResponse, tilt), 4, ProtoFieldType::FLOAT),
+    proto_field(offsetof(CoverStateResponse, current_operation), 5, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump COVER_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"legacy_state", &proto_enum_name<enums::LegacyCoverState>},
+    {"position", nullptr},
+    {"tilt", nullptr},
+    {"current_operation", &proto_enum_name<enums::CoverOperation>},
+};
+#endif
+const ProtoMessageDescriptor CoverStateResponse::DESCRIPTOR PROGMEM = {
+    COVER_STATE_RESPONSE_FIELDS, nullptr, 5,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "CoverStateResponse", COVER_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t COVER_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(CoverCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(CoverCommandRequest, has_legacy_command), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(CoverCommandRequest, legacy_command), 3, ProtoFieldType::ENUM),
+    proto_field(offsetof(CoverCommandRequest, has_position), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(CoverCommandRequest, position), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(CoverCommandRequest, has_tilt), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(CoverCommandRequest, tilt), 7, ProtoFieldType::FLOAT),
+    proto_field(offsetof(CoverCommandRequest, stop), 8, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump COVER_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_legacy_command", nullptr},
+    {"legacy_command", &proto_enum_name<enums::LegacyCoverCommand>},
+    {"has_position", nullptr},
+    {"position", nullptr},
+    {"has_tilt", nullptr},
+    {"tilt", nullptr},
+    {"stop", nullptr},
+};
+#endif
+const ProtoMessageDescriptor CoverCommandRequest::DESCRIPTOR PROGMEM = {
+    COVER_COMMAND_REQUEST_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "CoverCommandRequest", COVER_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_FAN_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesFanResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesFanResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesFanResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesFanResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesFanResponse, supports_oscillation), 5, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesFanResponse, supports_speed), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesFanResponse, supports_direction), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesFanResponse, supported_speed_count), 8, ProtoFieldType::INT32),
+    proto_field(offsetof(ListEntitiesFanResponse, disabled_by_default), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesFanResponse, icon), 10, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesFanResponse, entity_category), 11, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesFanResponse, supported_preset_modes), 12, ProtoFieldType::STRING, true),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_FAN_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"supports_oscillation", nullptr},
+    {"supports_speed", nullptr},
+    {"supports_direction", nullptr},
+    {"supported_speed_count", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"supported_preset_modes", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesFanResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_FAN_RESPONSE_FIELDS, nullptr, 12,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesFanResponse", LIST_ENTITIES_FAN_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t FAN_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(FanStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(FanStateResponse, state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanStateResponse, oscillating), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanStateResponse, speed), 4, ProtoFieldType::ENUM),
+    proto_field(offsetof(FanStateResponse, direction), 5, ProtoFieldType::ENUM),
+    proto_field(offsetof(FanStateResponse, speed_level), 6, ProtoFieldType::INT32),
+    proto_field(offsetof(FanStateResponse, preset_mode), 7, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump FAN_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"oscillating", nullptr},
+    {"speed", &proto_enum_name<enums::FanSpeed>},
+    {"direction", &proto_enum_name<enums::FanDirection>},
+    {"speed_level", nullptr},
+    {"preset_mode", nullptr},
+};
+#endif
+const ProtoMessageDescriptor FanStateResponse::DESCRIPTOR PROGMEM = {
+    FAN_STATE_RESPONSE_FIELDS, nullptr, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "FanStateResponse", FAN_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t FAN_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(FanCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(FanCommandRequest, has_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, state), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, has_speed), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, speed), 5, ProtoFieldType::ENUM),
+    proto_field(offsetof(FanCommandRequest, has_oscillating), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, oscillating), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, has_direction), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, direction), 9, ProtoFieldType::ENUM),
+    proto_field(offsetof(FanCommandRequest, has_speed_level), 10, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, speed_level), 11, ProtoFieldType::INT32),
+    proto_field(offsetof(FanCommandRequest, has_preset_mode), 12, ProtoFieldType::BOOL),
+    proto_field(offsetof(FanCommandRequest, preset_mode), 13, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump FAN_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_state", nullptr},
+    {"state", nullptr},
+    {"has_speed", nullptr},
+    {"speed", &proto_enum_name<enums::FanSpeed>},
+    {"has_oscillating", nullptr},
+    {"oscillating", nullptr},
+    {"has_direction", nullptr},
+    {"direction", &proto_enum_name<enums::FanDirection>},
+    {"has_speed_level", nullptr},
+    {"speed_level", nullptr},
+    {"has_preset_mode", nullptr},
+    {"preset_mode", nullptr},
+};
+#endif
+const ProtoMessageDescriptor FanCommandRequest::DESCRIPTOR PROGMEM = {
+    FAN_COMMAND_REQUEST_FIELDS, nullptr, 13,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "FanCommandRequest", FAN_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_LIGHT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesLightResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLightResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesLightResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLightResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLightResponse, supported_color_modes), 12, ProtoFieldType::ENUM, true, 0),
+    proto_field(offsetof(ListEntitiesLightResponse, legacy_supports_brightness), 5, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLightResponse, legacy_supports_rgb), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLightResponse, legacy_supports_white_value), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLightResponse, legacy_supports_color_temperature), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLightResponse, min_mireds), 9, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesLightResponse, max_mireds), 10, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesLightResponse, effects), 11, ProtoFieldType::STRING, true),
+    proto_field(offsetof(ListEntitiesLightResponse, disabled_by_default), 13, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLightResponse, icon), 14, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLightResponse, entity_category), 15, ProtoFieldType::ENUM),
+};
+static const ProtoFieldOps *const LIST_ENTITIES_LIGHT_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedEnum<enums::ColorMode>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_LIGHT_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"supported_color_modes", &proto_enum_name<enums::ColorMode>},
+    {"legacy_supports_brightness", nullptr},
+    {"legacy_supports_rgb", nullptr},
+    {"legacy_supports_white_value", nullptr},
+    {"legacy_supports_color_temperature", nullptr},
+    {"min_mireds", nullptr},
+    {"max_mireds", nullptr},
+    {"effects", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesLightResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_LIGHT_RESPONSE_FIELDS, LIST_ENTITIES_LIGHT_RESPONSE_OPS, 15,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesLightResponse", LIST_ENTITIES_LIGHT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIGHT_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(LightStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(LightStateResponse, state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightStateResponse, brightness), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, color_mode), 11, ProtoFieldType::ENUM),
+    proto_field(offsetof(LightStateResponse, color_brightness), 10, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, red), 4, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, green), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, blue), 6, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, white), 7, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, color_temperature), 8, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, cold_white), 12, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, warm_white), 13, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightStateResponse, effect), 9, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIGHT_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"brightness", nullptr},
+    {"color_mode", &proto_enum_name<enums::ColorMode>},
+    {"color_brightness", nullptr},
+    {"red", nullptr},
+    {"green", nullptr},
+    {"blue", nullptr},
+    {"white", nullptr},
+    {"color_temperature", nullptr},
+    {"cold_white", nullptr},
+    {"warm_white", nullptr},
+    {"effect", nullptr},
+};
+#endif
+const ProtoMessageDescriptor LightStateResponse::DESCRIPTOR PROGMEM = {
+    LIGHT_STATE_RESPONSE_FIELDS, nullptr, 13,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "LightStateResponse", LIGHT_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIGHT_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(LightCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(LightCommandRequest, has_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, state), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, has_brightness), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, brightness), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_color_mode), 22, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, color_mode), 23, ProtoFieldType::ENUM),
+    proto_field(offsetof(LightCommandRequest, has_color_brightness), 20, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, color_brightness), 21, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_rgb), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, red), 7, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, green), 8, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, blue), 9, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_white), 10, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, white), 11, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_color_temperature), 12, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, color_temperature), 13, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_cold_white), 24, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, cold_white), 25, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_warm_white), 26, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, warm_white), 27, ProtoFieldType::FLOAT),
+    proto_field(offsetof(LightCommandRequest, has_transition_length), 14, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, transition_length), 15, ProtoFieldType::UINT32),
+    proto_field(offsetof(LightCommandRequest, has_flash_length), 16, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, flash_length), 17, ProtoFieldType::UINT32),
+    proto_field(offsetof(LightCommandRequest, has_effect), 18, ProtoFieldType::BOOL),
+    proto_field(offsetof(LightCommandRequest, effect), 19, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIGHT_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_state", nullptr},
+    {"state", nullptr},
+    {"has_brightness", nullptr},
+    {"brightness", nullptr},
+    {"has_color_mode", nullptr},
+    {"color_mode", &proto_enum_name<enums::ColorMode>},
+    {"has_color_brightness", nullptr},
+    {"color_brightness", nullptr},
+    {"has_rgb", nullptr},
+    {"red", nullptr},
+    {"green", nullptr},
+    {"blue", nullptr},
+    {"has_white", nullptr},
+    {"white", nullptr},
+    {"has_color_temperature", nullptr},
+    {"color_temperature", nullptr},
+    {"has_cold_white", nullptr},
+    {"cold_white", nullptr},
+    {"has_warm_white", nullptr},
+    {"warm_white", nullptr},
+    {"has_transition_length", nullptr},
+    {"transition_length", nullptr},
+    {"has_flash_length", nullptr},
+    {"flash_length", nullptr},
+    {"has_effect", nullptr},
+    {"effect", nullptr},
+};
+#endif
+const ProtoMessageDescriptor LightCommandRequest::DESCRIPTOR PROGMEM = {
+    LIGHT_COMMAND_REQUEST_FIELDS, nullptr, 27,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "LightCommandRequest", LIGHT_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_SENSOR_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesSensorResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesSensorResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, unit_of_measurement), 6, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, accuracy_decimals), 7, ProtoFieldType::INT32),
+    proto_field(offsetof(ListEntitiesSensorResponse, force_update), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesSensorResponse, device_class), 9, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSensorResponse, state_class), 10, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesSensorResponse, legacy_last_reset_type), 11, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesSensorResponse, disabled_by_default), 12, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesSensorResponse, entity_category), 13, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_SENSOR_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"unit_of_measurement", nullptr},
+    {"accuracy_decimals", nullptr},
+    {"force_update", nullptr},
+    {"device_class", nullptr},
+    {"state_class", &proto_enum_name<enums::SensorStateClass>},
+    {"legacy_last_reset_type", &proto_enum_name<enums::SensorLastResetType>},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesSensorResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_SENSOR_RESPONSE_FIELDS, nullptr, 13,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesSensorResponse", LIST_ENTITIES_SENSOR_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SENSOR_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SensorStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(SensorStateResponse, state), 2, ProtoFieldType::FLOAT),
+    proto_field(offsetof(SensorStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SENSOR_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SensorStateResponse::DESCRIPTOR PROGMEM = {
+    SENSOR_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SensorStateResponse", SENSOR_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_SWITCH_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesSwitchResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSwitchResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesSwitchResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSwitchResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSwitchResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSwitchResponse, assumed_state), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesSwitchResponse, disabled_by_default), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesSwitchResponse, entity_category), 8, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesSwitchResponse, device_class), 9, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_SWITCH_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"assumed_state", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesSwitchResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_SWITCH_RESPONSE_FIELDS, nullptr, 9,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesSwitchResponse", LIST_ENTITIES_SWITCH_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SWITCH_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SwitchStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(SwitchStateResponse, state), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SWITCH_STATE_RESPONSE_DUMP[] PROGMEM = {{"key", nullptr}, {"state", nullptr}};
+#endif
+const ProtoMessageDescriptor SwitchStateResponse::DESCRIPTOR PROGMEM = {
+    SWITCH_STATE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SwitchStateResponse", SWITCH_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SWITCH_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SwitchCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(SwitchCommandRequest, state), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SWITCH_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"state", nullptr}};
+#endif
+const ProtoMessageDescriptor SwitchCommandRequest::DESCRIPTOR PROGMEM = {
+    SWITCH_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SwitchCommandRequest", SWITCH_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_TEXT_SENSOR_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesTextSensorResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesTextSensorResponse, device_class), 8, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_TEXT_SENSOR_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesTextSensorResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_TEXT_SENSOR_RESPONSE_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesTextSensorResponse", LIST_ENTITIES_TEXT_SENSOR_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t TEXT_SENSOR_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(TextSensorStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(TextSensorStateResponse, state), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(TextSensorStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump TEXT_SENSOR_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor TextSensorStateResponse::DESCRIPTOR PROGMEM = {
+    TEXT_SENSOR_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "TextSensorStateResponse", TEXT_SENSOR_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SUBSCRIBE_LOGS_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SubscribeLogsRequest, level), 1, ProtoFieldType::ENUM),
+    proto_field(offsetof(SubscribeLogsRequest, dump_config), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SUBSCRIBE_LOGS_REQUEST_DUMP[] PROGMEM = {
+    {"level", &proto_enum_name<enums::LogLevel>},
+    {"dump_config", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SubscribeLogsRequest::DESCRIPTOR PROGMEM = {
+    SUBSCRIBE_LOGS_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeLogsRequest", SUBSCRIBE_LOGS_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t SUBSCRIBE_LOGS_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SubscribeLogsResponse, level), 1, ProtoFieldType::ENUM),
+    proto_field(offsetof(SubscribeLogsResponse, message), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(SubscribeLogsResponse, send_failed), 4, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SUBSCRIBE_LOGS_RESPONSE_DUMP[] PROGMEM = {
+    {"level", &proto_enum_name<enums::LogLevel>},
+    {"message", nullptr},
+    {"send_failed", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SubscribeLogsResponse::DESCRIPTOR PROGMEM = {
+    SUBSCRIBE_LOGS_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeLogsResponse", SUBSCRIBE_LOGS_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor SubscribeHomeassistantServicesRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeHomeassistantServicesRequest", nullptr,
+#endif
+};
+static constexpr uint32_t HOMEASSISTANT_SERVICE_MAP_FIELDS[] PROGMEM = {
+    proto_field(offsetof(HomeassistantServiceMap, key), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(HomeassistantServiceMap, value), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump HOMEASSISTANT_SERVICE_MAP_DUMP[] PROGMEM = {{"key", nullptr}, {"value", nullptr}};
+#endif
+const ProtoMessageDescriptor HomeassistantServiceMap::DESCRIPTOR PROGMEM = {
+    HOMEASSISTANT_SERVICE_MAP_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "HomeassistantServiceMap", HOMEASSISTANT_SERVICE_MAP_DUMP,
+#endif
+};
+static constexpr uint32_t HOMEASSISTANT_SERVICE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(HomeassistantServiceResponse, service), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(HomeassistantServiceResponse, data), 2, ProtoFieldType::MESSAGE, true, 0),
+    proto_field(offsetof(HomeassistantServiceResponse, data_template), 3, ProtoFieldType::MESSAGE, true, 1),
+    proto_field(offsetof(HomeassistantServiceResponse, variables), 4, ProtoFieldType::MESSAGE, true, 2),
+    proto_field(offsetof(HomeassistantServiceResponse, is_event), 5, ProtoFieldType::BOOL),
+};
+static const ProtoFieldOps *const HOMEASSISTANT_SERVICE_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<HomeassistantServiceMap>::OPS,
+    &ProtoRepeatedMessage<HomeassistantServiceMap>::OPS,
+    &ProtoRepeatedMessage<HomeassistantServiceMap>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump HOMEASSISTANT_SERVICE_RESPONSE_DUMP[] PROGMEM = {
+    {"service", nullptr},
+    {"data", nullptr},
+    {"data_template", nullptr},
+    {"variables", nullptr},
+    {"is_event", nullptr},
+};
+#endif
+const ProtoMessageDescriptor HomeassistantServiceResponse::DESCRIPTOR PROGMEM = {
+    HOMEASSISTANT_SERVICE_RESPONSE_FIELDS, HOMEASSISTANT_SERVICE_RESPONSE_OPS, 5,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "HomeassistantServiceResponse", HOMEASSISTANT_SERVICE_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor SubscribeHomeAssistantStatesRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeHomeAssistantStatesRequest", nullptr,
+#endif
+};
+static constexpr uint32_t SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SubscribeHomeAssistantStateResponse, entity_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(SubscribeHomeAssistantStateResponse, attribute), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"entity_id", nullptr},
+    {"attribute", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SubscribeHomeAssistantStateResponse::DESCRIPTOR PROGMEM = {
+    SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeHomeAssistantStateResponse", SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t HOME_ASSISTANT_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(HomeAssistantStateResponse, entity_id), 1, ProtoFieldType::STRING_REF),
+    proto_field(offsetof(HomeAssistantStateResponse, state), 2, ProtoFieldType::STRING_REF),
+    proto_field(offsetof(HomeAssistantStateResponse, attribute), 3, ProtoFieldType::STRING_REF),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump HOME_ASSISTANT_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"entity_id", nullptr},
+    {"state", nullptr},
+    {"attribute", nullptr},
+};
+#endif
+const ProtoMessageDescriptor HomeAssistantStateResponse::DESCRIPTOR PROGMEM = {
+    HOME_ASSISTANT_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "HomeAssistantStateResponse", HOME_ASSISTANT_STATE_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor GetTimeRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "GetTimeRequest", nullptr,
+#endif
+};
+static constexpr uint32_t GET_TIME_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(GetTimeResponse, epoch_seconds), 1, ProtoFieldType::FIXED32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump GET_TIME_RESPONSE_DUMP[] PROGMEM = {{"epoch_seconds", nullptr}};
+#endif
+const ProtoMessageDescriptor GetTimeResponse::DESCRIPTOR PROGMEM = {
+    GET_TIME_RESPONSE_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "GetTimeResponse", GET_TIME_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_SERVICES_ARGUMENT_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesServicesArgument, name), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesServicesArgument, type), 2, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_SERVICES_ARGUMENT_DUMP[] PROGMEM = {
+    {"name", nullptr},
+    {"type", &proto_enum_name<enums::ServiceArgType>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesServicesArgument::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_SERVICES_ARGUMENT_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesServicesArgument", LIST_ENTITIES_SERVICES_ARGUMENT_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_SERVICES_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesServicesResponse, name), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesServicesResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesServicesResponse, args), 3, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const LIST_ENTITIES_SERVICES_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<ListEntitiesServicesArgument>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_SERVICES_RESPONSE_DUMP[] PROGMEM = {
+    {"name", nullptr},
+    {"key", nullptr},
+    {"args", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesServicesResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_SERVICES_RESPONSE_FIELDS, LIST_ENTITIES_SERVICES_RESPONSE_OPS, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesServicesResponse", LIST_ENTITIES_SERVICES_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t EXECUTE_SERVICE_ARGUMENT_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ExecuteServiceArgument, bool_), 1, ProtoFieldType::BOOL),
+    proto_field(offsetof(ExecuteServiceArgument, legacy_int), 2, ProtoFieldType::INT32),
+    proto_field(offsetof(ExecuteServiceArgument, float_), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ExecuteServiceArgument, string_), 4, ProtoFieldType::STRING_REF),
+    proto_field(offsetof(ExecuteServiceArgument, int_), 5, ProtoFieldType::SINT32),
+    proto_field(offsetof(ExecuteServiceArgument, bool_array), 6, ProtoFieldType::BOOL, true),
+    proto_field(offsetof(ExecuteServiceArgument, int_array), 7, ProtoFieldType::SINT32, true),
+    proto_field(offsetof(ExecuteServiceArgument, float_array), 8, ProtoFieldType::FLOAT, true),
+    proto_field(offsetof(ExecuteServiceArgument, string_array), 9, ProtoFieldType::STRING, true),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump EXECUTE_SERVICE_ARGUMENT_DUMP[] PROGMEM = {
+    {"bool_", nullptr},
+    {"legacy_int", nullptr},
+    {"float_", nullptr},
+    {"string_", nullptr},
+    {"int_", nullptr},
+    {"bool_array", nullptr},
+    {"int_array", nullptr},
+    {"float_array", nullptr},
+    {"string_array", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ExecuteServiceArgument::DESCRIPTOR PROGMEM = {
+    EXECUTE_SERVICE_ARGUMENT_FIELDS, nullptr, 9,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ExecuteServiceArgument", EXECUTE_SERVICE_ARGUMENT_DUMP,
+#endif
+};
+static constexpr uint32_t EXECUTE_SERVICE_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ExecuteServiceRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ExecuteServiceRequest, args), 2, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const EXECUTE_SERVICE_REQUEST_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<ExecuteServiceArgument>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump EXECUTE_SERVICE_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"args", nullptr}};
+#endif
+const ProtoMessageDescriptor ExecuteServiceRequest::DESCRIPTOR PROGMEM = {
+    EXECUTE_SERVICE_REQUEST_FIELDS, EXECUTE_SERVICE_REQUEST_OPS, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ExecuteServiceRequest", EXECUTE_SERVICE_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_CAMERA_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesCameraResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCameraResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesCameraResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCameraResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCameraResponse, disabled_by_default), 5, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesCameraResponse, icon), 6, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesCameraResponse, entity_category), 7, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_CAMERA_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesCameraResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_CAMERA_RESPONSE_FIELDS, nullptr, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesCameraResponse", LIST_ENTITIES_CAMERA_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t CAMERA_IMAGE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(CameraImageResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(CameraImageResponse, data), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(CameraImageResponse, done), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CAMERA_IMAGE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"data", nullptr},
+    {"done", nullptr},
+};
+#endif
+const ProtoMessageDescriptor CameraImageResponse::DESCRIPTOR PROGMEM = {
+    CAMERA_IMAGE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "CameraImageResponse", CAMERA_IMAGE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t CAMERA_IMAGE_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(CameraImageRequest, single), 1, ProtoFieldType::BOOL),
+    proto_field(offsetof(CameraImageRequest, stream), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CAMERA_IMAGE_REQUEST_DUMP[] PROGMEM = {{"single", nullptr}, {"stream", nullptr}};
+#endif
+const ProtoMessageDescriptor CameraImageRequest::DESCRIPTOR PROGMEM = {
+    CAMERA_IMAGE_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "CameraImageRequest", CAMERA_IMAGE_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_CLIMATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesClimateResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesClimateResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesClimateResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesClimateResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesClimateResponse, supports_current_temperature), 5, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, supports_two_point_target_temperature), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_modes), 7, ProtoFieldType::ENUM, true, 0),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_min_temperature), 8, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_max_temperature), 9, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_target_temperature_step), 10, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesClimateResponse, legacy_supports_away), 11, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, supports_action), 12, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_fan_modes), 13, ProtoFieldType::ENUM, true, 1),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_swing_modes), 14, ProtoFieldType::ENUM, true, 2),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_custom_fan_modes), 15, ProtoFieldType::STRING, true),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_presets), 16, ProtoFieldType::ENUM, true, 3),
+    proto_field(offsetof(ListEntitiesClimateResponse, supported_custom_presets), 17, ProtoFieldType::STRING, true),
+    proto_field(offsetof(ListEntitiesClimateResponse, disabled_by_default), 18, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, icon), 19, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesClimateResponse, entity_category), 20, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_current_temperature_step), 21, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesClimateResponse, supports_current_humidity), 22, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, supports_target_humidity), 23, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_min_humidity), 24, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesClimateResponse, visual_max_humidity), 25, ProtoFieldType::FLOAT),
+};
+static const ProtoFieldOps *const LIST_ENTITIES_CLIMATE_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedEnum<enums::ClimateMode>::OPS,
+    &ProtoRepeatedEnum<enums::ClimateFanMode>::OPS,
+    &ProtoRepeatedEnum<enums::ClimateSwingMode>::OPS,
+    &ProtoRepeatedEnum<enums::ClimatePreset>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_CLIMATE_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"supports_current_temperature", nullptr},
+    {"supports_two_point_target_temperature", nullptr},
+    {"supported_modes", &proto_enum_name<enums::ClimateMode>},
+    {"visual_min_temperature", nullptr},
+    {"visual_max_temperature", nullptr},
+    {"visual_target_temperature_step", nullptr},
+    {"legacy_supports_away", nullptr},
+    {"supports_action", nullptr},
+    {"supported_fan_modes", &proto_enum_name<enums::ClimateFanMode>},
+    {"supported_swing_modes", &proto_enum_name<enums::ClimateSwingMode>},
+    {"supported_custom_fan_modes", nullptr},
+    {"supported_presets", &proto_enum_name<enums::ClimatePreset>},
+    {"supported_custom_presets", nullptr},
+    {"disabled_by_default", nullptr},
+    {"icon", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"visual_current_temperature_step", nullptr},
+    {"supports_current_humidity", nullptr},
+    {"supports_target_humidity", nullptr},
+    {"visual_min_humidity", nullptr},
+    {"visual_max_humidity", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesClimateResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_CLIMATE_RESPONSE_FIELDS, LIST_ENTITIES_CLIMATE_RESPONSE_OPS, 25,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesClimateResponse", LIST_ENTITIES_CLIMATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t CLIMATE_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ClimateStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ClimateStateResponse, mode), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateStateResponse, current_temperature), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateStateResponse, target_temperature), 4, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateStateResponse, target_temperature_low), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateStateResponse, target_temperature_high), 6, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateStateResponse, unused_legacy_away), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateStateResponse, action), 8, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateStateResponse, fan_mode), 9, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateStateResponse, swing_mode), 10, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateStateResponse, custom_fan_mode), 11, ProtoFieldType::STRING),
+    proto_field(offsetof(ClimateStateResponse, preset), 12, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateStateResponse, custom_preset), 13, ProtoFieldType::STRING),
+    proto_field(offsetof(ClimateStateResponse, current_humidity), 14, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateStateResponse, target_humidity), 15, ProtoFieldType::FLOAT),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CLIMATE_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"mode", &proto_enum_name<enums::ClimateMode>},
+    {"current_temperature", nullptr},
+    {"target_temperature", nullptr},
+    {"target_temperature_low", nullptr},
+    {"target_temperature_high", nullptr},
+    {"unused_legacy_away", nullptr},
+    {"action", &proto_enum_name<enums::ClimateAction>},
+    {"fan_mode", &proto_enum_name<enums::ClimateFanMode>},
+    {"swing_mode", &proto_enum_name<enums::ClimateSwingMode>},
+    {"custom_fan_mode", nullptr},
+    {"preset", &proto_enum_name<enums::ClimatePreset>},
+    {"custom_preset", nullptr},
+    {"current_humidity", nullptr},
+    {"target_humidity", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ClimateStateResponse::DESCRIPTOR PROGMEM = {
+    CLIMATE_STATE_RESPONSE_FIELDS, nullptr, 15,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ClimateStateResponse", CLIMATE_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t CLIMATE_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ClimateCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ClimateCommandRequest, has_mode), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, mode), 3, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateCommandRequest, has_target_temperature), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, target_temperature), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateCommandRequest, has_target_temperature_low), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, target_temperature_low), 7, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateCommandRequest, has_target_temperature_high), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, target_temperature_high), 9, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ClimateCommandRequest, unused_has_legacy_away), 10, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, unused_legacy_away), 11, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, has_fan_mode), 12, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, fan_mode), 13, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateCommandRequest, has_swing_mode), 14, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, swing_mode), 15, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateCommandRequest, has_custom_fan_mode), 16, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, custom_fan_mode), 17, ProtoFieldType::STRING),
+    proto_field(offsetof(ClimateCommandRequest, has_preset), 18, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, preset), 19, ProtoFieldType::ENUM),
+    proto_field(offsetof(ClimateCommandRequest, has_custom_preset), 20, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, custom_preset), 21, ProtoFieldType::STRING),
+    proto_field(offsetof(ClimateCommandRequest, has_target_humidity), 22, ProtoFieldType::BOOL),
+    proto_field(offsetof(ClimateCommandRequest, target_humidity), 23, ProtoFieldType::FLOAT),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump CLIMATE_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_mode", nullptr},
+    {"mode", &proto_enum_name<enums::ClimateMode>},
+    {"has_target_temperature", nullptr},
+    {"target_temperature", nullptr},
+    {"has_target_temperature_low", nullptr},
+    {"target_temperature_low", nullptr},
+    {"has_target_temperature_high", nullptr},
+    {"target_temperature_high", nullptr},
+    {"unused_has_legacy_away", nullptr},
+    {"unused_legacy_away", nullptr},
+    {"has_fan_mode", nullptr},
+    {"fan_mode", &proto_enum_name<enums::ClimateFanMode>},
+    {"has_swing_mode", nullptr},
+    {"swing_mode", &proto_enum_name<enums::ClimateSwingMode>},
+    {"has_custom_fan_mode", nullptr},
+    {"custom_fan_mode", nullptr},
+    {"has_preset", nullptr},
+    {"preset", &proto_enum_name<enums::ClimatePreset>},
+    {"has_custom_preset", nullptr},
+    {"custom_preset", nullptr},
+    {"has_target_humidity", nullptr},
+    {"target_humidity", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ClimateCommandRequest::DESCRIPTOR PROGMEM = {
+    CLIMATE_COMMAND_REQUEST_FIELDS, nullptr, 23,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ClimateCommandRequest", CLIMATE_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_NUMBER_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesNumberResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesNumberResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesNumberResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesNumberResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesNumberResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesNumberResponse, min_value), 6, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesNumberResponse, max_value), 7, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesNumberResponse, step), 8, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ListEntitiesNumberResponse, disabled_by_default), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesNumberResponse, entity_category), 10, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesNumberResponse, unit_of_measurement), 11, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesNumberResponse, mode), 12, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesNumberResponse, device_class), 13, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_NUMBER_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"min_value", nullptr},
+    {"max_value", nullptr},
+    {"step", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"unit_of_measurement", nullptr},
+    {"mode", &proto_enum_name<enums::NumberMode>},
+    {"device_class", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesNumberResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_NUMBER_RESPONSE_FIELDS, nullptr, 13,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesNumberResponse", LIST_ENTITIES_NUMBER_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t NUMBER_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(NumberStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(NumberStateResponse, state), 2, ProtoFieldType::FLOAT),
+    proto_field(offsetof(NumberStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump NUMBER_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor NumberStateResponse::DESCRIPTOR PROGMEM = {
+    NUMBER_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "NumberStateResponse", NUMBER_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t NUMBER_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(NumberCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(NumberCommandRequest, state), 2, ProtoFieldType::FLOAT),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump NUMBER_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"state", nullptr}};
+#endif
+const ProtoMessageDescriptor NumberCommandRequest::DESCRIPTOR PROGMEM = {
+    NUMBER_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "NumberCommandRequest", NUMBER_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_SELECT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesSelectResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSelectResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesSelectResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSelectResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSelectResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesSelectResponse, options), 6, ProtoFieldType::STRING, true),
+    proto_field(offsetof(ListEntitiesSelectResponse, disabled_by_default), 7, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesSelectResponse, entity_category), 8, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_SELECT_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"options", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesSelectResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_SELECT_RESPONSE_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesSelectResponse", LIST_ENTITIES_SELECT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SELECT_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SelectStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(SelectStateResponse, state), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(SelectStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SELECT_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SelectStateResponse::DESCRIPTOR PROGMEM = {
+    SELECT_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SelectStateResponse", SELECT_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SELECT_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SelectCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(SelectCommandRequest, state), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SELECT_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"state", nullptr}};
+#endif
+const ProtoMessageDescriptor SelectCommandRequest::DESCRIPTOR PROGMEM = {
+    SELECT_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SelectCommandRequest", SELECT_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_LOCK_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesLockResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLockResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesLockResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLockResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLockResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesLockResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLockResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesLockResponse, assumed_state), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLockResponse, supports_open), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLockResponse, requires_code), 10, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesLockResponse, code_format), 11, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_LOCK_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"assumed_state", nullptr},
+    {"supports_open", nullptr},
+    {"requires_code", nullptr},
+    {"code_format", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesLockResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_LOCK_RESPONSE_FIELDS, nullptr, 11,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesLockResponse", LIST_ENTITIES_LOCK_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LOCK_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(LockStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(LockStateResponse, state), 2, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LOCK_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", &proto_enum_name<enums::LockState>},
+};
+#endif
+const ProtoMessageDescriptor LockStateResponse::DESCRIPTOR PROGMEM = {
+    LOCK_STATE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "LockStateResponse", LOCK_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LOCK_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(LockCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(LockCommandRequest, command), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(LockCommandRequest, has_code), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(LockCommandRequest, code), 4, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LOCK_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"command", &proto_enum_name<enums::LockCommand>},
+    {"has_code", nullptr},
+    {"code", nullptr},
+};
+#endif
+const ProtoMessageDescriptor LockCommandRequest::DESCRIPTOR PROGMEM = {
+    LOCK_COMMAND_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "LockCommandRequest", LOCK_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_BUTTON_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesButtonResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesButtonResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesButtonResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesButtonResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesButtonResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesButtonResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesButtonResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesButtonResponse, device_class), 8, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_BUTTON_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesButtonResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_BUTTON_RESPONSE_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesButtonResponse", LIST_ENTITIES_BUTTON_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BUTTON_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ButtonCommandRequest, key), 1, ProtoFieldType::FIXED32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BUTTON_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}};
+#endif
+const ProtoMessageDescriptor ButtonCommandRequest::DESCRIPTOR PROGMEM = {
+    BUTTON_COMMAND_REQUEST_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ButtonCommandRequest", BUTTON_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesMediaPlayerResponse, supports_pause), 8, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"supports_pause", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesMediaPlayerResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesMediaPlayerResponse", LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t MEDIA_PLAYER_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(MediaPlayerStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(MediaPlayerStateResponse, state), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(MediaPlayerStateResponse, volume), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(MediaPlayerStateResponse, muted), 4, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump MEDIA_PLAYER_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", &proto_enum_name<enums::MediaPlayerState>},
+    {"volume", nullptr},
+    {"muted", nullptr},
+};
+#endif
+const ProtoMessageDescriptor MediaPlayerStateResponse::DESCRIPTOR PROGMEM = {
+    MEDIA_PLAYER_STATE_RESPONSE_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "MediaPlayerStateResponse", MEDIA_PLAYER_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t MEDIA_PLAYER_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(MediaPlayerCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(MediaPlayerCommandRequest, has_command), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(MediaPlayerCommandRequest, command), 3, ProtoFieldType::ENUM),
+    proto_field(offsetof(MediaPlayerCommandRequest, has_volume), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(MediaPlayerCommandRequest, volume), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(MediaPlayerCommandRequest, has_media_url), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(MediaPlayerCommandRequest, media_url), 7, ProtoFieldType::STRING),
+    proto_field(offsetof(MediaPlayerCommandRequest, has_announcement), 8, ProtoFieldType::BOOL),
+    proto_field(offsetof(MediaPlayerCommandRequest, announcement), 9, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump MEDIA_PLAYER_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_command", nullptr},
+    {"command", &proto_enum_name<enums::MediaPlayerCommand>},
+    {"has_volume", nullptr},
+    {"volume", nullptr},
+    {"has_media_url", nullptr},
+    {"media_url", nullptr},
+    {"has_announcement", nullptr},
+    {"announcement", nullptr},
+};
+#endif
+const ProtoMessageDescriptor MediaPlayerCommandRequest::DESCRIPTOR PROGMEM = {
+    MEDIA_PLAYER_COMMAND_REQUEST_FIELDS, nullptr, 9,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "MediaPlayerCommandRequest", MEDIA_PLAYER_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SubscribeBluetoothLEAdvertisementsRequest, flags), 1, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_DUMP[] PROGMEM = {{"flags", nullptr}};
+#endif
+const ProtoMessageDescriptor SubscribeBluetoothLEAdvertisementsRequest::DESCRIPTOR PROGMEM = {
+    SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeBluetoothLEAdvertisementsRequest", SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_SERVICE_DATA_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothServiceData, uuid), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(BluetoothServiceData, legacy_data), 2, ProtoFieldType::UINT32, true),
+    proto_field(offsetof(BluetoothServiceData, data), 3, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_SERVICE_DATA_DUMP[] PROGMEM = {
+    {"uuid", nullptr},
+    {"legacy_data", nullptr},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothServiceData::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_SERVICE_DATA_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothServiceData", BLUETOOTH_SERVICE_DATA_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, name), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, rssi), 3, ProtoFieldType::SINT32),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, service_uuids), 4, ProtoFieldType::STRING, true),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, service_data), 5, ProtoFieldType::MESSAGE, true, 0),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, manufacturer_data), 6, ProtoFieldType::MESSAGE, true, 1),
+    proto_field(offsetof(BluetoothLEAdvertisementResponse, address_type), 7, ProtoFieldType::UINT32),
+};
+static const ProtoFieldOps *const BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<BluetoothServiceData>::OPS,
+    &ProtoRepeatedMessage<BluetoothServiceData>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"name", nullptr},
+    {"rssi", nullptr},
+    {"service_uuids", nullptr},
+    {"service_data", nullptr},
+    {"manufacturer_data", nullptr},
+    {"address_type", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothLEAdvertisementResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_FIELDS, BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_OPS, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothLEAdvertisementResponse", BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_LE_RAW_ADVERTISEMENT_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothLERawAdvertisement, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothLERawAdvertisement, rssi), 2, ProtoFieldType::SINT32),
+    proto_field(offsetof(BluetoothLERawAdvertisement, address_type), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothLERawAdvertisement, data), 4, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_LE_RAW_ADVERTISEMENT_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"rssi", nullptr},
+    {"address_type", nullptr},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothLERawAdvertisement::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_LE_RAW_ADVERTISEMENT_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothLERawAdvertisement", BLUETOOTH_LE_RAW_ADVERTISEMENT_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothLERawAdvertisementsResponse, advertisements), 1, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<BluetoothLERawAdvertisement>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_DUMP[] PROGMEM = {{"advertisements", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothLERawAdvertisementsResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_FIELDS, BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_OPS, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothLERawAdvertisementsResponse", BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_DEVICE_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothDeviceRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothDeviceRequest, request_type), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(BluetoothDeviceRequest, has_address_type), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothDeviceRequest, address_type), 4, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_DEVICE_REQUEST_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"request_type", &proto_enum_name<enums::BluetoothDeviceRequestType>},
+    {"has_address_type", nullptr},
+    {"address_type", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothDeviceRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_DEVICE_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothDeviceRequest", BLUETOOTH_DEVICE_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_DEVICE_CONNECTION_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothDeviceConnectionResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothDeviceConnectionResponse, connected), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothDeviceConnectionResponse, mtu), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothDeviceConnectionResponse, error), 4, ProtoFieldType::INT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_DEVICE_CONNECTION_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"connected", nullptr},
+    {"mtu", nullptr},
+    {"error", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothDeviceConnectionResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_DEVICE_CONNECTION_RESPONSE_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothDeviceConnectionResponse", BLUETOOTH_DEVICE_CONNECTION_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_GET_SERVICES_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTGetServicesRequest, address), 1, ProtoFieldType::UINT64),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_GET_SERVICES_REQUEST_DUMP[] PROGMEM = {{"address", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothGATTGetServicesRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_GET_SERVICES_REQUEST_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTGetServicesRequest", BLUETOOTH_GATT_GET_SERVICES_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_DESCRIPTOR_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTDescriptor, uuid), 1, ProtoFieldType::UINT64, true),
+    proto_field(offsetof(BluetoothGATTDescriptor, handle), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_DESCRIPTOR_DUMP[] PROGMEM = {{"uuid", nullptr}, {"handle", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothGATTDescriptor::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_DESCRIPTOR_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTDescriptor", BLUETOOTH_GATT_DESCRIPTOR_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_CHARACTERISTIC_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTCharacteristic, uuid), 1, ProtoFieldType::UINT64, true),
+    proto_field(offsetof(BluetoothGATTCharacteristic, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTCharacteristic, properties), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTCharacteristic, descriptors), 4, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const BLUETOOTH_GATT_CHARACTERISTIC_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<BluetoothGATTDescriptor>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_CHARACTERISTIC_DUMP[] PROGMEM = {
+    {"uuid", nullptr},
+    {"handle", nullptr},
+    {"properties", nullptr},
+    {"descriptors", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTCharacteristic::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_CHARACTERISTIC_FIELDS, BLUETOOTH_GATT_CHARACTERISTIC_OPS, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTCharacteristic", BLUETOOTH_GATT_CHARACTERISTIC_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_SERVICE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTService, uuid), 1, ProtoFieldType::UINT64, true),
+    proto_field(offsetof(BluetoothGATTService, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTService, characteristics), 3, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const BLUETOOTH_GATT_SERVICE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<BluetoothGATTCharacteristic>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_SERVICE_DUMP[] PROGMEM = {
+    {"uuid", nullptr},
+    {"handle", nullptr},
+    {"characteristics", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTService::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_SERVICE_FIELDS, BLUETOOTH_GATT_SERVICE_OPS, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTService", BLUETOOTH_GATT_SERVICE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_GET_SERVICES_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTGetServicesResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTGetServicesResponse, services), 2, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const BLUETOOTH_GATT_GET_SERVICES_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<BluetoothGATTService>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_GET_SERVICES_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"services", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTGetServicesResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_GET_SERVICES_RESPONSE_FIELDS, BLUETOOTH_GATT_GET_SERVICES_RESPONSE_OPS, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTGetServicesResponse", BLUETOOTH_GATT_GET_SERVICES_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTGetServicesDoneResponse, address), 1, ProtoFieldType::UINT64),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_DUMP[] PROGMEM = {{"address", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothGATTGetServicesDoneResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_FIELDS, nullptr, 1,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTGetServicesDoneResponse", BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_READ_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTReadRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTReadRequest, handle), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_READ_REQUEST_DUMP[] PROGMEM = {{"address", nullptr}, {"handle", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothGATTReadRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_READ_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTReadRequest", BLUETOOTH_GATT_READ_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_READ_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTReadResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTReadResponse, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTReadResponse, data), 3, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_READ_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTReadResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_READ_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTReadResponse", BLUETOOTH_GATT_READ_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_WRITE_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTWriteRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTWriteRequest, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTWriteRequest, response), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothGATTWriteRequest, data), 4, ProtoFieldType::STRING_REF),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_WRITE_REQUEST_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"response", nullptr},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTWriteRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_WRITE_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTWriteRequest", BLUETOOTH_GATT_WRITE_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTReadDescriptorRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTReadDescriptorRequest, handle), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTReadDescriptorRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTReadDescriptorRequest", BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTWriteDescriptorRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTWriteDescriptorRequest, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTWriteDescriptorRequest, data), 3, ProtoFieldType::STRING_REF),
+};
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void ListEntitiesUpdateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("ListEntitiesUpdateResponse {\n");
-  out.append("  object_id: ");
-  out.append("'").append(this->object_id).append("'");
-  out.append("\n");
-
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  name: ");
-  out.append("'").append(this->name).append("'");
-  out.append("\n");
-
-  out.append("  unique_id: ");
-  out.append("'").append(this->unique_id).append("'");
-  out.append("\n");
-
-  out.append("  icon: ");
-  out.append("'").append(this->icon).append("'");
-  out.append("\n");
-
-  out.append("  disabled_by_default: ");
-  out.append(YESNO(this->disabled_by_default));
-  out.append("\n");
-
-  out.append("  entity_category: ");
-  out.append(proto_enum_to_string<enums::EntityCategory>(this->entity_category));
-  out.append("\n");
-
-  out.append("  device_class: ");
-  out.append("'").append(this->device_class).append("'");
-  out.append("\n");
-  out.append("}");
-}
+static const ProtoFieldDump BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"data", nullptr},
+};
 #endif
-bool UpdateStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->missing_state = value.as_bool();
-      return true;
-    }
-    case 3: {
-      this->in_progress = value.as_bool();
-      return true;
-    }
-    case 4: {
-      this->has_progress = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool UpdateStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
-  switch (field_id) {
-    case 6: {
-      this->current_version = value.as_string();
-      return true;
-    }
-    case 7: {
-      this->latest_version = value.as_string();
-      return true;
-    }
-    case 8: {
-      this->title = value.as_string();
-      return true;
-    }
-    case 9: {
-      this->release_summary = value.as_string();
-      return true;
-    }
-    case 10: {
-      this->release_url = value.as_string();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool UpdateStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    case 5: {
-      this->progress = value.as_float();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void UpdateStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->missing_state);
-  buffer.encode_bool(3, this->in_progress);
-  buffer.encode_bool(4, this->has_progress);
-  buffer.encode_float(5, this->progress);
-  buffer.encode_string(6, this->current_version);
-  buffer.encode_string(7, this->latest_version);
-  buffer.encode_string(8, this->title);
-  buffer.encode_string(9, this->release_summary);
-  buffer.encode_string(10, this->release_url);
-}
+const ProtoMessageDescriptor BluetoothGATTWriteDescriptorRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_FIELDS, nullptr, 3,
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void UpdateStateResponse::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("UpdateStateResponse {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  missing_state: ");
-  out.append(YESNO(this->missing_state));
-  out.append("\n");
-
-  out.append("  in_progress: ");
-  out.append(YESNO(this->in_progress));
-  out.append("\n");
-
-  out.append("  has_progress: ");
-  out.append(YESNO(this->has_progress));
-  out.append("\n");
-
-  out.append("  progress: ");
-  sprintf(buffer, "%g", this->progress);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  current_version: ");
-  out.append("'").append(this->current_version).append("'");
-  out.append("\n");
-
-  out.append("  latest_version: ");
-  out.append("'").append(this->latest_version).append("'");
-  out.append("\n");
-
-  out.append("  title: ");
-  out.append("'").append(this->title).append("'");
-  out.append("\n");
-
-  out.append("  release_summary: ");
-  out.append("'").append(this->release_summary).append("'");
-  out.append("\n");
-
-  out.append("  release_url: ");
-  out.append("'").append(this->release_url).append("'");
-  out.append("\n");
-  out.append("}");
-}
+    "BluetoothGATTWriteDescriptorRequest", BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_DUMP,
 #endif
-bool UpdateCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
-  switch (field_id) {
-    case 2: {
-      this->install = value.as_bool();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-bool UpdateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
-  switch (field_id) {
-    case 1: {
-      this->key = value.as_fixed32();
-      return true;
-    }
-    default:
-      return false;
-  }
-}
-void UpdateCommandRequest::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->install);
-}
+};
+static constexpr uint32_t BLUETOOTH_GATT_NOTIFY_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTNotifyRequest, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTNotifyRequest, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTNotifyRequest, enable), 3, ProtoFieldType::BOOL),
+};
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void UpdateCommandRequest::dump_to(std::string &out) const {
-  __attribute__((unused)) char buffer[64];
-  out.append("UpdateCommandRequest {\n");
-  out.append("  key: ");
-  sprintf(buffer, "%" PRIu32, this->key);
-  out.append(buffer);
-  out.append("\n");
-
-  out.append("  install: ");
-  out.append(YESNO(this->install));
-  out.append("\n");
-  out.append("}");
-}
-#endif
+static const ProtoFieldDump BLUETOOTH_GATT_NOTIFY_REQUEST_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"enable", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTNotifyRequest::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_NOTIFY_REQUEST_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTNotifyRequest", BLUETOOTH_GATT_NOTIFY_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTNotifyDataResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTNotifyDataResponse, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTNotifyDataResponse, data), 3, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTNotifyDataResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTNotifyDataResponse", BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor SubscribeBluetoothConnectionsFreeRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeBluetoothConnectionsFreeRequest", nullptr,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_CONNECTIONS_FREE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothConnectionsFreeResponse, free), 1, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothConnectionsFreeResponse, limit), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_CONNECTIONS_FREE_RESPONSE_DUMP[] PROGMEM = {
+    {"free", nullptr},
+    {"limit", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothConnectionsFreeResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_CONNECTIONS_FREE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothConnectionsFreeResponse", BLUETOOTH_CONNECTIONS_FREE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_ERROR_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTErrorResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTErrorResponse, handle), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(BluetoothGATTErrorResponse, error), 3, ProtoFieldType::INT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_ERROR_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+    {"error", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTErrorResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_ERROR_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTErrorResponse", BLUETOOTH_GATT_ERROR_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_WRITE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTWriteResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTWriteResponse, handle), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_WRITE_RESPONSE_DUMP[] PROGMEM = {{"address", nullptr}, {"handle", nullptr}};
+#endif
+const ProtoMessageDescriptor BluetoothGATTWriteResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_WRITE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTWriteResponse", BLUETOOTH_GATT_WRITE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_GATT_NOTIFY_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothGATTNotifyResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothGATTNotifyResponse, handle), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_GATT_NOTIFY_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"handle", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothGATTNotifyResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_GATT_NOTIFY_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothGATTNotifyResponse", BLUETOOTH_GATT_NOTIFY_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_DEVICE_PAIRING_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothDevicePairingResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothDevicePairingResponse, paired), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothDevicePairingResponse, error), 3, ProtoFieldType::INT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_DEVICE_PAIRING_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"paired", nullptr},
+    {"error", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothDevicePairingResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_DEVICE_PAIRING_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothDevicePairingResponse", BLUETOOTH_DEVICE_PAIRING_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_DEVICE_UNPAIRING_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothDeviceUnpairingResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothDeviceUnpairingResponse, success), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothDeviceUnpairingResponse, error), 3, ProtoFieldType::INT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_DEVICE_UNPAIRING_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"success", nullptr},
+    {"error", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothDeviceUnpairingResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_DEVICE_UNPAIRING_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothDeviceUnpairingResponse", BLUETOOTH_DEVICE_UNPAIRING_RESPONSE_DUMP,
+#endif
+};
+const ProtoMessageDescriptor UnsubscribeBluetoothLEAdvertisementsRequest::DESCRIPTOR PROGMEM = {
+    nullptr, nullptr, 0,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "UnsubscribeBluetoothLEAdvertisementsRequest", nullptr,
+#endif
+};
+static constexpr uint32_t BLUETOOTH_DEVICE_CLEAR_CACHE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(BluetoothDeviceClearCacheResponse, address), 1, ProtoFieldType::UINT64),
+    proto_field(offsetof(BluetoothDeviceClearCacheResponse, success), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(BluetoothDeviceClearCacheResponse, error), 3, ProtoFieldType::INT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump BLUETOOTH_DEVICE_CLEAR_CACHE_RESPONSE_DUMP[] PROGMEM = {
+    {"address", nullptr},
+    {"success", nullptr},
+    {"error", nullptr},
+};
+#endif
+const ProtoMessageDescriptor BluetoothDeviceClearCacheResponse::DESCRIPTOR PROGMEM = {
+    BLUETOOTH_DEVICE_CLEAR_CACHE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "BluetoothDeviceClearCacheResponse", BLUETOOTH_DEVICE_CLEAR_CACHE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t SUBSCRIBE_VOICE_ASSISTANT_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(SubscribeVoiceAssistantRequest, subscribe), 1, ProtoFieldType::BOOL),
+    proto_field(offsetof(SubscribeVoiceAssistantRequest, flags), 2, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump SUBSCRIBE_VOICE_ASSISTANT_REQUEST_DUMP[] PROGMEM = {
+    {"subscribe", nullptr},
+    {"flags", nullptr},
+};
+#endif
+const ProtoMessageDescriptor SubscribeVoiceAssistantRequest::DESCRIPTOR PROGMEM = {
+    SUBSCRIBE_VOICE_ASSISTANT_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "SubscribeVoiceAssistantRequest", SUBSCRIBE_VOICE_ASSISTANT_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_AUDIO_SETTINGS_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantAudioSettings, noise_suppression_level), 1, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantAudioSettings, auto_gain), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantAudioSettings, volume_multiplier), 3, ProtoFieldType::FLOAT),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_AUDIO_SETTINGS_DUMP[] PROGMEM = {
+    {"noise_suppression_level", nullptr},
+    {"auto_gain", nullptr},
+    {"volume_multiplier", nullptr},
+};
+#endif
+const ProtoMessageDescriptor VoiceAssistantAudioSettings::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_AUDIO_SETTINGS_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantAudioSettings", VOICE_ASSISTANT_AUDIO_SETTINGS_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantRequest, start), 1, ProtoFieldType::BOOL),
+    proto_field(offsetof(VoiceAssistantRequest, conversation_id), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(VoiceAssistantRequest, flags), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantRequest, audio_settings), 4, ProtoFieldType::MESSAGE, false, 0),
+    proto_field(offsetof(VoiceAssistantRequest, wake_word_phrase), 5, ProtoFieldType::STRING),
+};
+static const ProtoFieldOps *const VOICE_ASSISTANT_REQUEST_OPS[] PROGMEM = {
+    &ProtoNestedMessage<VoiceAssistantAudioSettings>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_REQUEST_DUMP[] PROGMEM = {
+    {"start", nullptr},
+    {"conversation_id", nullptr},
+    {"flags", nullptr},
+    {"audio_settings", nullptr},
+    {"wake_word_phrase", nullptr},
+};
+#endif
+const ProtoMessageDescriptor VoiceAssistantRequest::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_REQUEST_FIELDS, VOICE_ASSISTANT_REQUEST_OPS, 5,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantRequest", VOICE_ASSISTANT_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantResponse, port), 1, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantResponse, error), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_RESPONSE_DUMP[] PROGMEM = {{"port", nullptr}, {"error", nullptr}};
+#endif
+const ProtoMessageDescriptor VoiceAssistantResponse::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantResponse", VOICE_ASSISTANT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_EVENT_DATA_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantEventData, name), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(VoiceAssistantEventData, value), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_EVENT_DATA_DUMP[] PROGMEM = {{"name", nullptr}, {"value", nullptr}};
+#endif
+const ProtoMessageDescriptor VoiceAssistantEventData::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_EVENT_DATA_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantEventData", VOICE_ASSISTANT_EVENT_DATA_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_EVENT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantEventResponse, event_type), 1, ProtoFieldType::ENUM),
+    proto_field(offsetof(VoiceAssistantEventResponse, data), 2, ProtoFieldType::MESSAGE, true, 0),
+};
+static const ProtoFieldOps *const VOICE_ASSISTANT_EVENT_RESPONSE_OPS[] PROGMEM = {
+    &ProtoRepeatedMessage<VoiceAssistantEventData>::OPS,
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_EVENT_RESPONSE_DUMP[] PROGMEM = {
+    {"event_type", &proto_enum_name<enums::VoiceAssistantEvent>},
+    {"data", nullptr},
+};
+#endif
+const ProtoMessageDescriptor VoiceAssistantEventResponse::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_EVENT_RESPONSE_FIELDS, VOICE_ASSISTANT_EVENT_RESPONSE_OPS, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantEventResponse", VOICE_ASSISTANT_EVENT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_AUDIO_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantAudio, data), 1, ProtoFieldType::STRING_REF),
+    proto_field(offsetof(VoiceAssistantAudio, end), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_AUDIO_DUMP[] PROGMEM = {{"data", nullptr}, {"end", nullptr}};
+#endif
+const ProtoMessageDescriptor VoiceAssistantAudio::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_AUDIO_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantAudio", VOICE_ASSISTANT_AUDIO_DUMP,
+#endif
+};
+static constexpr uint32_t VOICE_ASSISTANT_TIMER_EVENT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, event_type), 1, ProtoFieldType::ENUM),
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, timer_id), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, total_seconds), 4, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, seconds_left), 5, ProtoFieldType::UINT32),
+    proto_field(offsetof(VoiceAssistantTimerEventResponse, is_active), 6, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VOICE_ASSISTANT_TIMER_EVENT_RESPONSE_DUMP[] PROGMEM = {
+    {"event_type", &proto_enum_name<enums::VoiceAssistantTimerEvent>},
+    {"timer_id", nullptr},
+    {"name", nullptr},
+    {"total_seconds", nullptr},
+    {"seconds_left", nullptr},
+    {"is_active", nullptr},
+};
+#endif
+const ProtoMessageDescriptor VoiceAssistantTimerEventResponse::DESCRIPTOR PROGMEM = {
+    VOICE_ASSISTANT_TIMER_EVENT_RESPONSE_FIELDS, nullptr, 6,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "VoiceAssistantTimerEventResponse", VOICE_ASSISTANT_TIMER_EVENT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_ALARM_CONTROL_PANEL_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, supported_features), 8, ProtoFieldType::UINT32),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, requires_code), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesAlarmControlPanelResponse, requires_code_to_arm), 10, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_ALARM_CONTROL_PANEL_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"supported_features", nullptr},
+    {"requires_code", nullptr},
+    {"requires_code_to_arm", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesAlarmControlPanelResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_ALARM_CONTROL_PANEL_RESPONSE_FIELDS, nullptr, 10,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesAlarmControlPanelResponse", LIST_ENTITIES_ALARM_CONTROL_PANEL_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t ALARM_CONTROL_PANEL_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(AlarmControlPanelStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(AlarmControlPanelStateResponse, state), 2, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump ALARM_CONTROL_PANEL_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", &proto_enum_name<enums::AlarmControlPanelState>},
+};
+#endif
+const ProtoMessageDescriptor AlarmControlPanelStateResponse::DESCRIPTOR PROGMEM = {
+    ALARM_CONTROL_PANEL_STATE_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "AlarmControlPanelStateResponse", ALARM_CONTROL_PANEL_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t ALARM_CONTROL_PANEL_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(AlarmControlPanelCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(AlarmControlPanelCommandRequest, command), 2, ProtoFieldType::ENUM),
+    proto_field(offsetof(AlarmControlPanelCommandRequest, code), 3, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump ALARM_CONTROL_PANEL_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"command", &proto_enum_name<enums::AlarmControlPanelStateCommand>},
+    {"code", nullptr},
+};
+#endif
+const ProtoMessageDescriptor AlarmControlPanelCommandRequest::DESCRIPTOR PROGMEM = {
+    ALARM_CONTROL_PANEL_COMMAND_REQUEST_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "AlarmControlPanelCommandRequest", ALARM_CONTROL_PANEL_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_TEXT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesTextResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesTextResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesTextResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesTextResponse, min_length), 8, ProtoFieldType::UINT32),
+    proto_field(offsetof(ListEntitiesTextResponse, max_length), 9, ProtoFieldType::UINT32),
+    proto_field(offsetof(ListEntitiesTextResponse, pattern), 10, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTextResponse, mode), 11, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_TEXT_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"min_length", nullptr},
+    {"max_length", nullptr},
+    {"pattern", nullptr},
+    {"mode", &proto_enum_name<enums::TextMode>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesTextResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_TEXT_RESPONSE_FIELDS, nullptr, 11,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesTextResponse", LIST_ENTITIES_TEXT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t TEXT_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(TextStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(TextStateResponse, state), 2, ProtoFieldType::STRING),
+    proto_field(offsetof(TextStateResponse, missing_state), 3, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump TEXT_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"state", nullptr},
+    {"missing_state", nullptr},
+};
+#endif
+const ProtoMessageDescriptor TextStateResponse::DESCRIPTOR PROGMEM = {
+    TEXT_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "TextStateResponse", TEXT_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t TEXT_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(TextCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(TextCommandRequest, state), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump TEXT_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"state", nullptr}};
+#endif
+const ProtoMessageDescriptor TextCommandRequest::DESCRIPTOR PROGMEM = {
+    TEXT_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "TextCommandRequest", TEXT_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_DATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesDateResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesDateResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesDateResponse, entity_category), 7, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_DATE_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesDateResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_DATE_RESPONSE_FIELDS, nullptr, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesDateResponse", LIST_ENTITIES_DATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t DATE_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(DateStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(DateStateResponse, missing_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(DateStateResponse, year), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(DateStateResponse, month), 4, ProtoFieldType::UINT32),
+    proto_field(offsetof(DateStateResponse, day), 5, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump DATE_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"missing_state", nullptr},
+    {"year", nullptr},
+    {"month", nullptr},
+    {"day", nullptr},
+};
+#endif
+const ProtoMessageDescriptor DateStateResponse::DESCRIPTOR PROGMEM = {
+    DATE_STATE_RESPONSE_FIELDS, nullptr, 5,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DateStateResponse", DATE_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t DATE_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(DateCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(DateCommandRequest, year), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(DateCommandRequest, month), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(DateCommandRequest, day), 4, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump DATE_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"year", nullptr},
+    {"month", nullptr},
+    {"day", nullptr},
+};
+#endif
+const ProtoMessageDescriptor DateCommandRequest::DESCRIPTOR PROGMEM = {
+    DATE_COMMAND_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DateCommandRequest", DATE_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_TIME_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesTimeResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTimeResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesTimeResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTimeResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTimeResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesTimeResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesTimeResponse, entity_category), 7, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_TIME_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesTimeResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_TIME_RESPONSE_FIELDS, nullptr, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesTimeResponse", LIST_ENTITIES_TIME_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t TIME_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(TimeStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(TimeStateResponse, missing_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(TimeStateResponse, hour), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(TimeStateResponse, minute), 4, ProtoFieldType::UINT32),
+    proto_field(offsetof(TimeStateResponse, second), 5, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump TIME_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"missing_state", nullptr},
+    {"hour", nullptr},
+    {"minute", nullptr},
+    {"second", nullptr},
+};
+#endif
+const ProtoMessageDescriptor TimeStateResponse::DESCRIPTOR PROGMEM = {
+    TIME_STATE_RESPONSE_FIELDS, nullptr, 5,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "TimeStateResponse", TIME_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t TIME_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(TimeCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(TimeCommandRequest, hour), 2, ProtoFieldType::UINT32),
+    proto_field(offsetof(TimeCommandRequest, minute), 3, ProtoFieldType::UINT32),
+    proto_field(offsetof(TimeCommandRequest, second), 4, ProtoFieldType::UINT32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump TIME_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"hour", nullptr},
+    {"minute", nullptr},
+    {"second", nullptr},
+};
+#endif
+const ProtoMessageDescriptor TimeCommandRequest::DESCRIPTOR PROGMEM = {
+    TIME_COMMAND_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "TimeCommandRequest", TIME_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_EVENT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesEventResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesEventResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesEventResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesEventResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesEventResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesEventResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesEventResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesEventResponse, device_class), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesEventResponse, event_types), 9, ProtoFieldType::STRING, true),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_EVENT_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+    {"event_types", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesEventResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_EVENT_RESPONSE_FIELDS, nullptr, 9,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesEventResponse", LIST_ENTITIES_EVENT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t EVENT_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(EventResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(EventResponse, event_type), 2, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump EVENT_RESPONSE_DUMP[] PROGMEM = {{"key", nullptr}, {"event_type", nullptr}};
+#endif
+const ProtoMessageDescriptor EventResponse::DESCRIPTOR PROGMEM = {
+    EVENT_RESPONSE_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "EventResponse", EVENT_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_VALVE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesValveResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesValveResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesValveResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesValveResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesValveResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesValveResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesValveResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesValveResponse, device_class), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesValveResponse, assumed_state), 9, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesValveResponse, supports_position), 10, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesValveResponse, supports_stop), 11, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_VALVE_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+    {"assumed_state", nullptr},
+    {"supports_position", nullptr},
+    {"supports_stop", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesValveResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_VALVE_RESPONSE_FIELDS, nullptr, 11,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesValveResponse", LIST_ENTITIES_VALVE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t VALVE_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ValveStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ValveStateResponse, position), 2, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ValveStateResponse, current_operation), 3, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VALVE_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"position", nullptr},
+    {"current_operation", &proto_enum_name<enums::ValveOperation>},
+};
+#endif
+const ProtoMessageDescriptor ValveStateResponse::DESCRIPTOR PROGMEM = {
+    VALVE_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ValveStateResponse", VALVE_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t VALVE_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ValveCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ValveCommandRequest, has_position), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(ValveCommandRequest, position), 3, ProtoFieldType::FLOAT),
+    proto_field(offsetof(ValveCommandRequest, stop), 4, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump VALVE_COMMAND_REQUEST_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"has_position", nullptr},
+    {"position", nullptr},
+    {"stop", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ValveCommandRequest::DESCRIPTOR PROGMEM = {
+    VALVE_COMMAND_REQUEST_FIELDS, nullptr, 4,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ValveCommandRequest", VALVE_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_DATE_TIME_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesDateTimeResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesDateTimeResponse, entity_category), 7, ProtoFieldType::ENUM),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_DATE_TIME_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesDateTimeResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_DATE_TIME_RESPONSE_FIELDS, nullptr, 7,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesDateTimeResponse", LIST_ENTITIES_DATE_TIME_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t DATE_TIME_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(DateTimeStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(DateTimeStateResponse, missing_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(DateTimeStateResponse, epoch_seconds), 3, ProtoFieldType::FIXED32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump DATE_TIME_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"missing_state", nullptr},
+    {"epoch_seconds", nullptr},
+};
+#endif
+const ProtoMessageDescriptor DateTimeStateResponse::DESCRIPTOR PROGMEM = {
+    DATE_TIME_STATE_RESPONSE_FIELDS, nullptr, 3,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DateTimeStateResponse", DATE_TIME_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t DATE_TIME_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(DateTimeCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(DateTimeCommandRequest, epoch_seconds), 2, ProtoFieldType::FIXED32),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump DATE_TIME_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"epoch_seconds", nullptr}};
+#endif
+const ProtoMessageDescriptor DateTimeCommandRequest::DESCRIPTOR PROGMEM = {
+    DATE_TIME_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "DateTimeCommandRequest", DATE_TIME_COMMAND_REQUEST_DUMP,
+#endif
+};
+static constexpr uint32_t LIST_ENTITIES_UPDATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(ListEntitiesUpdateResponse, object_id), 1, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesUpdateResponse, key), 2, ProtoFieldType::FIXED32),
+    proto_field(offsetof(ListEntitiesUpdateResponse, name), 3, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesUpdateResponse, unique_id), 4, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesUpdateResponse, icon), 5, ProtoFieldType::STRING),
+    proto_field(offsetof(ListEntitiesUpdateResponse, disabled_by_default), 6, ProtoFieldType::BOOL),
+    proto_field(offsetof(ListEntitiesUpdateResponse, entity_category), 7, ProtoFieldType::ENUM),
+    proto_field(offsetof(ListEntitiesUpdateResponse, device_class), 8, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump LIST_ENTITIES_UPDATE_RESPONSE_DUMP[] PROGMEM = {
+    {"object_id", nullptr},
+    {"key", nullptr},
+    {"name", nullptr},
+    {"unique_id", nullptr},
+    {"icon", nullptr},
+    {"disabled_by_default", nullptr},
+    {"entity_category", &proto_enum_name<enums::EntityCategory>},
+    {"device_class", nullptr},
+};
+#endif
+const ProtoMessageDescriptor ListEntitiesUpdateResponse::DESCRIPTOR PROGMEM = {
+    LIST_ENTITIES_UPDATE_RESPONSE_FIELDS, nullptr, 8,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "ListEntitiesUpdateResponse", LIST_ENTITIES_UPDATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t UPDATE_STATE_RESPONSE_FIELDS[] PROGMEM = {
+    proto_field(offsetof(UpdateStateResponse, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(UpdateStateResponse, missing_state), 2, ProtoFieldType::BOOL),
+    proto_field(offsetof(UpdateStateResponse, in_progress), 3, ProtoFieldType::BOOL),
+    proto_field(offsetof(UpdateStateResponse, has_progress), 4, ProtoFieldType::BOOL),
+    proto_field(offsetof(UpdateStateResponse, progress), 5, ProtoFieldType::FLOAT),
+    proto_field(offsetof(UpdateStateResponse, current_version), 6, ProtoFieldType::STRING),
+    proto_field(offsetof(UpdateStateResponse, latest_version), 7, ProtoFieldType::STRING),
+    proto_field(offsetof(UpdateStateResponse, title), 8, ProtoFieldType::STRING),
+    proto_field(offsetof(UpdateStateResponse, release_summary), 9, ProtoFieldType::STRING),
+    proto_field(offsetof(UpdateStateResponse, release_url), 10, ProtoFieldType::STRING),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump UPDATE_STATE_RESPONSE_DUMP[] PROGMEM = {
+    {"key", nullptr},
+    {"missing_state", nullptr},
+    {"in_progress", nullptr},
+    {"has_progress", nullptr},
+    {"progress", nullptr},
+    {"current_version", nullptr},
+    {"latest_version", nullptr},
+    {"title", nullptr},
+    {"release_summary", nullptr},
+    {"release_url", nullptr},
+};
+#endif
+const ProtoMessageDescriptor UpdateStateResponse::DESCRIPTOR PROGMEM = {
+    UPDATE_STATE_RESPONSE_FIELDS, nullptr, 10,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "UpdateStateResponse", UPDATE_STATE_RESPONSE_DUMP,
+#endif
+};
+static constexpr uint32_t UPDATE_COMMAND_REQUEST_FIELDS[] PROGMEM = {
+    proto_field(offsetof(UpdateCommandRequest, key), 1, ProtoFieldType::FIXED32),
+    proto_field(offsetof(UpdateCommandRequest, install), 2, ProtoFieldType::BOOL),
+};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+static const ProtoFieldDump UPDATE_COMMAND_REQUEST_DUMP[] PROGMEM = {{"key", nullptr}, {"install", nullptr}};
+#endif
+const ProtoMessageDescriptor UpdateCommandRequest::DESCRIPTOR PROGMEM = {
+    UPDATE_COMMAND_REQUEST_FIELDS, nullptr, 2,
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    "UpdateCommandRequest", UPDATE_COMMAND_REQUEST_DUMP,
+#endif
+};
 
 }  // namespace api
 }  // namespace esphome
@@ -230,104 +230,54 @@ enum ValveOperation : uint32_t {
 
 }  // namespace enums
 
-class HelloRequest : public ProtoMessage {
+class HelloRequest : public ProtoMessage<HelloRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string client_info{};
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class HelloResponse : public ProtoMessage {
+class HelloResponse : public ProtoMessage<HelloResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
   std::string server_info{};
   std::string name{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ConnectRequest : public ProtoMessage {
+class ConnectRequest : public ProtoMessage<ConnectRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string password{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ConnectResponse : public ProtoMessage {
+class ConnectResponse : public ProtoMessage<ConnectResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool invalid_password{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class DisconnectRequest : public ProtoMessage {
+class DisconnectRequest : public ProtoMessage<DisconnectRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class DisconnectResponse : public ProtoMessage {
+class DisconnectResponse : public ProtoMessage<DisconnectResponse> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class PingRequest : public ProtoMessage {
+class PingRequest : public ProtoMessage<PingRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class PingResponse : public ProtoMessage {
+class PingResponse : public ProtoMessage<PingResponse> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class DeviceInfoRequest : public ProtoMessage {
+class DeviceInfoRequest : public ProtoMessage<DeviceInfoRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class DeviceInfoResponse : public ProtoMessage {
+class DeviceInfoResponse : public ProtoMessage<DeviceInfoResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool uses_password{false};
   std::string name{};
   std::string mac_address{};
@@ -345,44 +295,22 @@ class DeviceInfoResponse : public ProtoMessage {
   uint32_t legacy_voice_assistant_version{0};
   uint32_t voice_assistant_feature_flags{0};
   std::string suggested_area{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesRequest : public ProtoMessage {
+class ListEntitiesRequest : public ProtoMessage<ListEntitiesRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class ListEntitiesDoneResponse : public ProtoMessage {
+class ListEntitiesDoneResponse : public ProtoMessage<ListEntitiesDoneResponse> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class SubscribeStatesRequest : public ProtoMessage {
+class SubscribeStatesRequest : public ProtoMessage<SubscribeStatesRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class ListEntitiesBinarySensorResponse : public ProtoMessage {
+class ListEntitiesBinarySensorResponse : public ProtoMessage<ListEntitiesBinarySensorResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -392,32 +320,17 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BinarySensorStateResponse : public ProtoMessage {
+class BinarySensorStateResponse : public ProtoMessage<BinarySensorStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool state{false};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesCoverResponse : public ProtoMessage {
+class ListEntitiesCoverResponse : public ProtoMessage<ListEntitiesCoverResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -430,34 +343,19 @@ class ListEntitiesCoverResponse : public ProtoMessage {
   std::string icon{};
   enums::EntityCategory entity_category{};
   bool supports_stop{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class CoverStateResponse : public ProtoMessage {
+class CoverStateResponse : public ProtoMessage<CoverStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::LegacyCoverState legacy_state{};
   float position{0.0f};
   float tilt{0.0f};
   enums::CoverOperation current_operation{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class CoverCommandRequest : public ProtoMessage {
+class CoverCommandRequest : public ProtoMessage<CoverCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_legacy_command{false};
   enums::LegacyCoverCommand legacy_command{};
@@ -466,17 +364,10 @@ class CoverCommandRequest : public ProtoMessage {
   bool has_tilt{false};
   float tilt{0.0f};
   bool stop{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesFanResponse : public ProtoMessage {
+class ListEntitiesFanResponse : public ProtoMessage<ListEntitiesFanResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -489,18 +380,10 @@ class ListEntitiesFanResponse : public ProtoMessage {
   std::string icon{};
   enums::EntityCategory entity_category{};
   std::vector<std::string> supported_preset_modes{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class FanStateResponse : public ProtoMessage {
+class FanStateResponse : public ProtoMessage<FanStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool state{false};
   bool oscillating{false};
@@ -508,18 +391,10 @@ class FanStateResponse : public ProtoMessage {
   enums::FanDirection direction{};
   int32_t speed_level{0};
   std::string preset_mode{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class FanCommandRequest : public ProtoMessage {
+class FanCommandRequest : public ProtoMessage<FanCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_state{false};
   bool state{false};
@@ -533,18 +408,10 @@ class FanCommandRequest : public ProtoMessage {
   int32_t speed_level{0};
   bool has_preset_mode{false};
   std::string preset_mode{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesLightResponse : public ProtoMessage {
+class ListEntitiesLightResponse : public ProtoMessage<ListEntitiesLightResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -560,18 +427,10 @@ class ListEntitiesLightResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class LightStateResponse : public ProtoMessage {
+class LightStateResponse : public ProtoMessage<LightStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool state{false};
   float brightness{0.0f};
@@ -585,18 +444,10 @@ class LightStateResponse : public ProtoMessage {
   float cold_white{0.0f};
   float warm_white{0.0f};
   std::string effect{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class LightCommandRequest : public ProtoMessage {
+class LightCommandRequest : public ProtoMessage<LightCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_state{false};
   bool state{false};
@@ -624,18 +475,10 @@ class LightCommandRequest : public ProtoMessage {
   uint32_t flash_length{0};
   bool has_effect{false};
   std::string effect{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesSensorResponse : public ProtoMessage {
+class ListEntitiesSensorResponse : public ProtoMessage<ListEntitiesSensorResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -649,32 +492,17 @@ class ListEntitiesSensorResponse : public ProtoMessage {
   enums::SensorLastResetType legacy_last_reset_type{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SensorStateResponse : public ProtoMessage {
+class SensorStateResponse : public ProtoMessage<SensorStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesSwitchResponse : public ProtoMessage {
+class ListEntitiesSwitchResponse : public ProtoMessage<ListEntitiesSwitchResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -684,44 +512,22 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SwitchStateResponse : public ProtoMessage {
+class SwitchStateResponse : public ProtoMessage<SwitchStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SwitchCommandRequest : public ProtoMessage {
+class SwitchCommandRequest : public ProtoMessage<SwitchCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesTextSensorResponse : public ProtoMessage {
+class ListEntitiesTextSensorResponse : public ProtoMessage<ListEntitiesTextSensorResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -730,211 +536,107 @@ class ListEntitiesTextSensorResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class TextSensorStateResponse : public ProtoMessage {
+class TextSensorStateResponse : public ProtoMessage<TextSensorStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeLogsRequest : public ProtoMessage {
+class SubscribeLogsRequest : public ProtoMessage<SubscribeLogsRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   enums::LogLevel level{};
   bool dump_config{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeLogsResponse : public ProtoMessage {
+class SubscribeLogsResponse : public ProtoMessage<SubscribeLogsResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   enums::LogLevel level{};
   std::string message{};
   bool send_failed{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeHomeassistantServicesRequest : public ProtoMessage {
+class SubscribeHomeassistantServicesRequest : public ProtoMessage<SubscribeHomeassistantServicesRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class HomeassistantServiceMap : public ProtoMessage {
+class HomeassistantServiceMap : public ProtoMessage<HomeassistantServiceMap> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string key{};
   std::string value{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class HomeassistantServiceResponse : public ProtoMessage {
+class HomeassistantServiceResponse : public ProtoMessage<HomeassistantServiceResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string service{};
   std::vector<HomeassistantServiceMap> data{};
   std::vector<HomeassistantServiceMap> data_template{};
   std::vector<HomeassistantServiceMap> variables{};
   bool is_event{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
+class SubscribeHomeAssistantStatesRequest : public ProtoMessage<SubscribeHomeAssistantStatesRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class SubscribeHomeAssistantStateResponse : public ProtoMessage {
+class SubscribeHomeAssistantStateResponse : public ProtoMessage<SubscribeHomeAssistantStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string entity_id{};
   std::string attribute{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class HomeAssistantStateResponse : public ProtoMessage {
+class HomeAssistantStateResponse : public ProtoMessage<HomeAssistantStateResponse> {
  public:
-  std::string entity_id{};
-  std::string state{};
-  std::string attribute{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  static const ProtoMessageDescriptor DESCRIPTOR;
+  StringRef entity_id{};
+  StringRef state{};
+  StringRef attribute{};
 };
-class GetTimeRequest : public ProtoMessage {
+class GetTimeRequest : public ProtoMessage<GetTimeRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class GetTimeResponse : public ProtoMessage {
+class GetTimeResponse : public ProtoMessage<GetTimeResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t epoch_seconds{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
 };
-class ListEntitiesServicesArgument : public ProtoMessage {
+class ListEntitiesServicesArgument : public ProtoMessage<ListEntitiesServicesArgument> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string name{};
   enums::ServiceArgType type{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesServicesResponse : public ProtoMessage {
+class ListEntitiesServicesResponse : public ProtoMessage<ListEntitiesServicesResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string name{};
   uint32_t key{0};
   std::vector<ListEntitiesServicesArgument> args{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ExecuteServiceArgument : public ProtoMessage {
+class ExecuteServiceArgument : public ProtoMessage<ExecuteServiceArgument> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool bool_{false};
   int32_t legacy_int{0};
   float float_{0.0f};
-  std::string string_{};
+  StringRef string_{};
   int32_t int_{0};
   std::vector<bool> bool_array{};
   std::vector<int32_t> int_array{};
   std::vector<float> float_array{};
   std::vector<std::string> string_array{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ExecuteServiceRequest : public ProtoMessage {
+class ExecuteServiceRequest : public ProtoMessage<ExecuteServiceRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::vector<ExecuteServiceArgument> args{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ListEntitiesCameraResponse : public ProtoMessage {
+class ListEntitiesCameraResponse : public ProtoMessage<ListEntitiesCameraResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -942,45 +644,23 @@ class ListEntitiesCameraResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class CameraImageResponse : public ProtoMessage {
+class CameraImageResponse : public ProtoMessage<CameraImageResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string data{};
   bool done{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class CameraImageRequest : public ProtoMessage {
+class CameraImageRequest : public ProtoMessage<CameraImageRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool single{false};
   bool stream{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesClimateResponse : public ProtoMessage {
+class ListEntitiesClimateResponse : public ProtoMessage<ListEntitiesClimateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1006,18 +686,10 @@ class ListEntitiesClimateResponse : public ProtoMessage {
   bool supports_target_humidity{false};
   float visual_min_humidity{0.0f};
   float visual_max_humidity{0.0f};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ClimateStateResponse : public ProtoMessage {
+class ClimateStateResponse : public ProtoMessage<ClimateStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::ClimateMode mode{};
   float current_temperature{0.0f};
@@ -1033,18 +705,10 @@ class ClimateStateResponse : public ProtoMessage {
   std::string custom_preset{};
   float current_humidity{0.0f};
   float target_humidity{0.0f};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ClimateCommandRequest : public ProtoMessage {
+class ClimateCommandRequest : public ProtoMessage<ClimateCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_mode{false};
   enums::ClimateMode mode{};
@@ -1068,18 +732,10 @@ class ClimateCommandRequest : public ProtoMessage {
   std::string custom_preset{};
   bool has_target_humidity{false};
   float target_humidity{0.0f};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesNumberResponse : public ProtoMessage {
+class ListEntitiesNumberResponse : public ProtoMessage<ListEntitiesNumberResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1093,44 +749,23 @@ class ListEntitiesNumberResponse : public ProtoMessage {
   std::string unit_of_measurement{};
   enums::NumberMode mode{};
   std::string device_class{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class NumberStateResponse : public ProtoMessage {
+class NumberStateResponse : public ProtoMessage<NumberStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class NumberCommandRequest : public ProtoMessage {
+class NumberCommandRequest : public ProtoMessage<NumberCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   float state{0.0f};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
 };
-class ListEntitiesSelectResponse : public ProtoMessage {
+class ListEntitiesSelectResponse : public ProtoMessage<ListEntitiesSelectResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1139,46 +774,23 @@ class ListEntitiesSelectResponse : public ProtoMessage {
   std::vector<std::string> options{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SelectStateResponse : public ProtoMessage {
+class SelectStateResponse : public ProtoMessage<SelectStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SelectCommandRequest : public ProtoMessage {
+class SelectCommandRequest : public ProtoMessage<SelectCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string state{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ListEntitiesLockResponse : public ProtoMessage {
+class ListEntitiesLockResponse : public ProtoMessage<ListEntitiesLockResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1190,47 +802,24 @@ class ListEntitiesLockResponse : public ProtoMessage {
   bool supports_open{false};
   bool requires_code{false};
   std::string code_format{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class LockStateResponse : public ProtoMessage {
+class LockStateResponse : public ProtoMessage<LockStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::LockState state{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class LockCommandRequest : public ProtoMessage {
+class LockCommandRequest : public ProtoMessage<LockCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::LockCommand command{};
   bool has_code{false};
   std::string code{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesButtonResponse : public ProtoMessage {
+class ListEntitiesButtonResponse : public ProtoMessage<ListEntitiesButtonResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1239,29 +828,15 @@ class ListEntitiesButtonResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ButtonCommandRequest : public ProtoMessage {
+class ButtonCommandRequest : public ProtoMessage<ButtonCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
 };
-class ListEntitiesMediaPlayerResponse : public ProtoMessage {
+class ListEntitiesMediaPlayerResponse : public ProtoMessage<ListEntitiesMediaPlayerResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1270,33 +845,18 @@ class ListEntitiesMediaPlayerResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   bool supports_pause{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class MediaPlayerStateResponse : public ProtoMessage {
+class MediaPlayerStateResponse : public ProtoMessage<MediaPlayerStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::MediaPlayerState state{};
   float volume{0.0f};
   bool muted{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class MediaPlayerCommandRequest : public ProtoMessage {
+class MediaPlayerCommandRequest : public ProtoMessage<MediaPlayerCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_command{false};
   enums::MediaPlayerCommand command{};
@@ -1306,43 +866,22 @@ class MediaPlayerCommandRequest : public ProtoMessage {
   std::string media_url{};
   bool has_announcement{false};
   bool announcement{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
+class SubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage<SubscribeBluetoothLEAdvertisementsRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t flags{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothServiceData : public ProtoMessage {
+class BluetoothServiceData : public ProtoMessage<BluetoothServiceData> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string uuid{};
   std::vector<uint32_t> legacy_data{};
   std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothLEAdvertisementResponse : public ProtoMessage {
+class BluetoothLEAdvertisementResponse : public ProtoMessage<BluetoothLEAdvertisementResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   std::string name{};
   int32_t rssi{0};
@@ -1350,456 +889,234 @@ class BluetoothLEAdvertisementResponse : public ProtoMessage {
   std::vector<BluetoothServiceData> service_data{};
   std::vector<BluetoothServiceData> manufacturer_data{};
   uint32_t address_type{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothLERawAdvertisement : public ProtoMessage {
+class BluetoothLERawAdvertisement : public ProtoMessage<BluetoothLERawAdvertisement> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   int32_t rssi{0};
   uint32_t address_type{0};
   std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothLERawAdvertisementsResponse : public ProtoMessage {
+class BluetoothLERawAdvertisementsResponse : public ProtoMessage<BluetoothLERawAdvertisementsResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::vector<BluetoothLERawAdvertisement> advertisements{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class BluetoothDeviceRequest : public ProtoMessage {
+class BluetoothDeviceRequest : public ProtoMessage<BluetoothDeviceRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   enums::BluetoothDeviceRequestType request_type{};
   bool has_address_type{false};
   uint32_t address_type{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothDeviceConnectionResponse : public ProtoMessage {
+class BluetoothDeviceConnectionResponse : public ProtoMessage<BluetoothDeviceConnectionResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   bool connected{false};
   uint32_t mtu{0};
   int32_t error{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTGetServicesRequest : public ProtoMessage {
+class BluetoothGATTGetServicesRequest : public ProtoMessage<BluetoothGATTGetServicesRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTDescriptor : public ProtoMessage {
+class BluetoothGATTDescriptor : public ProtoMessage<BluetoothGATTDescriptor> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::vector<uint64_t> uuid{};
   uint32_t handle{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTCharacteristic : public ProtoMessage {
+class BluetoothGATTCharacteristic : public ProtoMessage<BluetoothGATTCharacteristic> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::vector<uint64_t> uuid{};
   uint32_t handle{0};
   uint32_t properties{0};
   std::vector<BluetoothGATTDescriptor> descriptors{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTService : public ProtoMessage {
+class BluetoothGATTService : public ProtoMessage<BluetoothGATTService> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::vector<uint64_t> uuid{};
   uint32_t handle{0};
   std::vector<BluetoothGATTCharacteristic> characteristics{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTGetServicesResponse : public ProtoMessage {
+class BluetoothGATTGetServicesResponse : public ProtoMessage<BluetoothGATTGetServicesResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   std::vector<BluetoothGATTService> services{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTGetServicesDoneResponse : public ProtoMessage {
+class BluetoothGATTGetServicesDoneResponse : public ProtoMessage<BluetoothGATTGetServicesDoneResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTReadRequest : public ProtoMessage {
+class BluetoothGATTReadRequest : public ProtoMessage<BluetoothGATTReadRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTReadResponse : public ProtoMessage {
+class BluetoothGATTReadResponse : public ProtoMessage<BluetoothGATTReadResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTWriteRequest : public ProtoMessage {
+class BluetoothGATTWriteRequest : public ProtoMessage<BluetoothGATTWriteRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
   bool response{false};
-  std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+  StringRef data{};
 };
-class BluetoothGATTReadDescriptorRequest : public ProtoMessage {
+class BluetoothGATTReadDescriptorRequest : public ProtoMessage<BluetoothGATTReadDescriptorRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTWriteDescriptorRequest : public ProtoMessage {
+class BluetoothGATTWriteDescriptorRequest : public ProtoMessage<BluetoothGATTWriteDescriptorRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
-  std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+  StringRef data{};
 };
-class BluetoothGATTNotifyRequest : public ProtoMessage {
+class BluetoothGATTNotifyRequest : public ProtoMessage<BluetoothGATTNotifyRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
   bool enable{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTNotifyDataResponse : public ProtoMessage {
+class BluetoothGATTNotifyDataResponse : public ProtoMessage<BluetoothGATTNotifyDataResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeBluetoothConnectionsFreeRequest : public ProtoMessage {
+class SubscribeBluetoothConnectionsFreeRequest : public ProtoMessage<SubscribeBluetoothConnectionsFreeRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class BluetoothConnectionsFreeResponse : public ProtoMessage {
+class BluetoothConnectionsFreeResponse : public ProtoMessage<BluetoothConnectionsFreeResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t free{0};
   uint32_t limit{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTErrorResponse : public ProtoMessage {
+class BluetoothGATTErrorResponse : public ProtoMessage<BluetoothGATTErrorResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
   int32_t error{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTWriteResponse : public ProtoMessage {
+class BluetoothGATTWriteResponse : public ProtoMessage<BluetoothGATTWriteResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothGATTNotifyResponse : public ProtoMessage {
+class BluetoothGATTNotifyResponse : public ProtoMessage<BluetoothGATTNotifyResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   uint32_t handle{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothDevicePairingResponse : public ProtoMessage {
+class BluetoothDevicePairingResponse : public ProtoMessage<BluetoothDevicePairingResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   bool paired{false};
   int32_t error{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class BluetoothDeviceUnpairingResponse : public ProtoMessage {
+class BluetoothDeviceUnpairingResponse : public ProtoMessage<BluetoothDeviceUnpairingResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   bool success{false};
   int32_t error{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class UnsubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
+class UnsubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage<UnsubscribeBluetoothLEAdvertisementsRequest> {
  public:
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
+  static const ProtoMessageDescriptor DESCRIPTOR;
 };
-class BluetoothDeviceClearCacheResponse : public ProtoMessage {
+class BluetoothDeviceClearCacheResponse : public ProtoMessage<BluetoothDeviceClearCacheResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint64_t address{0};
   bool success{false};
   int32_t error{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class SubscribeVoiceAssistantRequest : public ProtoMessage {
+class SubscribeVoiceAssistantRequest : public ProtoMessage<SubscribeVoiceAssistantRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool subscribe{false};
   uint32_t flags{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantAudioSettings : public ProtoMessage {
+class VoiceAssistantAudioSettings : public ProtoMessage<VoiceAssistantAudioSettings> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t noise_suppression_level{0};
   uint32_t auto_gain{0};
   float volume_multiplier{0.0f};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantRequest : public ProtoMessage {
+class VoiceAssistantRequest : public ProtoMessage<VoiceAssistantRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   bool start{false};
   std::string conversation_id{};
   uint32_t flags{0};
   VoiceAssistantAudioSettings audio_settings{};
   std::string wake_word_phrase{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantResponse : public ProtoMessage {
+class VoiceAssistantResponse : public ProtoMessage<VoiceAssistantResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t port{0};
   bool error{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantEventData : public ProtoMessage {
+class VoiceAssistantEventData : public ProtoMessage<VoiceAssistantEventData> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string name{};
   std::string value{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class VoiceAssistantEventResponse : public ProtoMessage {
+class VoiceAssistantEventResponse : public ProtoMessage<VoiceAssistantEventResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   enums::VoiceAssistantEvent event_type{};
   std::vector<VoiceAssistantEventData> data{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantAudio : public ProtoMessage {
+class VoiceAssistantAudio : public ProtoMessage<VoiceAssistantAudio> {
  public:
-  std::string data{};
+  static const ProtoMessageDescriptor DESCRIPTOR;
+  StringRef data{};
   bool end{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class VoiceAssistantTimerEventResponse : public ProtoMessage {
+class VoiceAssistantTimerEventResponse : public ProtoMessage<VoiceAssistantTimerEventResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   enums::VoiceAssistantTimerEvent event_type{};
   std::string timer_id{};
   std::string name{};
   uint32_t total_seconds{0};
   uint32_t seconds_left{0};
   bool is_active{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesAlarmControlPanelResponse : public ProtoMessage {
+class ListEntitiesAlarmControlPanelResponse : public ProtoMessage<ListEntitiesAlarmControlPanelResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1810,46 +1127,23 @@ class ListEntitiesAlarmControlPanelResponse : public ProtoMessage {
   uint32_t supported_features{0};
   bool requires_code{false};
   bool requires_code_to_arm{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class AlarmControlPanelStateResponse : public ProtoMessage {
+class AlarmControlPanelStateResponse : public ProtoMessage<AlarmControlPanelStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::AlarmControlPanelState state{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class AlarmControlPanelCommandRequest : public ProtoMessage {
+class AlarmControlPanelCommandRequest : public ProtoMessage<AlarmControlPanelCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   enums::AlarmControlPanelStateCommand command{};
   std::string code{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesTextResponse : public ProtoMessage {
+class ListEntitiesTextResponse : public ProtoMessage<ListEntitiesTextResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1861,46 +1155,23 @@ class ListEntitiesTextResponse : public ProtoMessage {
   uint32_t max_length{0};
   std::string pattern{};
   enums::TextMode mode{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class TextStateResponse : public ProtoMessage {
+class TextStateResponse : public ProtoMessage<TextStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class TextCommandRequest : public ProtoMessage {
+class TextCommandRequest : public ProtoMessage<TextCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string state{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ListEntitiesDateResponse : public ProtoMessage {
+class ListEntitiesDateResponse : public ProtoMessage<ListEntitiesDateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1908,49 +1179,27 @@ class ListEntitiesDateResponse : public ProtoMessage {
   std::string icon{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class DateStateResponse : public ProtoMessage {
+class DateStateResponse : public ProtoMessage<DateStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t year{0};
   uint32_t month{0};
   uint32_t day{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class DateCommandRequest : public ProtoMessage {
+class DateCommandRequest : public ProtoMessage<DateCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   uint32_t year{0};
   uint32_t month{0};
   uint32_t day{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesTimeResponse : public ProtoMessage {
+class ListEntitiesTimeResponse : public ProtoMessage<ListEntitiesTimeResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1958,49 +1207,27 @@ class ListEntitiesTimeResponse : public ProtoMessage {
   std::string icon{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class TimeStateResponse : public ProtoMessage {
+class TimeStateResponse : public ProtoMessage<TimeStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t hour{0};
   uint32_t minute{0};
   uint32_t second{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class TimeCommandRequest : public ProtoMessage {
+class TimeCommandRequest : public ProtoMessage<TimeCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   uint32_t hour{0};
   uint32_t minute{0};
   uint32_t second{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesEventResponse : public ProtoMessage {
+class ListEntitiesEventResponse : public ProtoMessage<ListEntitiesEventResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2010,31 +1237,16 @@ class ListEntitiesEventResponse : public ProtoMessage {
   enums::EntityCategory entity_category{};
   std::string device_class{};
   std::vector<std::string> event_types{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class EventResponse : public ProtoMessage {
+class EventResponse : public ProtoMessage<EventResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   std::string event_type{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
 };
-class ListEntitiesValveResponse : public ProtoMessage {
+class ListEntitiesValveResponse : public ProtoMessage<ListEntitiesValveResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2046,47 +1258,25 @@ class ListEntitiesValveResponse : public ProtoMessage {
   bool assumed_state{false};
   bool supports_position{false};
   bool supports_stop{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ValveStateResponse : public ProtoMessage {
+class ValveStateResponse : public ProtoMessage<ValveStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   float position{0.0f};
   enums::ValveOperation current_operation{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ValveCommandRequest : public ProtoMessage {
+class ValveCommandRequest : public ProtoMessage<ValveCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool has_position{false};
   float position{0.0f};
   bool stop{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class ListEntitiesDateTimeResponse : public ProtoMessage {
+class ListEntitiesDateTimeResponse : public ProtoMessage<ListEntitiesDateTimeResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2094,44 +1284,23 @@ class ListEntitiesDateTimeResponse : public ProtoMessage {
   std::string icon{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class DateTimeStateResponse : public ProtoMessage {
+class DateTimeStateResponse : public ProtoMessage<DateTimeStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t epoch_seconds{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class DateTimeCommandRequest : public ProtoMessage {
+class DateTimeCommandRequest : public ProtoMessage<DateTimeCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   uint32_t epoch_seconds{0};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
 };
-class ListEntitiesUpdateResponse : public ProtoMessage {
+class ListEntitiesUpdateResponse : public ProtoMessage<ListEntitiesUpdateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2140,18 +1309,10 @@ class ListEntitiesUpdateResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class UpdateStateResponse : public ProtoMessage {
+class UpdateStateResponse : public ProtoMessage<UpdateStateResponse> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool missing_state{false};
   bool in_progress{false};
@@ -2162,28 +1323,12 @@ class UpdateStateResponse : public ProtoMessage {
   std::string title{};
   std::string release_summary{};
   std::string release_url{};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
-class UpdateCommandRequest : public ProtoMessage {
+class UpdateCommandRequest : public ProtoMessage<UpdateCommandRequest> {
  public:
+  static const ProtoMessageDescriptor DESCRIPTOR;
   uint32_t key{0};
   bool install{false};
-  void encode(ProtoWriteBuffer buffer) const override;
-#ifdef HAS_PROTO_MESSAGE_DUMP
-  void dump_to(std::string &out) const override;
-#endif
-
- protected:
-  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
-  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
 
 }  // namespace api
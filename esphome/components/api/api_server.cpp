@@ -1,5 +1,6 @@
 #include "api_server.h"
 #include <cerrno>
+#include <cinttypes>
 #include "api_connection.h"
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -68,12 +69,14 @@ void APIServer::setup() {
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
-      for (auto &c : this->clients_) {
-        if (!c->remove_)
-          c->send_log_message(level, tag, message);
-      }
-    });
+    logger::global_logger->add_on_log_callback(
+        [this](int level, const char *tag, const char *message) {
+          for (auto &c : this->clients_) {
+            if (!c->remove_)
+              c->send_log_message(level, tag, message);
+          }
+        },
+        &this->log_level_);
   }
 #endif
 
@@ -104,6 +107,8 @@ void APIServer::loop() {
     auto *conn = new APIConnection(std::move(sock), this);
     clients_.emplace_back(conn);
     conn->start();
+    // The loop checks the reboot timeout again while there are clients
+    this->cancel_timeout("reboot");
   }
 
   // Partition clients into remove and active
@@ -115,7 +120,12 @@ void APIServer::loop() {
     ESP_LOGV(TAG, "Removing connection to %s", (*it)->client_info_.c_str());
   }
   // resize vector
-  this->clients_.erase(new_end, this->clients_.end());
+  if (new_end != this->clients_.end()) {
+    this->clients_.erase(new_end, this->clients_.end());
+#ifdef USE_LOGGER
+    this->update_log_level();
+#endif
+  }
 
   for (auto &client : this->clients_) {
     client->loop();
@@ -134,10 +144,29 @@ void APIServer::loop() {
       this->status_clear_warning();
     }
   }
+
+  if (this->clients_.empty() && !this->poll_listen_socket_) {
+    // Nothing to do until a client connects: sleep until the listening socket becomes readable.
+    this->disable_loop();
+    if (!socket::wake_on_readable(this->socket_.get(), this)) {
+      // No socket watcher on this platform, keep polling for new connections
+      this->poll_listen_socket_ = true;
+      this->enable_loop();
+    } else if (this->reboot_timeout_ != 0) {
+      const uint32_t elapsed = millis() - this->last_connected_;
+      const uint32_t remaining = elapsed < this->reboot_timeout_ ? this->reboot_timeout_ - elapsed : 0;
+      this->set_timeout("reboot", remaining + 1, []() {
+        ESP_LOGE(TAG, "No client connected to API. Rebooting...");
+        App.reboot();
+      });
+    }
+  }
 }
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Batch delay: %ums", this->batch_delay_);
+  ESP_LOGCONFIG(TAG, "  TX buffer size: %" PRIu32 " bytes", this->tx_buffer_size_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -374,6 +403,14 @@ void APIServer::request_time() {
   }
 }
 #endif
+#ifdef USE_LOGGER
+void APIServer::update_log_level() {
+  int level = ESPHOME_LOG_LEVEL_NONE;
+  for (auto &client : this->clients_)
+    level = std::max(level, client->log_subscription_);
+  this->log_level_ = level;
+}
+#endif
 bool APIServer::is_connected() const { return !this->clients_.empty(); }
 void APIServer::on_shutdown() {
   for (auto &c : this->clients_) {
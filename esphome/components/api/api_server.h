@@ -32,6 +32,11 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /// Set how long state updates may be held back to be sent together with others, 0 sends them every loop.
+  void set_batch_delay(uint16_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint16_t get_batch_delay() const { return this->batch_delay_; }
+  void set_tx_buffer_size(uint32_t tx_buffer_size) { this->tx_buffer_size_ = tx_buffer_size; }
+  uint32_t get_tx_buffer_size() const { return this->tx_buffer_size_; }
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -107,6 +112,10 @@ class APIServer : public Component, public Controller {
 #endif
 
   bool is_connected() const;
+#ifdef USE_LOGGER
+  /// Recompute the most verbose log level a client subscribed to, after a subscription changed.
+  void update_log_level();
+#endif
 
   struct HomeAssistantStateSubscription {
     std::string entity_id;
@@ -129,6 +138,14 @@ class APIServer : public Component, public Controller {
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
   uint32_t last_connected_{0};
+  uint16_t batch_delay_{10};
+  /// Set when the listening socket cannot be watched, so the loop has to keep polling it for new connections.
+  bool poll_listen_socket_{false};
+  uint32_t tx_buffer_size_{4096};
+#ifdef USE_LOGGER
+  /// Most verbose log level of all clients, messages above it are not formatted for the API.
+  int log_level_{ESPHOME_LOG_LEVEL_NONE};
+#endif
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
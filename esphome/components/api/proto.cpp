@@ -1,5 +1,6 @@
 #include "proto.h"
 #include <cinttypes>
+#include <cstring>
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -7,7 +8,324 @@ namespace api {
 
 static const char *const TAG = "api.proto";
 
-void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
+static inline uint32_t field_offset(uint32_t field) { return field & 0xFFFF; }
+static inline uint32_t field_number(uint32_t field) { return (field >> 16) & 0x7F; }
+static inline ProtoFieldType field_type(uint32_t field) { return static_cast<ProtoFieldType>((field >> 23) & 0x1F); }
+static inline bool field_repeated(uint32_t field) { return (field >> 28) & 0x01; }
+static inline const ProtoFieldOps *field_ops(const ProtoMessageDescriptor &desc, uint32_t field) {
+  return desc.ops[field >> 29];
+}
+
+template<typename T, typename F> static void for_each_element(const void *vec, ProtoFieldType type, F &&func) {
+  for (const T &it : *static_cast<const std::vector<T> *>(vec))
+    func(type, &it, true);
+}
+
+/** Call \p func with the type, a pointer to the value and whether to encode it even if it has the default value,
+ * for every value of \p field. That is once for a singular field, once per element for a repeated one.
+ */
+template<typename F>
+static void for_each_value(const ProtoMessageDescriptor &desc, uint32_t field, const uint8_t *base, F &&func) {
+  const void *member = base + field_offset(field);
+  ProtoFieldType type = field_type(field);
+  if (!field_repeated(field)) {
+    func(type, member, false);
+    return;
+  }
+  switch (type) {
+    case ProtoFieldType::BOOL:
+      // std::vector<bool> has no addressable elements
+      for (bool it : *static_cast<const std::vector<bool> *>(member))
+        func(type, &it, true);
+      break;
+    case ProtoFieldType::INT32:
+    case ProtoFieldType::SINT32:
+      for_each_element<int32_t>(member, type, func);
+      break;
+    case ProtoFieldType::UINT32:
+    case ProtoFieldType::FIXED32:
+      for_each_element<uint32_t>(member, type, func);
+      break;
+    case ProtoFieldType::INT64:
+    case ProtoFieldType::SINT64:
+      for_each_element<int64_t>(member, type, func);
+      break;
+    case ProtoFieldType::UINT64:
+    case ProtoFieldType::FIXED64:
+      for_each_element<uint64_t>(member, type, func);
+      break;
+    case ProtoFieldType::FLOAT:
+      for_each_element<float>(member, type, func);
+      break;
+    case ProtoFieldType::STRING:
+      for_each_element<std::string>(member, type, func);
+      break;
+    case ProtoFieldType::STRING_REF:
+      for_each_element<StringRef>(member, type, func);
+      break;
+    case ProtoFieldType::ENUM: {
+      const ProtoFieldOps *ops = field_ops(desc, field);
+      size_t size = ops->size(member);
+      for (size_t i = 0; i < size; i++) {
+        uint32_t value = ops->enum_at(member, i);
+        func(type, &value, true);
+      }
+      break;
+    }
+    case ProtoFieldType::MESSAGE: {
+      const ProtoFieldOps *ops = field_ops(desc, field);
+      size_t size = ops->size(member);
+      for (size_t i = 0; i < size; i++)
+        func(type, ops->message_at(member, i), true);
+      break;
+    }
+  }
+}
+
+/// \p nested is the descriptor of the message type for message fields.
+static void encode_value(ProtoWriteBuffer &buffer, uint32_t field_id, ProtoFieldType type, const void *value,
+                         bool force, const ProtoMessageDescriptor *nested) {
+  switch (type) {
+    case ProtoFieldType::BOOL:
+      buffer.encode_bool(field_id, *static_cast<const bool *>(value), force);
+      break;
+    case ProtoFieldType::INT32:
+      buffer.encode_int32(field_id, *static_cast<const int32_t *>(value), force);
+      break;
+    case ProtoFieldType::UINT32:
+      buffer.encode_uint32(field_id, *static_cast<const uint32_t *>(value), force);
+      break;
+    case ProtoFieldType::SINT32:
+      buffer.encode_sint32(field_id, *static_cast<const int32_t *>(value), force);
+      break;
+    case ProtoFieldType::INT64:
+      buffer.encode_int64(field_id, *static_cast<const int64_t *>(value), force);
+      break;
+    case ProtoFieldType::UINT64:
+      buffer.encode_uint64(field_id, *static_cast<const uint64_t *>(value), force);
+      break;
+    case ProtoFieldType::SINT64:
+      buffer.encode_sint64(field_id, *static_cast<const int64_t *>(value), force);
+      break;
+    case ProtoFieldType::FIXED32:
+      buffer.encode_fixed32(field_id, *static_cast<const uint32_t *>(value), force);
+      break;
+    case ProtoFieldType::FIXED64:
+      buffer.encode_fixed64(field_id, *static_cast<const uint64_t *>(value), force);
+      break;
+    case ProtoFieldType::FLOAT:
+      buffer.encode_float(field_id, *static_cast<const float *>(value), force);
+      break;
+    case ProtoFieldType::ENUM: {
+      uint32_t raw;
+      memcpy(&raw, value, sizeof(raw));
+      buffer.encode_uint32(field_id, raw, force);
+      break;
+    }
+    case ProtoFieldType::STRING:
+      buffer.encode_string(field_id, *static_cast<const std::string *>(value), force);
+      break;
+    case ProtoFieldType::STRING_REF:
+      buffer.encode_string(field_id, *static_cast<const StringRef *>(value), force);
+      break;
+    case ProtoFieldType::MESSAGE: {
+      buffer.encode_field_raw(field_id, 2);
+      uint32_t nested_length = 0;
+      proto_calculate_size(*nested, value, nested_length);
+      buffer.encode_varint_raw(nested_length);
+      proto_encode(*nested, value, buffer);
+      break;
+    }
+  }
+}
+
+static void add_value_size(uint32_t &total_size, uint32_t field_id_size, ProtoFieldType type, const void *value,
+                           bool force, const ProtoMessageDescriptor *nested) {
+  switch (type) {
+    case ProtoFieldType::BOOL:
+      ProtoSize::add_bool_field(total_size, field_id_size, *static_cast<const bool *>(value), force);
+      break;
+    case ProtoFieldType::INT32:
+      ProtoSize::add_int32_field(total_size, field_id_size, *static_cast<const int32_t *>(value), force);
+      break;
+    case ProtoFieldType::UINT32:
+      ProtoSize::add_uint32_field(total_size, field_id_size, *static_cast<const uint32_t *>(value), force);
+      break;
+    case ProtoFieldType::SINT32:
+      ProtoSize::add_sint32_field(total_size, field_id_size, *static_cast<const int32_t *>(value), force);
+      break;
+    case ProtoFieldType::INT64:
+      ProtoSize::add_int64_field(total_size, field_id_size, *static_cast<const int64_t *>(value), force);
+      break;
+    case ProtoFieldType::UINT64:
+      ProtoSize::add_uint64_field(total_size, field_id_size, *static_cast<const uint64_t *>(value), force);
+      break;
+    case ProtoFieldType::SINT64:
+      ProtoSize::add_sint64_field(total_size, field_id_size, *static_cast<const int64_t *>(value), force);
+      break;
+    case ProtoFieldType::FIXED32:
+      ProtoSize::add_fixed32_field(total_size, field_id_size, *static_cast<const uint32_t *>(value), force);
+      break;
+    case ProtoFieldType::FIXED64:
+      ProtoSize::add_fixed64_field(total_size, field_id_size, *static_cast<const uint64_t *>(value), force);
+      break;
+    case ProtoFieldType::FLOAT:
+      ProtoSize::add_float_field(total_size, field_id_size, *static_cast<const float *>(value), force);
+      break;
+    case ProtoFieldType::ENUM: {
+      uint32_t raw;
+      memcpy(&raw, value, sizeof(raw));
+      ProtoSize::add_uint32_field(total_size, field_id_size, raw, force);
+      break;
+    }
+    case ProtoFieldType::STRING:
+      ProtoSize::add_string_field(total_size, field_id_size, *static_cast<const std::string *>(value), force);
+      break;
+    case ProtoFieldType::STRING_REF:
+      ProtoSize::add_string_field(total_size, field_id_size, *static_cast<const StringRef *>(value), force);
+      break;
+    case ProtoFieldType::MESSAGE: {
+      uint32_t nested_size = 0;
+      proto_calculate_size(*nested, value, nested_size);
+      total_size += field_id_size + ProtoSize::varint(nested_size) + nested_size;
+      break;
+    }
+  }
+}
+
+/// Store a decoded value in a singular field, or append it to a repeated one.
+template<typename T> static bool store_value(void *member, bool repeated, T value) {
+  if (repeated) {
+    static_cast<std::vector<T> *>(member)->push_back(std::move(value));
+  } else {
+    *static_cast<T *>(member) = std::move(value);
+  }
+  return true;
+}
+
+/// Descriptor of the message type of \p field, nullptr if it is not a message field.
+static const ProtoMessageDescriptor *nested_message(const ProtoMessageDescriptor &desc, uint32_t field) {
+  if (field_type(field) != ProtoFieldType::MESSAGE)
+    return nullptr;
+  return field_ops(desc, field)->message;
+}
+
+void proto_encode(const ProtoMessageDescriptor &desc, const void *msg, ProtoWriteBuffer &buffer) {
+  const uint8_t *base = static_cast<const uint8_t *>(msg);
+  for (uint32_t i = 0; i < desc.field_count; i++) {
+    const uint32_t field = desc.fields[i];
+    const uint32_t field_id = field_number(field);
+    const ProtoMessageDescriptor *nested = nested_message(desc, field);
+    for_each_value(desc, field, base,
+                   [&buffer, field_id, nested](ProtoFieldType type, const void *value, bool force) {
+                     encode_value(buffer, field_id, type, value, force, nested);
+                   });
+  }
+}
+
+void proto_calculate_size(const ProtoMessageDescriptor &desc, const void *msg, uint32_t &total_size) {
+  const uint8_t *base = static_cast<const uint8_t *>(msg);
+  for (uint32_t i = 0; i < desc.field_count; i++) {
+    const uint32_t field = desc.fields[i];
+    // The wire type doesn't change the size of the key
+    const uint32_t field_id_size = ProtoSize::varint(field_number(field) << 3);
+    const ProtoMessageDescriptor *nested = nested_message(desc, field);
+    for_each_value(desc, field, base,
+                   [&total_size, field_id_size, nested](ProtoFieldType type, const void *value, bool force) {
+                     add_value_size(total_size, field_id_size, type, value, force, nested);
+                   });
+  }
+}
+
+/// Find the descriptor word of field \p field_id, returns false if the message has no such field.
+static bool find_field(const ProtoMessageDescriptor &desc, uint32_t field_id, uint32_t &field) {
+  for (uint32_t i = 0; i < desc.field_count; i++) {
+    field = desc.fields[i];
+    if (field_number(field) == field_id)
+      return true;
+  }
+  return false;
+}
+
+static bool decode_varint(const ProtoMessageDescriptor &desc, uint8_t *base, uint32_t field_id, ProtoVarInt value) {
+  uint32_t field;
+  if (!find_field(desc, field_id, field))
+    return false;
+  void *member = base + field_offset(field);
+  bool repeated = field_repeated(field);
+  switch (field_type(field)) {
+    case ProtoFieldType::BOOL:
+      return store_value<bool>(member, repeated, value.as_bool());
+    case ProtoFieldType::INT32:
+      return store_value<int32_t>(member, repeated, value.as_int32());
+    case ProtoFieldType::UINT32:
+      return store_value<uint32_t>(member, repeated, value.as_uint32());
+    case ProtoFieldType::SINT32:
+      return store_value<int32_t>(member, repeated, value.as_sint32());
+    case ProtoFieldType::INT64:
+      return store_value<int64_t>(member, repeated, value.as_int64());
+    case ProtoFieldType::UINT64:
+      return store_value<uint64_t>(member, repeated, value.as_uint64());
+    case ProtoFieldType::SINT64:
+      return store_value<int64_t>(member, repeated, value.as_sint64());
+    case ProtoFieldType::ENUM: {
+      uint32_t raw = value.as_uint32();
+      if (repeated) {
+        field_ops(desc, field)->add_enum(member, raw);
+      } else {
+        memcpy(member, &raw, sizeof(raw));
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+static bool decode_length(const ProtoMessageDescriptor &desc, uint8_t *base, uint32_t field_id,
+                          ProtoLengthDelimited value) {
+  uint32_t field;
+  if (!find_field(desc, field_id, field))
+    return false;
+  void *member = base + field_offset(field);
+  bool repeated = field_repeated(field);
+  switch (field_type(field)) {
+    case ProtoFieldType::STRING:
+      return store_value<std::string>(member, repeated, value.as_string());
+    case ProtoFieldType::STRING_REF:
+      return store_value<StringRef>(member, repeated, value.as_string_ref());
+    case ProtoFieldType::MESSAGE: {
+      const ProtoFieldOps *ops = field_ops(desc, field);
+      value.decode_to_message(*ops->message, repeated ? ops->add_message(member) : member);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+static bool decode_32bit(const ProtoMessageDescriptor &desc, uint8_t *base, uint32_t field_id, Proto32Bit value) {
+  uint32_t field;
+  if (!find_field(desc, field_id, field))
+    return false;
+  void *member = base + field_offset(field);
+  bool repeated = field_repeated(field);
+  switch (field_type(field)) {
+    case ProtoFieldType::FIXED32:
+      return store_value<uint32_t>(member, repeated, value.as_fixed32());
+    case ProtoFieldType::FLOAT:
+      return store_value<float>(member, repeated, value.as_float());
+    default:
+      return false;
+  }
+}
+
+void ProtoLengthDelimited::decode_to_message(const ProtoMessageDescriptor &desc, void *message) const {
+  proto_decode(desc, message, this->value_, this->length_);
+}
+
+void proto_decode(const ProtoMessageDescriptor &desc, void *msg, const uint8_t *buffer, size_t length) {
+  uint8_t *base = static_cast<uint8_t *>(msg);
   uint32_t i = 0;
   bool error = false;
   while (i < length) {
@@ -30,7 +348,7 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
           error = true;
           break;
         }
-        if (!this->decode_varint(field_id, *res)) {
+        if (!decode_varint(desc, base, field_id, *res)) {
           ESP_LOGV(TAG, "Cannot decode VarInt field %" PRIu32 " with value %" PRIu32 "!", field_id, res->as_uint32());
         }
         i += consumed;
@@ -50,7 +368,7 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
           error = true;
           break;
         }
-        if (!this->decode_length(field_id, ProtoLengthDelimited(&buffer[i], field_length))) {
+        if (!decode_length(desc, base, field_id, ProtoLengthDelimited(&buffer[i], field_length))) {
           ESP_LOGV(TAG, "Cannot decode Length Delimited field %" PRIu32 "!", field_id);
         }
         i += field_length;
@@ -63,7 +381,7 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
           break;
         }
         uint32_t val = encode_uint32(buffer[i + 3], buffer[i + 2], buffer[i + 1], buffer[i]);
-        if (!this->decode_32bit(field_id, Proto32Bit(val))) {
+        if (!decode_32bit(desc, base, field_id, Proto32Bit(val))) {
           ESP_LOGV(TAG, "Cannot decode 32-bit field %" PRIu32 " with value %" PRIu32 "!", field_id, val);
         }
         i += 4;
@@ -81,10 +399,73 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
 }
 
 #ifdef HAS_PROTO_MESSAGE_DUMP
-std::string ProtoMessage::dump() const {
-  std::string out;
-  this->dump_to(out);
-  return out;
+static void dump_value(std::string &out, ProtoFieldType type, const void *value, const ProtoFieldDump &dump,
+                       const ProtoMessageDescriptor *nested) {
+  char buffer[64];
+  switch (type) {
+    case ProtoFieldType::BOOL:
+      out.append(YESNO(*static_cast<const bool *>(value)));
+      return;
+    case ProtoFieldType::INT32:
+    case ProtoFieldType::SINT32:
+      snprintf(buffer, sizeof(buffer), "%" PRId32, *static_cast<const int32_t *>(value));
+      break;
+    case ProtoFieldType::UINT32:
+    case ProtoFieldType::FIXED32:
+      snprintf(buffer, sizeof(buffer), "%" PRIu32, *static_cast<const uint32_t *>(value));
+      break;
+    case ProtoFieldType::INT64:
+    case ProtoFieldType::SINT64:
+      snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(*static_cast<const int64_t *>(value)));
+      break;
+    case ProtoFieldType::UINT64:
+    case ProtoFieldType::FIXED64:
+      snprintf(buffer, sizeof(buffer), "%llu",
+               static_cast<unsigned long long>(*static_cast<const uint64_t *>(value)));  // NOLINT(google-runtime-int)
+      break;
+    case ProtoFieldType::FLOAT:
+      snprintf(buffer, sizeof(buffer), "%g", *static_cast<const float *>(value));
+      break;
+    case ProtoFieldType::ENUM: {
+      uint32_t raw;
+      memcpy(&raw, value, sizeof(raw));
+      out.append(dump.enum_name(raw));
+      return;
+    }
+    case ProtoFieldType::STRING:
+      out.append("'").append(*static_cast<const std::string *>(value)).append("'");
+      return;
+    case ProtoFieldType::STRING_REF: {
+      const StringRef &ref = *static_cast<const StringRef *>(value);
+      out.append("'").append(ref.c_str(), ref.size()).append("'");
+      return;
+    }
+    case ProtoFieldType::MESSAGE:
+      proto_dump_to(*nested, value, out);
+      return;
+  }
+  out.append(buffer);
+}
+
+void proto_dump_to(const ProtoMessageDescriptor &desc, const void *msg, std::string &out) {
+  out.append(desc.name);
+  if (desc.field_count == 0) {
+    out.append(" {}");
+    return;
+  }
+  out.append(" {\n");
+  const uint8_t *base = static_cast<const uint8_t *>(msg);
+  for (uint32_t i = 0; i < desc.field_count; i++) {
+    const uint32_t field = desc.fields[i];
+    const ProtoFieldDump &dump = desc.dump[i];
+    const ProtoMessageDescriptor *nested = nested_message(desc, field);
+    for_each_value(desc, field, base, [&out, &dump, nested](ProtoFieldType type, const void *value, bool /*force*/) {
+      out.append("  ").append(dump.name).append(": ");
+      dump_value(out, type, value, dump, nested);
+      out.append("\n");
+    });
+  }
+  out.append("}");
 }
 #endif
 
@@ -3,7 +3,9 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
 
+#include <type_traits>
 #include <vector>
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
@@ -73,34 +75,42 @@ class ProtoVarInt {
   }
   void encode(std::vector<uint8_t> &out) {
     uint64_t val = this->value_;
-    if (val <= 0x7F) {
-      out.push_back(val);
-      return;
+    while (val > 0x7F) {
+      out.push_back((val & 0x7F) | 0x80);
+      val >>= 7;
     }
-    while (val) {
-      uint8_t temp = val & 0x7F;
+    out.push_back(val);
+  }
+  /// Encode to \p out, which must have room for the encoded value. Returns a pointer past the last written byte.
+  uint8_t *encode(uint8_t *out) const {
+    uint64_t val = this->value_;
+    while (val > 0x7F) {
+      *out++ = (val & 0x7F) | 0x80;
       val >>= 7;
-      if (val) {
-        out.push_back(temp | 0x80);
-      } else {
-        out.push_back(temp);
-      }
     }
+    *out++ = val;
+    return out;
   }
 
  protected:
   uint64_t value_;
 };
 
+struct ProtoMessageDescriptor;
+
 class ProtoLengthDelimited {
  public:
   explicit ProtoLengthDelimited(const uint8_t *value, size_t length) : value_(value), length_(length) {}
   std::string as_string() const { return std::string(reinterpret_cast<const char *>(this->value_), this->length_); }
+  /// View of the value, only valid as long as the buffer that is being decoded.
+  StringRef as_string_ref() const { return StringRef(this->value_, this->length_); }
   template<class C> C as_message() const {
     auto msg = C();
     msg.decode(this->value_, this->length_);
     return msg;
   }
+  /// Decode the value into \p message described by \p desc, merging it with the fields that are already set.
+  void decode_to_message(const ProtoMessageDescriptor &desc, void *message) const;
 
  protected:
   const uint8_t *const value_;
@@ -143,6 +153,112 @@ class Proto64Bit {
   const uint64_t value_;
 };
 
+/** Computes the encoded size of fields, mirroring what ProtoWriteBuffer writes for them.
+ *
+ * field_id_size is the size of the encoded field key, which the generated code passes as a constant.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1UL << 7))
+      return 1;
+    if (value < (1UL << 14))
+      return 2;
+    if (value < (1UL << 21))
+      return 3;
+    if (value < (1UL << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    if (value <= UINT32_MAX)
+      return varint(static_cast<uint32_t>(value));
+    uint32_t size = 5;
+    value >>= 35;
+    while (value) {
+      size++;
+      value >>= 7;
+    }
+    return size;
+  }
+  static uint32_t varint(int32_t value) {
+    // negative int32 is always 10 byte long
+    return value < 0 ? 10 : varint(static_cast<uint32_t>(value));
+  }
+  static uint32_t varint(int64_t value) { return varint(static_cast<uint64_t>(value)); }
+
+  static void add_int32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_int64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_sint32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    uint32_t uvalue = value < 0 ? ~(value << 1) : value << 1;
+    add_uint32_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_sint64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    uint64_t uvalue = value < 0 ? ~(value << 1) : value << 1;
+    add_uint64_field(total_size, field_id_size, uvalue, force);
+  }
+  template<typename T>
+  static void add_enum_field(uint32_t &total_size, uint32_t field_id_size, T value, bool force = false) {
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_bool_field(uint32_t &total_size, uint32_t field_id_size, bool value, bool force = false) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  static void add_fixed32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  static void add_fixed64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_float_field(uint32_t &total_size, uint32_t field_id_size, float value, bool force = false) {
+    if (value == 0.0f && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const std::string &value,
+                               bool force = false) {
+    if (value.empty() && !force)
+      return;
+    total_size += field_id_size + varint(static_cast<uint32_t>(value.size())) + value.size();
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const StringRef &value,
+                               bool force = false) {
+    if (value.empty() && !force)
+      return;
+    total_size += field_id_size + varint(static_cast<uint32_t>(value.size())) + value.size();
+  }
+  template<class C>
+  static void add_message_field(uint32_t &total_size, uint32_t field_id_size, const C &value, bool force = false) {
+    uint32_t nested_size = 0;
+    value.calculate_size(nested_size);
+    total_size += field_id_size + varint(nested_size) + nested_size;
+  }
+};
+
 class ProtoWriteBuffer {
  public:
   ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
@@ -163,7 +279,10 @@ class ProtoWriteBuffer {
     this->buffer_->insert(this->buffer_->end(), data, data + len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
+  }
+  void encode_string(uint32_t field_id, const StringRef &value, bool force = false) {
+    this->encode_string(field_id, value.c_str(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -222,7 +341,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, true);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -255,15 +374,10 @@ class ProtoWriteBuffer {
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -271,24 +385,143 @@ class ProtoWriteBuffer {
   std::vector<uint8_t> *buffer_;
 };
 
-class ProtoMessage {
+/// C++ type of a message field, which also determines how it is encoded.
+enum class ProtoFieldType : uint8_t {
+  BOOL,
+  INT32,
+  UINT32,
+  SINT32,
+  INT64,
+  UINT64,
+  SINT64,
+  FIXED32,
+  FIXED64,
+  FLOAT,
+  /// enums::* value, stored as uint32_t.
+  ENUM,
+  /// std::string, for both string and bytes fields.
+  STRING,
+  /// StringRef, for string and bytes fields with the (view) option.
+  STRING_REF,
+  MESSAGE,
+};
+
+/** Pack the description of one message field into a single word.
+ *
+ * Bits 0-15 hold the offset of the member in the message, bits 16-22 the field number, bits 23-27 the type,
+ * bit 28 whether the field is repeated and bits 29-31 the index into ProtoMessageDescriptor::ops for repeated enum
+ * fields and message fields. Descriptors are kept in PROGMEM and words can be read from there on every platform.
+ */
+constexpr uint32_t proto_field(size_t offset, uint32_t field_id, ProtoFieldType type, bool repeated = false,
+                               uint32_t ops_index = 0) {
+  return static_cast<uint32_t>(offset) | (field_id << 16) | (static_cast<uint32_t>(type) << 23) |
+         (static_cast<uint32_t>(repeated) << 28) | (ops_index << 29);
+}
+
+/// Type-erased access to the fields whose C++ type only the generated code knows: repeated enums and messages.
+struct ProtoFieldOps {
+  size_t (*size)(const void *vec);
+  uint32_t (*enum_at)(const void *vec, size_t index);
+  void (*add_enum)(void *vec, uint32_t value);
+  /// Fields of the message type of a message field.
+  const ProtoMessageDescriptor *message;
+  const void *(*message_at)(const void *vec, size_t index);
+  void *(*add_message)(void *vec);
+};
+
+#ifdef HAS_PROTO_MESSAGE_DUMP
+/// How to print a field in ProtoMessage::dump().
+struct ProtoFieldDump {
+  const char *name;
+  /// Name of the value of an enum field, nullptr for other fields.
+  const char *(*enum_name)(uint32_t value);
+};
+#endif
+
+/// Fields of a message, in the order they are encoded in.
+struct ProtoMessageDescriptor {
+  /// Words built with proto_field().
+  const uint32_t *fields;
+  /// Access to the repeated enum and the message fields, nullptr if there are none.
+  const ProtoFieldOps *const *ops;
+  uint32_t field_count;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  const char *name;
+  /// One entry per field, in the same order as fields.
+  const ProtoFieldDump *dump;
+#endif
+};
+
+/// Encode, size, decode and dump the message at \p msg by walking its descriptor.
+void proto_encode(const ProtoMessageDescriptor &desc, const void *msg, ProtoWriteBuffer &buffer);
+void proto_calculate_size(const ProtoMessageDescriptor &desc, const void *msg, uint32_t &total_size);
+void proto_decode(const ProtoMessageDescriptor &desc, void *msg, const uint8_t *buffer, size_t length);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void proto_dump_to(const ProtoMessageDescriptor &desc, const void *msg, std::string &out);
+#endif
+
+/** Base class of all API messages, \p T is the message class itself.
+ *
+ * Messages only describe their fields with the ProtoMessageDescriptor T::DESCRIPTOR, a single generic implementation
+ * encodes, sizes, decodes and dumps all of them by walking that table. Messages have no virtual functions, so that
+ * they are standard-layout classes and the offsetof() of their fields in the table is well defined.
+ */
+template<typename T> class ProtoMessage {
  public:
-  virtual ~ProtoMessage() = default;
-  virtual void encode(ProtoWriteBuffer buffer) const = 0;
-  void decode(const uint8_t *buffer, size_t length);
+  void encode(ProtoWriteBuffer buffer) const { proto_encode(T::DESCRIPTOR, this->message_(), buffer); }
+  /// Add the number of bytes encode() writes to \p total_size.
+  void calculate_size(uint32_t &total_size) const {
+    proto_calculate_size(T::DESCRIPTOR, this->message_(), total_size);
+  }
+  void decode(const uint8_t *buffer, size_t length) {
+    proto_decode(T::DESCRIPTOR, static_cast<T *>(this), buffer, length);
+  }
 #ifdef HAS_PROTO_MESSAGE_DUMP
-  std::string dump() const;
-  virtual void dump_to(std::string &out) const = 0;
+  std::string dump() const {
+    std::string out;
+    this->dump_to(out);
+    return out;
+  }
+  void dump_to(std::string &out) const { proto_dump_to(T::DESCRIPTOR, this->message_(), out); }
 #endif
 
  protected:
-  virtual bool decode_varint(uint32_t field_id, ProtoVarInt value) { return false; }
-  virtual bool decode_length(uint32_t field_id, ProtoLengthDelimited value) { return false; }
-  virtual bool decode_32bit(uint32_t field_id, Proto32Bit value) { return false; }
-  virtual bool decode_64bit(uint32_t field_id, Proto64Bit value) { return false; }
+  const T *message_() const {
+    static_assert(std::is_standard_layout<T>::value, "offsetof() is only well defined for standard-layout messages");
+    return static_cast<const T *>(this);
+  }
+};
+
+template<typename T> struct ProtoRepeatedEnum {
+  static size_t size(const void *vec) { return static_cast<const std::vector<T> *>(vec)->size(); }
+  static uint32_t at(const void *vec, size_t index) {
+    return static_cast<uint32_t>((*static_cast<const std::vector<T> *>(vec))[index]);
+  }
+  static void add(void *vec, uint32_t value) { static_cast<std::vector<T> *>(vec)->push_back(static_cast<T>(value)); }
+  static constexpr ProtoFieldOps OPS{&size, &at, &add, nullptr, nullptr, nullptr};
+};
+
+template<typename T> struct ProtoRepeatedMessage {
+  static size_t size(const void *vec) { return static_cast<const std::vector<T> *>(vec)->size(); }
+  static const void *at(const void *vec, size_t index) { return &(*static_cast<const std::vector<T> *>(vec))[index]; }
+  static void *add(void *vec) {
+    auto *messages = static_cast<std::vector<T> *>(vec);
+    messages->emplace_back();
+    return &messages->back();
+  }
+  static constexpr ProtoFieldOps OPS{&size, nullptr, nullptr, &T::DESCRIPTOR, &at, &add};
+};
+
+/// A singular message field only needs the descriptor of its type.
+template<typename T> struct ProtoNestedMessage {
+  static constexpr ProtoFieldOps OPS{nullptr, nullptr, nullptr, &T::DESCRIPTOR, nullptr, nullptr};
 };
 
 template<typename T> const char *proto_enum_to_string(T value);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+/// proto_enum_to_string() for the raw value, as stored in ProtoFieldDump.
+template<typename T> const char *proto_enum_name(uint32_t value) { return proto_enum_to_string(static_cast<T>(value)); }
+#endif
 
 class ProtoService {
  public:
@@ -298,12 +531,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Create a buffer to encode a message of \p reserve_size bytes in, so that it won't have to grow.
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
@@ -11,7 +11,7 @@ void Button::press() {
   this->press_action();
   this->press_callback_.call();
 }
-void Button::add_on_press_callback(std::function<void()> &&callback) { this->press_callback_.add(std::move(callback)); }
+void Button::add_on_press_callback(Callback<void()> &&callback) { this->press_callback_.add(std::move(callback)); }
 
 }  // namespace button
 }  // namespace esphome
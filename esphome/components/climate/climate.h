@@ -215,7 +215,7 @@ class Climate : public EntityBase {
    *
    * @param callback The callback to call.
    */
-  void add_on_state_callback(std::function<void(Climate &)> &&callback);
+  void add_on_state_callback(Callback<void(Climate &)> &&callback);
 
   /**
    * Add a callback for the climate device configuration; each time the configuration parameters of a climate device
@@ -223,7 +223,7 @@ class Climate : public EntityBase {
    *
    * @param callback The callback to call.
    */
-  void add_on_control_callback(std::function<void(ClimateCall &)> &&callback);
+  void add_on_control_callback(Callback<void(ClimateCall &)> &&callback);
 
   /** Make a climate device control call, this is used to control the climate device, see the ClimateCall description
    * for more info.
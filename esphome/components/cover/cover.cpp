@@ -162,7 +162,7 @@ void Cover::stop() {
   call.set_command_stop();
   call.perform();
 }
-void Cover::add_on_state_callback(std::function<void()> &&f) { this->state_callback_.add(std::move(f)); }
+void Cover::add_on_state_callback(Callback<void()> &&f) { this->state_callback_.add(std::move(f)); }
 void Cover::publish_state(bool save) {
   this->position = clamp(this->position, 0.0f, 1.0f);
   this->tilt = clamp(this->tilt, 0.0f, 1.0f);
@@ -1,6 +1,7 @@
 #include "ct_clamp_sensor.h"
 
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 
@@ -12,6 +13,8 @@ static const char *const TAG = "ct_clamp";
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  if (this->window_count_ > 1)
+    ESP_LOGCONFIG(TAG, "  Windows: %u", this->window_count_);
   LOG_UPDATE_INTERVAL(this);
 }
 
@@ -26,28 +29,18 @@ void CTClampSensor::update() {
     this->is_sampling_ = false;
     this->high_freq_.stop();
 
-    if (this->num_samples_ == 0) {
-      // Shouldn't happen, but let's not crash if it does.
-      this->publish_state(NAN);
+    if (this->window_count_ <= 1) {
+      this->publish_state(this->finish_window_());
       return;
     }
-
-    const float rms_ac_dc_squared = this->sample_squared_sum_ / this->num_samples_;
-    const float rms_dc = this->sample_sum_ / this->num_samples_;
-    const float rms_ac_squared = rms_ac_dc_squared - rms_dc * rms_dc;
-    float rms_ac = 0;
-    if (rms_ac_squared > 0)
-      rms_ac = std::sqrt(rms_ac_squared);
-    ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %" PRIu32 " different samples (%" PRIu32 " SPS)",
-             this->name_.c_str(), rms_ac, this->num_samples_, 1000 * this->num_samples_ / this->sample_duration_);
-    this->publish_state(rms_ac);
+    this->windows_.push_back(this->finish_window_());
+    this->publish_samples(this->windows_.data(), this->windows_.size());
   });
 
   // Set sampling values
-  this->last_value_ = 0.0;
-  this->num_samples_ = 0;
-  this->sample_sum_ = 0.0f;
-  this->sample_squared_sum_ = 0.0f;
+  this->windows_.clear();
+  this->window_start_ = millis();
+  this->reset_window_();
   this->is_sampling_ = true;
 }
 
@@ -55,6 +48,13 @@ void CTClampSensor::loop() {
   if (!this->is_sampling_)
     return;
 
+  // Close the current window once its share of the sampling phase is over; the last one is closed by the timeout
+  if (this->window_count_ > 1 && this->windows_.size() + 1u < this->window_count_ &&
+      millis() - this->window_start_ >= this->sample_duration_ / this->window_count_) {
+    this->windows_.push_back(this->finish_window_());
+    this->window_start_ = millis();
+  }
+
   // Perform a single sample
   float value = this->source_->sample();
   if (std::isnan(value))
@@ -70,5 +70,31 @@ void CTClampSensor::loop() {
   this->sample_squared_sum_ += value * value;
 }
 
+float CTClampSensor::finish_window_() {
+  if (this->num_samples_ == 0) {
+    // Shouldn't happen, but let's not crash if it does.
+    return NAN;
+  }
+
+  const float rms_ac_dc_squared = this->sample_squared_sum_ / this->num_samples_;
+  const float rms_dc = this->sample_sum_ / this->num_samples_;
+  const float rms_ac_squared = rms_ac_dc_squared - rms_dc * rms_dc;
+  float rms_ac = 0;
+  if (rms_ac_squared > 0)
+    rms_ac = std::sqrt(rms_ac_squared);
+  ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %" PRIu32 " different samples (%" PRIu32 " SPS)",
+           this->name_.c_str(), rms_ac, this->num_samples_,
+           1000 * this->num_samples_ / std::max<uint32_t>(this->sample_duration_ / this->window_count_, 1));
+  this->reset_window_();
+  return rms_ac;
+}
+
+void CTClampSensor::reset_window_() {
+  this->last_value_ = 0.0;
+  this->num_samples_ = 0;
+  this->sample_sum_ = 0.0f;
+  this->sample_squared_sum_ = 0.0f;
+}
+
 }  // namespace ct_clamp
 }  // namespace esphome
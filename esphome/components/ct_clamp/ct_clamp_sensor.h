@@ -5,6 +5,8 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/voltage_sampler/voltage_sampler.h"
 
+#include <vector>
+
 namespace esphome {
 namespace ct_clamp {
 
@@ -20,8 +22,14 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
 
   void set_sample_duration(uint32_t sample_duration) { sample_duration_ = sample_duration; }
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
+  /// Split the sampling phase into this many windows and publish the RMS of each with publish_samples().
+  void set_window_count(uint8_t window_count) { window_count_ = window_count; }
 
  protected:
+  /// Return the RMS of the samples taken in the current window and start a new one.
+  float finish_window_();
+  void reset_window_();
+
   /// High Frequency loop() requester used during sampling phase.
   HighFrequencyLoopRequester high_freq_;
 
@@ -48,6 +56,11 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   float sample_squared_sum_ = 0.0f;
   uint32_t num_samples_ = 0;
   bool is_sampling_ = false;
+
+  /// Number of windows in a sampling phase, the RMS values of all but the current one and when it started.
+  uint8_t window_count_{1};
+  std::vector<float> windows_;
+  uint32_t window_start_{0};
 };
 
 }  // namespace ct_clamp
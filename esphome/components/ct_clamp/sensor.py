@@ -12,6 +12,7 @@ AUTO_LOAD = ["voltage_sampler"]
 CODEOWNERS = ["@jesserockz"]
 
 CONF_SAMPLE_DURATION = "sample_duration"
+CONF_WINDOWS = "windows"
 
 ct_clamp_ns = cg.esphome_ns.namespace("ct_clamp")
 CTClampSensor = ct_clamp_ns.class_("CTClampSensor", sensor.Sensor, cg.PollingComponent)
@@ -30,6 +31,8 @@ CONFIG_SCHEMA = (
             cv.Optional(
                 CONF_SAMPLE_DURATION, default="200ms"
             ): cv.positive_time_period_milliseconds,
+            # Publish one RMS value per window so the filters see all of them
+            cv.Optional(CONF_WINDOWS, default=1): cv.int_range(min=1, max=255),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -43,3 +46,5 @@ async def to_code(config):
     sens = await cg.get_variable(config[CONF_SENSOR])
     cg.add(var.set_source(sens))
     cg.add(var.set_sample_duration(config[CONF_SAMPLE_DURATION]))
+    if config[CONF_WINDOWS] > 1:
+        cg.add(var.set_window_count(config[CONF_WINDOWS]))
@@ -1,12 +1,14 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/version.h"
 #include <cinttypes>
 #include <climits>
+#include <cstring>
 
 namespace esphome {
 namespace debug {
@@ -21,6 +23,9 @@ void DebugComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Debug component:");
 #ifdef USE_TEXT_SENSOR
   LOG_TEXT_SENSOR("  ", "Device info", this->device_info_);
+#ifdef USE_COMPONENT_TIMING
+  LOG_TEXT_SENSOR("  ", "Component timing", this->component_timing_);
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   LOG_SENSOR("  ", "Free space on heap", this->free_sensor_);
@@ -28,6 +33,7 @@ void DebugComponent::dump_config() {
 #if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+  LOG_SENSOR("  ", "Scheduler high water mark", this->scheduler_high_water_sensor_);
 #endif  // USE_SENSOR
 
   std::string device_info;
@@ -37,6 +43,8 @@ void DebugComponent::dump_config() {
 
   this->free_heap_ = get_free_heap_();
   ESP_LOGD(TAG, "Free Heap Size: %" PRIu32 " bytes", this->free_heap_);
+  ESP_LOGD(TAG, "Scheduler pool: %zu items, high water mark %zu, %" PRIu32 " heap allocations",
+           App.scheduler.get_pool_size(), App.scheduler.get_items_high_water(), App.scheduler.get_heap_allocations());
 
   get_device_info_(device_info);
 
@@ -83,10 +91,71 @@ void DebugComponent::update() {
     this->max_loop_time_ = 0;
   }
 
+  if (this->scheduler_high_water_sensor_ != nullptr) {
+    this->scheduler_high_water_sensor_->publish_state(App.scheduler.get_items_high_water());
+  }
+
 #endif  // USE_SENSOR
+
+#ifdef USE_COMPONENT_TIMING
+  this->log_component_timing_();
+#ifdef USE_TEXT_SENSOR
+  if (this->component_timing_ != nullptr) {
+    this->component_timing_->publish_state(this->get_component_timing_summary_());
+  }
+#endif  // USE_TEXT_SENSOR
+#endif  // USE_COMPONENT_TIMING
   update_platform_();
 }
 
+#ifdef USE_COMPONENT_TIMING
+void DebugComponent::log_component_timing_() {
+  ESP_LOGD(TAG, "Component timing (count, min/avg/p99/max us):");
+  for (auto *component : App.get_components()) {
+    auto &stats = component->get_timing_stats();
+    char buf[256];
+    size_t len = 0;
+    for (uint8_t i = 0; i < TIMING_CATEGORY_COUNT && len < sizeof(buf); i++) {
+      auto category = static_cast<TimingCategory>(i);
+      const auto &histogram = stats[category];
+      if (histogram.get_count() == 0)
+        continue;
+      len += snprintf(buf + len, sizeof(buf) - len, " %s %" PRIu32 ", %" PRIu32 "/%" PRIu32 "/%" PRIu32 "/%" PRIu32 ";",
+                      timing_category_to_string(category), histogram.get_count(), histogram.get_min(),
+                      histogram.get_avg(), histogram.get_percentile(99), histogram.get_max());
+    }
+    if (len != 0)
+      ESP_LOGD(TAG, "  %s:%s", component->get_component_source(), buf);
+  }
+}
+
+std::string DebugComponent::get_component_timing_summary_() {
+  // Components that spent the most time in loop() and scheduler callbacks, with their loop() avg/p99/max.
+  static const size_t MAX_ENTRIES = 8;
+  std::vector<Component *> components = App.get_components();
+  auto busy_time = [](Component *component) {
+    auto &stats = component->get_timing_stats();
+    return stats[TIMING_LOOP].get_total() + stats[TIMING_SCHEDULER].get_total();
+  };
+  size_t count = std::min(MAX_ENTRIES, components.size());
+  std::partial_sort(components.begin(), components.begin() + count, components.end(),
+                    [&busy_time](Component *a, Component *b) { return busy_time(a) > busy_time(b); });
+
+  std::string summary;
+  summary.reserve(255);
+  for (size_t i = 0; i < count; i++) {
+    auto &loop = components[i]->get_timing_stats()[TIMING_LOOP];
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s%s %" PRIu32 "/%" PRIu32 "/%" PRIu32, summary.empty() ? "" : ", ",
+             components[i]->get_component_source(), loop.get_avg(), loop.get_percentile(99), loop.get_max());
+    if (summary.size() + strlen(buf) > 255)
+      break;
+    summary += buf;
+  }
+  return summary;
+}
+#endif  // USE_COMPONENT_TIMING
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
@@ -25,6 +25,9 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
+#ifdef USE_COMPONENT_TIMING
+  void set_component_timing_sensor(text_sensor::TextSensor *component_timing) { component_timing_ = component_timing; }
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
@@ -33,6 +36,9 @@ class DebugComponent : public PollingComponent {
   void set_fragmentation_sensor(sensor::Sensor *fragmentation_sensor) { fragmentation_sensor_ = fragmentation_sensor; }
 #endif
   void set_loop_time_sensor(sensor::Sensor *loop_time_sensor) { loop_time_sensor_ = loop_time_sensor; }
+  void set_scheduler_high_water_sensor(sensor::Sensor *scheduler_high_water_sensor) {
+    scheduler_high_water_sensor_ = scheduler_high_water_sensor;
+  }
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
@@ -50,6 +56,7 @@ class DebugComponent : public PollingComponent {
   sensor::Sensor *fragmentation_sensor_{nullptr};
 #endif
   sensor::Sensor *loop_time_sensor_{nullptr};
+  sensor::Sensor *scheduler_high_water_sensor_{nullptr};
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
@@ -58,8 +65,16 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
+#ifdef USE_COMPONENT_TIMING
+  text_sensor::TextSensor *component_timing_{nullptr};
+#endif
 #endif  // USE_TEXT_SENSOR
 
+#ifdef USE_COMPONENT_TIMING
+  void log_component_timing_();
+  std::string get_component_timing_summary_();
+#endif
+
   std::string get_reset_reason_();
   uint32_t get_free_heap_();
   void get_device_info_(std::string &device_info);
@@ -18,6 +18,7 @@ from . import CONF_DEBUG_ID, DebugComponent
 DEPENDENCIES = ["debug"]
 
 CONF_PSRAM = "psram"
+CONF_SCHEDULER_HIGH_WATER = "scheduler_high_water"
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -49,6 +50,11 @@ CONFIG_SCHEMA = {
         accuracy_decimals=0,
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
+    cv.Optional(CONF_SCHEDULER_HIGH_WATER): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
     cv.Optional(CONF_PSRAM): cv.All(
         cv.only_on_esp32,
         cv.requires_component("psram"),
@@ -81,6 +87,10 @@ async def to_code(config):
         sens = await sensor.new_sensor(loop_time_conf)
         cg.add(debug_component.set_loop_time_sensor(sens))
 
+    if scheduler_conf := config.get(CONF_SCHEDULER_HIGH_WATER):
+        sens = await sensor.new_sensor(scheduler_conf)
+        cg.add(debug_component.set_scheduler_high_water_sensor(sens))
+
     if psram_conf := config.get(CONF_PSRAM):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
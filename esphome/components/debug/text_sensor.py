@@ -6,6 +6,7 @@ from esphome.const import (
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_CHIP,
     ICON_RESTART,
+    ICON_TIMER,
 )
 
 from . import CONF_DEBUG_ID, DebugComponent
@@ -14,6 +15,7 @@ DEPENDENCIES = ["debug"]
 
 
 CONF_RESET_REASON = "reset_reason"
+CONF_COMPONENT_TIMING = "component_timing"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -25,6 +27,10 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_RESTART,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_COMPONENT_TIMING): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
     }
 )
 
@@ -38,3 +44,8 @@ async def to_code(config):
     if CONF_RESET_REASON in config:
         sens = await text_sensor.new_text_sensor(config[CONF_RESET_REASON])
         cg.add(debug_component.set_reset_reason_sensor(sens))
+    if CONF_COMPONENT_TIMING in config:
+        # Timing all components has a small cost, so only do it when asked for.
+        cg.add_define("USE_COMPONENT_TIMING")
+        sens = await text_sensor.new_text_sensor(config[CONF_COMPONENT_TIMING])
+        cg.add(debug_component.set_component_timing_sensor(sens))
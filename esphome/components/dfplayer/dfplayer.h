@@ -85,7 +85,7 @@ class DFPlayer : public uart::UARTDevice, public Component {
   bool is_playing() { return is_playing_; }
   void dump_config() override;
 
-  void add_on_finished_playback_callback(std::function<void()> callback) {
+  void add_on_finished_playback_callback(Callback<void()> &&callback) {
     this->on_finished_playback_callback_.add(std::move(callback));
   }
 
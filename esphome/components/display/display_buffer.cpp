@@ -1,5 +1,7 @@
 #include "display_buffer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -10,6 +12,99 @@ namespace display {
 
 static const char *const TAG = "display";
 
+void DirtyRegion::init(int width, int height) {
+  this->width_ = width;
+  this->height_ = height;
+  this->shift_ = 4;
+  while (((width + (1 << this->shift_) - 1) >> this->shift_) > 32)
+    this->shift_++;
+  this->rows_.assign((height + (1 << this->shift_) - 1) >> this->shift_, 0);
+}
+
+void DirtyRegion::mark_rect(int x1, int y1, int x2, int y2) {
+  x1 = std::max(x1, 0);
+  y1 = std::max(y1, 0);
+  x2 = std::min(x2, this->width_ - 1);
+  y2 = std::min(y2, this->height_ - 1);
+  if (x1 > x2 || y1 > y2)
+    return;
+  const int first = x1 >> this->shift_;
+  const int last = x2 >> this->shift_;
+  const uint32_t mask = (last == 31 ? ~0u : (1u << (last + 1)) - 1) & ~((1u << first) - 1);
+  for (int row = y1 >> this->shift_; row <= (y2 >> this->shift_); row++)
+    this->rows_[row] |= mask;
+}
+
+void DirtyRegion::clear() { std::fill(this->rows_.begin(), this->rows_.end(), 0); }
+
+void DirtyRegion::clear_rows(int y1, int y2) {
+  y1 = std::max(y1, 0);
+  y2 = std::min(y2, this->height_ - 1);
+  // Only rows of tiles that lie completely inside the range are clean now
+  const int first = (y1 + (1 << this->shift_) - 1) >> this->shift_;
+  int last = (y2 + 1) >> this->shift_;
+  if (y2 == this->height_ - 1)
+    last = this->rows_.size();
+  for (int row = first; row < last; row++)
+    this->rows_[row] = 0;
+}
+
+bool DirtyRegion::is_empty() const {
+  return std::all_of(this->rows_.begin(), this->rows_.end(), [](uint32_t row) { return row == 0; });
+}
+
+bool DirtyRegion::pop_rect(Rect *rect) {
+  const size_t num_rows = this->rows_.size();
+  for (size_t row = 0; row < num_rows; row++) {
+    const uint32_t bits = this->rows_[row];
+    if (bits == 0)
+      continue;
+    const int first = __builtin_ctz(bits);
+    // The bits above the row of tiles are set after inverting, so this only runs out for a completely dirty row
+    const uint32_t rest = ~(bits >> first);
+    const int len = rest == 0 ? 32 - first : __builtin_ctz(rest);
+    const uint32_t run = (len == 32 ? ~0u : (1u << len) - 1) << first;
+    size_t end = row + 1;
+    while (end < num_rows && (this->rows_[end] & run) == run)
+      end++;
+    for (size_t i = row; i < end; i++)
+      this->rows_[i] &= ~run;
+
+    const int x = first << this->shift_;
+    const int y = row << this->shift_;
+    rect->x = x;
+    rect->y = y;
+    rect->w = std::min<int>((first + len) << this->shift_, this->width_) - x;
+    rect->h = std::min<int>(end << this->shift_, this->height_) - y;
+    return true;
+  }
+  return false;
+}
+
+bool DirtyRegion::pop_bounds(Rect *rect) {
+  uint32_t columns = 0;
+  int first_row = -1, last_row = -1;
+  for (size_t row = 0; row < this->rows_.size(); row++) {
+    if (this->rows_[row] == 0)
+      continue;
+    columns |= this->rows_[row];
+    if (first_row < 0)
+      first_row = row;
+    last_row = row;
+    this->rows_[row] = 0;
+  }
+  if (columns == 0)
+    return false;
+
+  const int x = __builtin_ctz(columns) << this->shift_;
+  const int y = first_row << this->shift_;
+  rect->x = x;
+  rect->y = y;
+  rect->w = std::min<int>((32 - __builtin_clz(columns)) << this->shift_, this->width_) - x;
+  rect->h = std::min<int>((last_row + 1) << this->shift_, this->height_) - y;
+  return true;
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->buffer_ = allocator.allocate(buffer_length);
@@ -20,6 +115,83 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void DisplayBuffer::fill_buffer_(const uint8_t *pixel, uint8_t bytes_per_pixel) {
+  if (this->buffer_ == nullptr)
+    return;
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  uint8_t *pos = this->buffer_;
+  if (this->band_height_ != 0) {
+    // Bands are sent completely anyway, there is nothing to track
+    const size_t len = size_t(width) * this->band_rows_ * bytes_per_pixel;
+    for (size_t i = 0; i < len; i += bytes_per_pixel)
+      memcpy(pos + i, pixel, bytes_per_pixel);
+    return;
+  }
+  const int tile_size = this->dirty_.get_tile_size();
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x += tile_size) {
+      // Only write the part of the row within this tile if any pixel of it differs, so the tile stays clean otherwise
+      const int len = std::min(tile_size, width - x) * bytes_per_pixel;
+      int i = 0;
+      for (int j = 0; i < len; i++) {
+        if (pos[i] != pixel[j])
+          break;
+        if (++j == bytes_per_pixel)
+          j = 0;
+      }
+      if (i != len) {
+        for (i = 0; i < len; i += bytes_per_pixel)
+          memcpy(pos + i, pixel, bytes_per_pixel);
+        this->dirty_.mark(x, y);
+      }
+      pos += len;
+    }
+    App.feed_wdt();
+  }
+}
+
+void DisplayBuffer::do_update_banded_() {
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  // test_card() turns the test card off again, but every band has to show it
+  const bool show_test_card = this->show_test_card_;
+  for (int start = 0; start < height; start += this->band_height_) {
+    const int rows = std::min<int>(this->band_height_, height - start);
+    this->band_start_ = start;
+    this->band_rows_ = rows;
+
+    // The band in the coordinates the page draws with, see draw_pixel_at()
+    Rect band;
+    switch (this->rotation_) {
+      case DISPLAY_ROTATION_0_DEGREES:
+      default:
+        band = Rect(0, start, width, rows);
+        break;
+      case DISPLAY_ROTATION_90_DEGREES:
+        band = Rect(start, 0, rows, width);
+        break;
+      case DISPLAY_ROTATION_180_DEGREES:
+        band = Rect(0, height - start - rows, width, rows);
+        break;
+      case DISPLAY_ROTATION_270_DEGREES:
+        band = Rect(height - start - rows, 0, rows, width);
+        break;
+    }
+    this->start_clipping(band);
+    // The buffer still holds the previous band, which must not show up in this one
+    if (!this->auto_clear_enabled_)
+      this->clear();
+    this->show_test_card_ = show_test_card;
+    // Also clears the clipping again
+    this->do_update_();
+    this->write_band_();
+    App.feed_wdt();
+  }
+  this->band_rows_ = 0;
+  this->show_test_card_ = false;
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -12,6 +12,47 @@
 namespace esphome {
 namespace display {
 
+/** Tracks which parts of a display buffer changed since they were last sent to the display.
+ *
+ * The display is divided into square tiles of at least 16 pixels, made larger where needed so that a row of tiles fits
+ * in one 32-bit mask, and marking a pixel only sets a bit. When flushing, the dirty tiles are taken out as a few
+ * rectangles, so changes in opposite corners of the display don't cause everything in between to be sent as well.
+ */
+class DirtyRegion {
+ public:
+  void init(int width, int height);
+
+  /// Mark the pixel at \p x, \p y as changed, which must be inside the display.
+  inline void mark(int x, int y) ESPHOME_ALWAYS_INLINE {
+    this->rows_[y >> this->shift_] |= 1u << (x >> this->shift_);
+  }
+  /// Mark all pixels from \p x1, \p y1 to \p x2, \p y2 (inclusive) as changed.
+  void mark_rect(int x1, int y1, int x2, int y2);
+  void mark_all() { this->mark_rect(0, 0, this->width_ - 1, this->height_ - 1); }
+  void clear();
+  /// Drop the dirty tiles in the rows of tiles from pixel row \p y1 to \p y2 (inclusive), after those rows were sent.
+  void clear_rows(int y1, int y2);
+  bool is_empty() const;
+  int get_tile_size() const { return 1 << this->shift_; }
+
+  /** Take the next rectangle of dirty tiles out of the region, clipped to the display.
+   *
+   * The rectangles are found greedily: the first run of dirty tiles in a row is extended downwards as long as the
+   * tiles below it are dirty as well. Returns false once nothing is left.
+   */
+  bool pop_rect(Rect *rect);
+  /// Take the bounding box of all dirty tiles out of the region, for displays where every window is expensive to set.
+  bool pop_bounds(Rect *rect);
+
+ protected:
+  /// Bit n of an entry is set if tile n of that row of tiles is dirty.
+  std::vector<uint32_t> rows_;
+  int16_t width_{0};
+  int16_t height_{0};
+  /// log2 of the tile size.
+  uint8_t shift_{4};
+};
+
 class DisplayBuffer : public Display {
  public:
   /// Get the width of the image in pixels with rotation applied.
@@ -22,12 +63,39 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Only buffer \p band_height rows of the display at a time, for drivers that support banded rendering.
+  void set_band_height(uint16_t band_height) { this->band_height_ = band_height; }
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
   void init_internal_(uint32_t buffer_length);
 
+  /** Set every pixel of the buffer to \p pixel, which has \p bytes_per_pixel bytes, and mark the tiles that changed.
+   *
+   * For drivers whose buffer holds the rows of the unrotated display one after the other.
+   */
+  void fill_buffer_(const uint8_t *pixel, uint8_t bytes_per_pixel);
+
+  /** Draw the page one horizontal band of the unrotated display at a time, into a buffer of band_height_ rows.
+   *
+   * The page is drawn again for every band, with clipping set to the band so that most drawing outside of it is
+   * skipped early, and write_band_() is called after each pass to send the band to the display.
+   */
+  void do_update_banded_();
+  /// Send rows band_start_ to band_start_ + band_rows_ of the display from the buffer.
+  virtual void write_band_() {}
+
+  /// Number of rows the buffer holds when drawing in bands, 0 if it holds the whole display.
+  uint16_t band_height_{0};
+  /// Row of the unrotated display that is at the start of the buffer.
+  uint16_t band_start_{0};
+  /// Number of rows of the band that is being drawn, less than band_height_ for the last band. 0 while no band is.
+  uint16_t band_rows_{0};
+
   uint8_t *buffer_{nullptr};
+  /// Changes to the buffer that have not been sent yet, for drivers that only send what changed.
+  DirtyRegion dirty_;
 };
 
 }  // namespace display
@@ -17,7 +17,9 @@ void Rect::expand(int16_t horizontal, int16_t vertical) {
 }
 
 void Rect::extend(Rect rect) {
-  if (!this->is_set()) {
+  if (rect.is_empty())
+    return;
+  if (!this->is_set() || this->is_empty()) {
     this->x = rect.x;
     this->y = rect.y;
     this->w = rect.w;
@@ -41,7 +43,8 @@ void Rect::extend(Rect rect) {
 }
 void Rect::shrink(Rect rect) {
   if (!this->inside(rect)) {
-    (*this) = Rect();
+    // Nothing is left. An unset rectangle would clip nothing at all, so use one that nothing is inside of instead.
+    (*this) = Rect(rect.x, rect.y, -1, -1);
   } else {
     if (this->x2() > rect.x2()) {
       this->w = rect.x2() - this->x;
@@ -68,6 +71,9 @@ bool Rect::inside(int16_t test_x, int16_t test_y, bool absolute) const {  // NOL
   if (!this->is_set()) {
     return true;
   }
+  if (this->is_empty()) {
+    return false;
+  }
   if (absolute) {
     return ((test_x >= this->x) && (test_x <= this->x2()) && (test_y >= this->y) && (test_y <= this->y2()));
   } else {
@@ -76,6 +82,9 @@ bool Rect::inside(int16_t test_x, int16_t test_y, bool absolute) const {  // NOL
 }
 
 bool Rect::inside(Rect rect, bool absolute) const {
+  if (this->is_empty() || rect.is_empty()) {
+    return false;
+  }
   if (!this->is_set() || !rect.is_set()) {
     return true;
   }
@@ -87,7 +96,9 @@ bool Rect::inside(Rect rect, bool absolute) const {
 }
 
 void Rect::info(const std::string &prefix) {
-  if (this->is_set()) {
+  if (this->is_empty()) {
+    ESP_LOGI(TAG, "%s ** IS EMPTY **", prefix.c_str());
+  } else if (this->is_set()) {
     ESP_LOGI(TAG, "%s [%3d,%3d,%3d,%3d] (%3d,%3d)", prefix.c_str(), this->x, this->y, this->w, this->h, this->x2(),
              this->y2());
   } else
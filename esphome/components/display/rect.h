@@ -20,6 +20,8 @@ class Rect {
   inline int16_t y2() const { return this->y + this->h; };  ///< Y coordinate of corner
 
   inline bool is_set() const ESPHOME_ALWAYS_INLINE { return (this->h != VALUE_NO_SET) && (this->w != VALUE_NO_SET); }
+  /// Whether this is a rectangle without any area, like shrink() leaves when nothing overlaps.
+  inline bool is_empty() const ESPHOME_ALWAYS_INLINE { return this->is_set() && (this->w < 0 || this->h < 0); }
 
   void expand(int16_t horizontal, int16_t vertical);
 
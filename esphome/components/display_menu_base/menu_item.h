@@ -44,9 +44,9 @@ class MenuItem {
   MenuItemMenu *get_parent() { return this->parent_; }
   MenuItemType get_type() const { return this->item_type_; }
   template<typename V> void set_text(V val) { this->text_ = val; }
-  void add_on_enter_callback(std::function<void()> &&cb) { this->on_enter_callbacks_.add(std::move(cb)); }
-  void add_on_leave_callback(std::function<void()> &&cb) { this->on_leave_callbacks_.add(std::move(cb)); }
-  void add_on_value_callback(std::function<void()> &&cb) { this->on_value_callbacks_.add(std::move(cb)); }
+  void add_on_enter_callback(Callback<void()> &&cb) { this->on_enter_callbacks_.add(std::move(cb)); }
+  void add_on_leave_callback(Callback<void()> &&cb) { this->on_leave_callbacks_.add(std::move(cb)); }
+  void add_on_value_callback(Callback<void()> &&cb) { this->on_value_callbacks_.add(std::move(cb)); }
 
   std::string get_text() const { return const_cast<MenuItem *>(this)->text_.value(this); }
   virtual bool get_immediate_edit() const { return false; }
@@ -170,8 +170,8 @@ class MenuItemCommand : public MenuItem {
 class MenuItemCustom : public MenuItemEditable {
  public:
   explicit MenuItemCustom() : MenuItemEditable(MENU_ITEM_CUSTOM) {}
-  void add_on_next_callback(std::function<void()> &&cb) { this->on_next_callbacks_.add(std::move(cb)); }
-  void add_on_prev_callback(std::function<void()> &&cb) { this->on_prev_callbacks_.add(std::move(cb)); }
+  void add_on_next_callback(Callback<void()> &&cb) { this->on_next_callbacks_.add(std::move(cb)); }
+  void add_on_prev_callback(Callback<void()> &&cb) { this->on_prev_callbacks_.add(std::move(cb)); }
 
   bool has_value() const override { return this->value_getter_.has_value(); }
   std::string get_value_text() const override;
@@ -34,7 +34,25 @@ void arch_restart() {
   }
 }
 
+static TaskHandle_t wake_loop_task = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void IRAM_ATTR HOT arch_sleep_loop(uint32_t ms) { ulTaskNotifyTake(pdTRUE, ms / portTICK_PERIOD_MS); }
+void IRAM_ATTR HOT arch_wake_loop() {
+  if (wake_loop_task == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(wake_loop_task, &higher_priority_task_woken);
+    if (higher_priority_task_woken == pdTRUE)
+      portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(wake_loop_task);
+  }
+}
+
 void arch_init() {
+  wake_loop_task = xTaskGetCurrentTaskHandle();
+
   // Enable the task watchdog only on the loop task (from which we're currently running)
 #if defined(USE_ESP_IDF)
   esp_task_wdt_add(nullptr);
@@ -335,13 +335,13 @@ void ESP32Camera::set_idle_update_interval(uint32_t idle_update_interval) {
 }
 
 /* ---------------- public API (specific) ---------------- */
-void ESP32Camera::add_image_callback(std::function<void(std::shared_ptr<CameraImage>)> &&callback) {
+void ESP32Camera::add_image_callback(Callback<void(std::shared_ptr<CameraImage>)> &&callback) {
   this->new_image_callback_.add(std::move(callback));
 }
-void ESP32Camera::add_stream_start_callback(std::function<void()> &&callback) {
+void ESP32Camera::add_stream_start_callback(Callback<void()> &&callback) {
   this->stream_start_callback_.add(std::move(callback));
 }
-void ESP32Camera::add_stream_stop_callback(std::function<void()> &&callback) {
+void ESP32Camera::add_stream_stop_callback(Callback<void()> &&callback) {
   this->stream_stop_callback_.add(std::move(callback));
 }
 void ESP32Camera::start_stream(CameraRequester requester) {
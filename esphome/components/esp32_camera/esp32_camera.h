@@ -157,9 +157,9 @@ class ESP32Camera : public Component, public EntityBase {
   void request_image(CameraRequester requester);
   void update_camera_parameters();
 
-  void add_image_callback(std::function<void(std::shared_ptr<CameraImage>)> &&callback);
-  void add_stream_start_callback(std::function<void()> &&callback);
-  void add_stream_stop_callback(std::function<void()> &&callback);
+  void add_image_callback(Callback<void(std::shared_ptr<CameraImage>)> &&callback);
+  void add_stream_start_callback(Callback<void()> &&callback);
+  void add_stream_stop_callback(Callback<void()> &&callback);
 
  protected:
   /* internal methods */
@@ -0,0 +1,83 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome import pins
+from esphome.components.esp32 import const, only_on_variant
+from esphome.const import (
+    CONF_CLOCK_PIN,
+    CONF_DC_PIN,
+    CONF_ID,
+    CONF_LIGHT,
+    CONF_PIN,
+    CONF_PLATFORM,
+)
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["esp32"]
+MULTI_CONF = True
+
+CONF_ESP32_PARALLEL_LED_STRIP_ID = "esp32_parallel_led_strip_id"
+
+# The LCD peripheral of the ESP32-S3 has at most 16 data lines
+MAX_STRIPS = 16
+
+esp32_parallel_led_strip_ns = cg.esphome_ns.namespace("esp32_parallel_led_strip")
+ESP32ParallelLEDStrip = esp32_parallel_led_strip_ns.class_(
+    "ESP32ParallelLEDStrip", cg.Component
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ESP32ParallelLEDStrip),
+            # The LCD peripheral needs a clock and a data/command pin, neither is connected to the strips
+            cv.Required(CONF_CLOCK_PIN): pins.internal_gpio_output_pin_number,
+            cv.Required(CONF_DC_PIN): pins.internal_gpio_output_pin_number,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    only_on_variant(supported=[const.VARIANT_ESP32S3]),
+    cv.only_with_esp_idf,
+)
+
+
+def _final_validate(config):
+    full_config = fv.full_config.get()
+    strips = [
+        conf
+        for conf in full_config.get(CONF_LIGHT, [])
+        if conf[CONF_PLATFORM] == "esp32_parallel_led_strip"
+        and conf[CONF_ESP32_PARALLEL_LED_STRIP_ID] == config[CONF_ID]
+    ]
+    if not strips:
+        raise cv.Invalid(f"No light uses {config[CONF_ID]}")
+    if len(strips) > MAX_STRIPS:
+        raise cv.Invalid(
+            f"{config[CONF_ID]} drives {len(strips)} strips, "
+            f"at most {MAX_STRIPS} are supported"
+        )
+    if config[CONF_CLOCK_PIN] == config[CONF_DC_PIN]:
+        raise cv.Invalid("The clock and DC pins must be different", [CONF_DC_PIN])
+    # The data lines are routed to the strip pins, none of them may be shared
+    pins_used = {
+        config[CONF_CLOCK_PIN]: f"the clock pin of {config[CONF_ID]}",
+        config[CONF_DC_PIN]: f"the DC pin of {config[CONF_ID]}",
+    }
+    for conf in strips:
+        pin = conf[CONF_PIN]
+        if pin in pins_used:
+            raise cv.Invalid(
+                f"GPIO{pin} of {conf[CONF_ID]} is already used as {pins_used[pin]}"
+            )
+        pins_used[pin] = f"the data pin of {conf[CONF_ID]}"
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_clock_pin(config[CONF_CLOCK_PIN]))
+    cg.add(var.set_dc_pin(config[CONF_DC_PIN]))
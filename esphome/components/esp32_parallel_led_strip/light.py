@@ -0,0 +1,66 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import pins
+from esphome.components import light
+from esphome.const import (
+    CONF_IS_RGBW,
+    CONF_NUM_LEDS,
+    CONF_OUTPUT_ID,
+    CONF_PIN,
+    CONF_RGB_ORDER,
+)
+
+from . import (
+    CONF_ESP32_PARALLEL_LED_STRIP_ID,
+    ESP32ParallelLEDStrip,
+    esp32_parallel_led_strip_ns,
+)
+
+DEPENDENCIES = ["esp32_parallel_led_strip"]
+
+ESP32ParallelLEDStripLightOutput = esp32_parallel_led_strip_ns.class_(
+    "ESP32ParallelLEDStripLightOutput", light.AddressableLight
+)
+
+RGBOrder = esp32_parallel_led_strip_ns.enum("RGBOrder")
+
+RGB_ORDERS = {
+    "RGB": RGBOrder.ORDER_RGB,
+    "RBG": RGBOrder.ORDER_RBG,
+    "GRB": RGBOrder.ORDER_GRB,
+    "GBR": RGBOrder.ORDER_GBR,
+    "BGR": RGBOrder.ORDER_BGR,
+    "BRG": RGBOrder.ORDER_BRG,
+}
+
+CONF_IS_WRGB = "is_wrgb"
+
+CONFIG_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend(
+    {
+        cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(ESP32ParallelLEDStripLightOutput),
+        cv.GenerateID(CONF_ESP32_PARALLEL_LED_STRIP_ID): cv.use_id(
+            ESP32ParallelLEDStrip
+        ),
+        cv.Required(CONF_PIN): pins.internal_gpio_output_pin_number,
+        cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+        cv.Required(CONF_RGB_ORDER): cv.enum(RGB_ORDERS, upper=True),
+        cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
+        cv.Optional(CONF_IS_WRGB, default=False): cv.boolean,
+    }
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
+    await light.register_light(var, config)
+    await cg.register_component(var, config)
+
+    parent = await cg.get_variable(config[CONF_ESP32_PARALLEL_LED_STRIP_ID])
+    cg.add(var.set_parent(parent))
+    cg.add(parent.add_strip(var))
+
+    cg.add(var.set_pin(config[CONF_PIN]))
+    cg.add(var.set_num_leds(config[CONF_NUM_LEDS]))
+    cg.add(var.set_rgb_order(config[CONF_RGB_ORDER]))
+    cg.add(var.set_is_rgbw(config[CONF_IS_RGBW]))
+    cg.add(var.set_is_wrgb(config[CONF_IS_WRGB]))
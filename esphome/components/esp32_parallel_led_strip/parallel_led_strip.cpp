@@ -0,0 +1,274 @@
+#include "parallel_led_strip.h"
+
+#ifdef USE_ESP32_VARIANT_ESP32S3
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+static const char *const TAG = "esp32_parallel_led_strip";
+
+/// Three clock cycles per bit of 1.25 µs.
+static const uint32_t PCLK_HZ = 2400000;
+/// Bus cycles of low output after every frame, so the LEDs latch the data (300 µs).
+static const size_t RESET_CYCLES = 720;
+/// Checked by the config validation already.
+static const size_t MAX_STRIPS = 16;
+
+void ESP32ParallelLEDStripLightOutput::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up ESP32 parallel LED strip...");
+
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  this->buf_ = allocator.allocate(this->get_buffer_size());
+  if (this->buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate LED buffer!");
+    this->mark_failed();
+    return;
+  }
+  memset(this->buf_, 0, this->get_buffer_size());
+
+  this->effect_data_ = allocator.allocate(this->num_leds_);
+  if (this->effect_data_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate effect data!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void ESP32ParallelLEDStripLightOutput::write_state(light::LightState *state) {
+  // All strips are sent together by the parent, which picks up the new data once the previous frame has been sent
+  this->parent_->request_frame();
+}
+
+light::ESPColorView ESP32ParallelLEDStripLightOutput::get_view_internal(int32_t index) const {
+  light::ESPPixelSpan span = this->get_pixel_span_();
+  uint8_t *led = span.data + index * span.stride;
+  return {led + span.offsets[0],
+          led + span.offsets[1],
+          led + span.offsets[2],
+          span.channels == 4 ? led + span.offsets[3] : nullptr,
+          &this->effect_data_[index],
+          &this->correction_};
+}
+
+light::ESPPixelSpan ESP32ParallelLEDStripLightOutput::get_pixel_span_() const {
+  uint8_t r = 0, g = 0, b = 0;
+  switch (this->rgb_order_) {
+    case ORDER_RGB:
+      r = 0;
+      g = 1;
+      b = 2;
+      break;
+    case ORDER_RBG:
+      r = 0;
+      g = 2;
+      b = 1;
+      break;
+    case ORDER_GRB:
+      r = 1;
+      g = 0;
+      b = 2;
+      break;
+    case ORDER_GBR:
+      r = 2;
+      g = 0;
+      b = 1;
+      break;
+    case ORDER_BGR:
+      r = 2;
+      g = 1;
+      b = 0;
+      break;
+    case ORDER_BRG:
+      r = 1;
+      g = 2;
+      b = 0;
+      break;
+  }
+  light::ESPPixelSpan span;
+  span.data = this->buf_;
+  span.stride = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
+  span.channels = span.stride;
+  span.offsets[0] = r + this->is_wrgb_;
+  span.offsets[1] = g + this->is_wrgb_;
+  span.offsets[2] = b + this->is_wrgb_;
+  span.offsets[3] = this->is_wrgb_ ? 0 : 3;
+  return span;
+}
+
+void ESP32ParallelLEDStripLightOutput::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 Parallel LED Strip:");
+  ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
+  ESP_LOGCONFIG(TAG, "  Number of LEDs: %u", this->num_leds_);
+}
+
+float ESP32ParallelLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+static bool IRAM_ATTR on_frame_sent(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata,
+                                    void *user_ctx) {
+#else
+static bool IRAM_ATTR on_frame_sent(esp_lcd_panel_io_handle_t io, void *user_ctx, void *event_data) {
+#endif
+  static_cast<std::atomic<bool> *>(user_ctx)->store(false);
+  return false;
+}
+
+void ESP32ParallelLEDStrip::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up ESP32 parallel LED strip bus...");
+
+  if (this->strips_.empty() || this->strips_.size() > MAX_STRIPS) {
+    ESP_LOGE(TAG, "Between 1 and %u strips are supported, got %u", MAX_STRIPS, this->strips_.size());
+    this->mark_failed();
+    return;
+  }
+  this->bus_width_ = this->strips_.size() > 8 ? 16 : 8;
+  for (auto *strip : this->strips_)
+    this->max_buffer_size_ = std::max(this->max_buffer_size_, strip->get_buffer_size());
+
+  // 8 bits per byte, 3 bus cycles per bit
+  const size_t bytes_per_cycle = this->bus_width_ / 8;
+  this->dma_size_ = (this->max_buffer_size_ * 8 * 3 + RESET_CYCLES) * bytes_per_cycle;
+  this->dma_buf_ = static_cast<uint8_t *>(heap_caps_malloc(this->dma_size_, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+  if (this->dma_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate DMA buffer of %u bytes!", this->dma_size_);
+    this->mark_failed();
+    return;
+  }
+  // The reset at the end is never written again
+  memset(this->dma_buf_, 0, this->dma_size_);
+
+  esp_lcd_i80_bus_config_t bus_config;
+  memset(&bus_config, 0, sizeof(bus_config));
+  bus_config.dc_gpio_num = this->dc_pin_;
+  bus_config.wr_gpio_num = this->clock_pin_;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  bus_config.clk_src = LCD_CLK_SRC_DEFAULT;
+#endif
+  // Every data line of the bus needs a pin. Unused lines carry a copy of the first strip's data and are routed to
+  // its pin as well, the pin ends up with the last of these identical signals.
+  for (size_t i = 0; i < this->bus_width_; i++)
+    bus_config.data_gpio_nums[i] = this->strips_[i < this->strips_.size() ? i : 0]->get_pin();
+  bus_config.bus_width = this->bus_width_;
+  bus_config.max_transfer_bytes = this->dma_size_;
+  if (esp_lcd_new_i80_bus(&bus_config, &this->bus_) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot initialize LCD bus!");
+    this->mark_failed();
+    return;
+  }
+
+  esp_lcd_panel_io_i80_config_t io_config;
+  memset(&io_config, 0, sizeof(io_config));
+  io_config.cs_gpio_num = -1;
+  io_config.pclk_hz = PCLK_HZ;
+  io_config.trans_queue_depth = 1;
+  io_config.on_color_trans_done = on_frame_sent;
+  io_config.user_ctx = &this->busy_;
+  io_config.lcd_cmd_bits = this->bus_width_;
+  io_config.lcd_param_bits = this->bus_width_;
+  io_config.dc_levels.dc_data_level = 1;
+  if (esp_lcd_new_panel_io_i80(this->bus_, &io_config, &this->io_) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot initialize LCD panel IO!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void ESP32ParallelLEDStrip::request_frame() {
+  this->frame_requested_ = true;
+  this->enable_loop();
+}
+
+void ESP32ParallelLEDStrip::loop() {
+  // Wait for the previous frame to be sent, but stop polling once there is nothing left to send
+  if (this->busy_.load())
+    return;
+  if (!this->frame_requested_) {
+    this->disable_loop();
+    return;
+  }
+  this->frame_requested_ = false;
+
+  this->encode_();
+  this->busy_.store(true);
+  // The command phase is a single cycle of low outputs, the same as the idle level of the strips
+  if (esp_lcd_panel_io_tx_color(this->io_, 0, this->dma_buf_, this->dma_size_) != ESP_OK) {
+    this->busy_.store(false);
+    ESP_LOGE(TAG, "Sending frame failed");
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+  // The frame is on its way now, with the data every strip had when it was encoded
+  for (auto *strip : this->strips_)
+    strip->mark_shown_();
+}
+
+/// Transpose an 8x8 matrix of bits: bit c of byte r ends up as bit r of byte c.
+static inline uint64_t transpose8x8(uint64_t x) {
+  uint64_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+  x = x ^ t ^ (t << 28);
+  return x;
+}
+
+void ESP32ParallelLEDStrip::encode_() {
+  const size_t num_strips = this->strips_.size();
+  uint8_t *out = this->dma_buf_;
+  for (size_t pos = 0; pos < this->max_buffer_size_; pos++) {
+    // Byte n of lanes[l] is the byte of data line 8 * l + n, strips that are shorter than this send nothing
+    uint64_t lanes[2] = {0, 0};
+    uint16_t active = 0;
+    for (size_t line = 0; line < this->bus_width_; line++) {
+      const auto *strip = this->strips_[line < num_strips ? line : 0];
+      if (pos >= strip->get_buffer_size() || strip->get_buffer() == nullptr)
+        continue;
+      lanes[line / 8] |= uint64_t(strip->get_buffer()[pos]) << (8 * (line % 8));
+      active |= 1 << line;
+    }
+    // Afterwards byte n holds bit n of every data line
+    const uint64_t bits[2] = {transpose8x8(lanes[0]), transpose8x8(lanes[1])};
+    for (int bit = 7; bit >= 0; bit--) {
+      const uint16_t data = ((bits[0] >> (8 * bit)) & 0xFF) | (((bits[1] >> (8 * bit)) & 0xFF) << 8);
+      if (this->bus_width_ == 8) {
+        *out++ = active;
+        *out++ = data;
+        *out++ = 0;
+      } else {
+        // The LCD peripheral takes 16-bit words in little endian order
+        const uint16_t words[3] = {active, data, 0};
+        memcpy(out, words, sizeof(words));
+        out += sizeof(words);
+      }
+    }
+  }
+}
+
+void ESP32ParallelLEDStrip::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 Parallel LED Strip Bus:");
+  ESP_LOGCONFIG(TAG, "  Clock Pin: %u", this->clock_pin_);
+  ESP_LOGCONFIG(TAG, "  DC Pin: %u", this->dc_pin_);
+  ESP_LOGCONFIG(TAG, "  Strips: %u", this->strips_.size());
+  ESP_LOGCONFIG(TAG, "  Bus Width: %u", this->bus_width_);
+  ESP_LOGCONFIG(TAG, "  DMA Buffer: %u bytes", this->dma_size_);
+}
+
+float ESP32ParallelLEDStrip::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32_VARIANT_ESP32S3
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifdef USE_ESP32_VARIANT_ESP32S3
+
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/core/color.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <esp_lcd_panel_io.h>
+
+#include <atomic>
+#include <vector>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+enum RGBOrder : uint8_t {
+  ORDER_RGB,
+  ORDER_RBG,
+  ORDER_GRB,
+  ORDER_GBR,
+  ORDER_BGR,
+  ORDER_BRG,
+};
+
+class ESP32ParallelLEDStrip;
+
+/// One strip of WS2812 compatible LEDs, driven by one data line of an ESP32ParallelLEDStrip.
+class ESP32ParallelLEDStripLightOutput : public light::AddressableLight, public Parented<ESP32ParallelLEDStrip> {
+ public:
+  void setup() override;
+  void write_state(light::LightState *state) override;
+  float get_setup_priority() const override;
+
+  int32_t size() const override { return this->num_leds_; }
+  light::LightTraits get_traits() override {
+    auto traits = light::LightTraits();
+    if (this->is_rgbw_ || this->is_wrgb_) {
+      traits.set_supported_color_modes({light::ColorMode::RGB_WHITE, light::ColorMode::WHITE});
+    } else {
+      traits.set_supported_color_modes({light::ColorMode::RGB});
+    }
+    return traits;
+  }
+
+  void set_pin(uint8_t pin) { this->pin_ = pin; }
+  void set_num_leds(uint16_t num_leds) { this->num_leds_ = num_leds; }
+  void set_is_rgbw(bool is_rgbw) { this->is_rgbw_ = is_rgbw; }
+  void set_is_wrgb(bool is_wrgb) { this->is_wrgb_ = is_wrgb; }
+  void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
+
+  uint8_t get_pin() const { return this->pin_; }
+  /// The bytes to send, in the order they go out on the wire, or nullptr if they couldn't be allocated.
+  const uint8_t *get_buffer() const { return this->buf_; }
+  size_t get_buffer_size() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
+
+  void clear_effect_data() override {
+    for (int i = 0; i < this->size(); i++)
+      this->effect_data_[i] = 0;
+  }
+
+  void dump_config() override;
+
+ protected:
+  // Marks the strips as shown when it starts sending a frame
+  friend class ESP32ParallelLEDStrip;
+
+  light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPPixelSpan get_pixel_span_() const override;
+
+  uint8_t *buf_{nullptr};
+  uint8_t *effect_data_{nullptr};
+
+  uint8_t pin_;
+  uint16_t num_leds_;
+  bool is_rgbw_;
+  bool is_wrgb_;
+  RGBOrder rgb_order_;
+};
+
+/** Sends the data of up to 16 LED strips at the same time, using the LCD peripheral of the ESP32-S3 with DMA.
+ *
+ * Each strip is connected to one data line of the LCD bus. Every bit is sent as three cycles of the 2.4 MHz bus
+ * clock: high, the bit and low, which gives the 1.25 µs bit time of WS2812 compatible LEDs. The bits of all strips
+ * are interleaved into one DMA buffer, so a frame takes as long as that of the longest strip alone.
+ */
+class ESP32ParallelLEDStrip : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+  void set_clock_pin(uint8_t pin) { this->clock_pin_ = pin; }
+  void set_dc_pin(uint8_t pin) { this->dc_pin_ = pin; }
+  void add_strip(ESP32ParallelLEDStripLightOutput *strip) { this->strips_.push_back(strip); }
+
+  /// Send a new frame with the current data of all strips as soon as the previous one has been sent.
+  void request_frame();
+
+ protected:
+  /// Interleave the data of all strips into the DMA buffer.
+  void encode_();
+
+  std::vector<ESP32ParallelLEDStripLightOutput *> strips_;
+  esp_lcd_i80_bus_handle_t bus_{nullptr};
+  esp_lcd_panel_io_handle_t io_{nullptr};
+  uint8_t *dma_buf_{nullptr};
+  size_t dma_size_{0};
+  /// Size of the data of the longest strip.
+  size_t max_buffer_size_{0};
+  uint8_t bus_width_{8};
+  uint8_t clock_pin_;
+  uint8_t dc_pin_;
+  bool frame_requested_{false};
+  /// Set while DMA is sending a frame, cleared from the interrupt once it's done.
+  std::atomic<bool> busy_{false};
+};
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32_VARIANT_ESP32S3
@@ -8,6 +8,8 @@
 
 #include <esp_attr.h>
 
+#include <algorithm>
+
 namespace esphome {
 namespace esp32_rmt_led_strip {
 
@@ -17,6 +19,9 @@ static const uint32_t RMT_CLK_FREQ = 80000000;
 
 static const uint8_t RMT_CLK_DIV = 2;
 
+/// How long a frame may take to be sent before giving up on it.
+static const uint32_t TX_TIMEOUT_US = 1000000;
+
 void ESP32RMTLEDStripLightOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ESP32 LED Strip...");
 
@@ -37,15 +42,19 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  ExternalRAMAllocator<rmt_item32_t> rmt_allocator(ExternalRAMAllocator<rmt_item32_t>::ALLOW_FAILURE);
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8);  // 8 bits per byte, 1 rmt_item32_t per bit
+  if (!this->front_buffer_.allocate(buffer_size)) {
+    ESP_LOGE(TAG, "Cannot allocate transmit buffer!");
+    this->mark_failed();
+    return;
+  }
 
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
   config.channel = this->channel_;
   config.rmt_mode = RMT_MODE_TX;
   config.gpio_num = gpio_num_t(this->pin_);
-  config.mem_block_num = 1;
+  // The translator refills the memory from the RMT interrupt, one block leaves too little time for that
+  config.mem_block_num = this->mem_blocks_;
   config.clk_div = RMT_CLK_DIV;
   config.tx_config.loop_en = false;
   config.tx_config.carrier_level = RMT_CARRIER_LEVEL_LOW;
@@ -63,6 +72,37 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+  if (rmt_translator_init(config.channel, translate_) != ESP_OK ||
+      rmt_translator_set_context(config.channel, this) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot initialize RMT translator!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::translate_(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                       size_t wanted_num, size_t *translated_size, size_t *item_num) {
+  ESP32RMTLEDStripLightOutput *light;
+  if (src == nullptr || dest == nullptr || rmt_translator_get_context(item_num, (void **) &light) != ESP_OK) {
+    *translated_size = 0;
+    *item_num = 0;
+    return;
+  }
+  const uint32_t bit0 = light->bit0_.val;
+  const uint32_t bit1 = light->bit1_.val;
+  const uint8_t *psrc = static_cast<const uint8_t *>(src);
+  // Only whole bytes, one RMT item per bit
+  size_t size = std::min(src_size, wanted_num / 8);
+  for (size_t i = 0; i < size; i++) {
+    uint8_t b = psrc[i];
+    for (int bit = 0; bit < 8; bit++) {
+      dest->val = b & 0x80 ? bit1 : bit0;
+      b <<= 1;
+      dest++;
+    }
+  }
+  *translated_size = size;
+  *item_num = size * 8;
 }
 
 void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
@@ -89,36 +129,28 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+
+  // The previous frame is sent in the background, if it is still going on try again next loop iteration
+  if (rmt_wait_tx_done(this->channel_, 0) != ESP_OK) {
+    if (now - this->last_refresh_ > TX_TIMEOUT_US) {
+      ESP_LOGW(TAG, "RMT TX timeout");
+      this->status_set_warning();
+      return;
+    }
+    this->schedule_show();
+    return;
+  }
   this->last_refresh_ = now;
   this->mark_shown_();
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
 
-  if (rmt_wait_tx_done(this->channel_, pdMS_TO_TICKS(1000)) != ESP_OK) {
-    ESP_LOGE(TAG, "RMT TX timeout");
-    this->status_set_warning();
-    return;
-  }
+  // Reset time between frames
   delayMicroseconds(50);
 
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_item32_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (rmt_write_items(this->channel_, this->rmt_buf_, len, false) != ESP_OK) {
+  // The bytes are only turned into RMT items while they are sent, in small chunks from the RMT interrupt
+  const uint8_t *frame = this->front_buffer_.present(this->buf_);
+  if (rmt_write_sample(this->channel_, frame, this->front_buffer_.size(), false) != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
     this->status_set_warning();
     return;
@@ -127,7 +159,18 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
 }
 
 light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0;
+  light::ESPPixelSpan span = this->get_pixel_span_();
+  uint8_t *led = span.data + index * span.stride;
+  return {led + span.offsets[0],
+          led + span.offsets[1],
+          led + span.offsets[2],
+          span.channels == 4 ? led + span.offsets[3] : nullptr,
+          &this->effect_data_[index],
+          &this->correction_};
+}
+
+light::ESPPixelSpan ESP32RMTLEDStripLightOutput::get_pixel_span_() const {
+  uint8_t r = 0, g = 0, b = 0;
   switch (this->rgb_order_) {
     case ORDER_RGB:
       r = 0;
@@ -160,21 +203,22 @@ light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index
       b = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
-  uint8_t white = this->is_wrgb_ ? 0 : 3;
-
-  return {this->buf_ + (index * multiplier) + r + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + g + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + b + this->is_wrgb_,
-          this->is_rgbw_ || this->is_wrgb_ ? this->buf_ + (index * multiplier) + white : nullptr,
-          &this->effect_data_[index],
-          &this->correction_};
+  light::ESPPixelSpan span;
+  span.data = this->buf_;
+  span.stride = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
+  span.channels = span.stride;
+  span.offsets[0] = r + this->is_wrgb_;
+  span.offsets[1] = g + this->is_wrgb_;
+  span.offsets[2] = b + this->is_wrgb_;
+  span.offsets[3] = this->is_wrgb_ ? 0 : 3;
+  return span;
 }
 
 void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "ESP32 RMT LED Strip:");
   ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
   ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  ESP_LOGCONFIG(TAG, "  Memory Blocks: %u", this->mem_blocks_);
   const char *rgb_order;
   switch (this->rgb_order_) {
     case ORDER_RGB:
@@ -53,6 +53,8 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
   void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
   void set_rmt_channel(rmt_channel_t channel) { this->channel_ = channel; }
+  /// Number of RMT memory blocks to use, taken from the channel and the channels after it.
+  void set_rmt_memory_blocks(uint8_t blocks) { this->mem_blocks_ = blocks; }
 
   void clear_effect_data() override {
     for (int i = 0; i < this->size(); i++)
@@ -63,12 +65,18 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPPixelSpan get_pixel_span_() const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
+  /// RMT translator, turns the bytes of a frame into RMT items as the driver needs them during the transmission.
+  static void translate_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                         size_t *translated_size, size_t *item_num);
+
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
-  rmt_item32_t *rmt_buf_{nullptr};
+  /// The frame that is being sent, so the next frame can be prepared in buf_ in the meantime.
+  light::AddressableFrontBuffer front_buffer_;
 
   uint8_t pin_;
   uint16_t num_leds_;
@@ -78,6 +86,7 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   rmt_item32_t bit0_, bit1_;
   RGBOrder rgb_order_;
   rmt_channel_t channel_;
+  uint8_t mem_blocks_{2};
 
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
@@ -2,15 +2,20 @@ from dataclasses import dataclass
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome import pins
-from esphome.components import esp32_rmt, light
+from esphome.components import esp32, esp32_rmt, light
 from esphome.const import (
     CONF_CHIPSET,
+    CONF_ID,
     CONF_IS_RGBW,
+    CONF_LIGHT,
     CONF_MAX_REFRESH_RATE,
+    CONF_MEMORY_BLOCKS,
     CONF_NUM_LEDS,
     CONF_OUTPUT_ID,
     CONF_PIN,
+    CONF_PLATFORM,
     CONF_RGB_ORDER,
     CONF_RMT_CHANNEL,
 )
@@ -58,6 +63,80 @@ CONF_BIT0_HIGH = "bit0_high"
 CONF_BIT0_LOW = "bit0_low"
 CONF_BIT1_HIGH = "bit1_high"
 CONF_BIT1_LOW = "bit1_low"
+CONF_RMT_MEMORY_BLOCKS = "rmt_memory_blocks"
+
+# Memory blocks of all RMT channels together. A channel can use those of the channels
+# after it.
+RMT_MEMORY_BLOCKS = {
+    esp32.const.VARIANT_ESP32: 8,
+    esp32.const.VARIANT_ESP32S2: 4,
+    esp32.const.VARIANT_ESP32S3: 8,
+    esp32.const.VARIANT_ESP32C3: 4,
+    esp32.const.VARIANT_ESP32C6: 4,
+    esp32.const.VARIANT_ESP32H2: 4,
+}
+
+
+def _validate_rmt_memory_blocks(config):
+    if CONF_RMT_MEMORY_BLOCKS not in config:
+        return config
+    channel = int(config[CONF_RMT_CHANNEL])
+    available = RMT_MEMORY_BLOCKS[esp32.get_esp32_variant()] - channel
+    if config[CONF_RMT_MEMORY_BLOCKS] > available:
+        raise cv.Invalid(
+            f"RMT channel {channel} can use at most {available} memory blocks",
+            [CONF_RMT_MEMORY_BLOCKS],
+        )
+    return config
+
+
+def _rmt_users(full_config):
+    """The RMT channels set in the config, as (config, channel, blocks or None)."""
+    users = []
+    for conf in full_config.get(CONF_LIGHT, []):
+        if conf[CONF_PLATFORM] == "esp32_rmt_led_strip":
+            users.append(
+                (conf, int(conf[CONF_RMT_CHANNEL]), conf.get(CONF_RMT_MEMORY_BLOCKS))
+            )
+    for domain, default_blocks in (("remote_transmitter", 1), ("remote_receiver", 3)):
+        for conf in full_config.get(domain, []):
+            if CONF_RMT_CHANNEL in conf:
+                blocks = conf.get(CONF_MEMORY_BLOCKS, default_blocks)
+                users.append((conf, int(conf[CONF_RMT_CHANNEL]), blocks))
+    return users
+
+
+def _final_validate(config):
+    full_config = fv.full_config.get()
+    total = RMT_MEMORY_BLOCKS[esp32.get_esp32_variant()]
+    users = _rmt_users(full_config)
+    channels = {channel for _, channel, _ in users}
+
+    def blocks_of(channel, blocks):
+        if blocks is not None:
+            return blocks
+        # The frame is translated from the RMT interrupt, which underruns easily with a
+        # single block. Only take the block of the next channel if nothing else is set
+        # to use that channel.
+        if channel + 1 < total and channel + 1 not in channels:
+            return 2
+        return 1
+
+    channel = int(config[CONF_RMT_CHANNEL])
+    blocks = blocks_of(channel, config.get(CONF_RMT_MEMORY_BLOCKS))
+    config[CONF_RMT_MEMORY_BLOCKS] = blocks
+    for other, other_channel, other_blocks in users:
+        if other is config:
+            continue
+        other_blocks = blocks_of(other_channel, other_blocks)
+        if channel < other_channel + other_blocks and other_channel < channel + blocks:
+            raise cv.Invalid(
+                f"The RMT memory blocks of channel {channel} ({blocks} blocks) "
+                f"overlap with those of channel {other_channel} ({other_blocks} "
+                f"blocks), used by {other[CONF_ID]}",
+                [CONF_RMT_MEMORY_BLOCKS],
+            )
+    return config
 
 
 CONFIG_SCHEMA = cv.All(
@@ -68,6 +147,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
             cv.Required(CONF_RGB_ORDER): cv.enum(RGB_ORDERS, upper=True),
             cv.Required(CONF_RMT_CHANNEL): esp32_rmt.validate_rmt_channel(tx=True),
+            cv.Optional(CONF_RMT_MEMORY_BLOCKS): cv.int_range(min=1, max=8),
             cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
             cv.Optional(CONF_CHIPSET): cv.one_of(*CHIPSETS, upper=True),
             cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
@@ -91,8 +171,11 @@ CONFIG_SCHEMA = cv.All(
         }
     ),
     cv.has_exactly_one_key(CONF_CHIPSET, CONF_BIT0_HIGH),
+    _validate_rmt_memory_blocks,
 )
 
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
@@ -134,3 +217,4 @@ async def to_code(config):
             getattr(rmt_channel_t, f"RMT_CHANNEL_{config[CONF_RMT_CHANNEL]}")
         )
     )
+    cg.add(var.set_rmt_memory_blocks(config[CONF_RMT_MEMORY_BLOCKS]))
@@ -7,6 +7,9 @@
 #include "preferences.h"
 #include <Arduino.h>
 #include <Esp.h>
+#if USE_ARDUINO_VERSION_CODE >= VERSION_CODE(3, 0, 0)
+#include <coredecls.h>
+#endif
 
 namespace esphome {
 
@@ -23,6 +26,20 @@ void arch_restart() {
   }
 }
 void arch_init() {}
+
+static volatile bool wake_loop_pending = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void arch_sleep_loop(uint32_t ms) {
+#if USE_ARDUINO_VERSION_CODE >= VERSION_CODE(3, 0, 0)
+  esp_delay(ms, []() { return !wake_loop_pending; }, 1);
+#else
+  const uint32_t start = ::millis();
+  while (!wake_loop_pending && ::millis() - start < ms)
+    ::delay(1);
+#endif
+  wake_loop_pending = false;
+}
+void IRAM_ATTR HOT arch_wake_loop() { wake_loop_pending = true; }
 void IRAM_ATTR HOT arch_feed_wdt() {
   ESP.wdtFeed();  // NOLINT(readability-static-accessed-through-instance)
 }
@@ -16,7 +16,7 @@ void Event::trigger(const std::string &event_type) {
   this->event_callback_.call(event_type);
 }
 
-void Event::add_on_event_callback(std::function<void(const std::string &event_type)> &&callback) {
+void Event::add_on_event_callback(Callback<void(const std::string &event_type)> &&callback) {
   this->event_callback_.add(std::move(callback));
 }
 
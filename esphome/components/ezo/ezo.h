@@ -45,7 +45,7 @@ class EZOSensor : public sensor::Sensor, public PollingComponent, public i2c::I2
 
   // Device Information
   void get_device_information();
-  void add_device_infomation_callback(std::function<void(std::string)> &&callback) {
+  void add_device_infomation_callback(Callback<void(std::string)> &&callback) {
     this->device_infomation_callback_.add(std::move(callback));
   }
 
@@ -57,7 +57,7 @@ class EZOSensor : public sensor::Sensor, public PollingComponent, public i2c::I2
 
   // Slope
   void get_slope();
-  void add_slope_callback(std::function<void(std::string)> &&callback) {
+  void add_slope_callback(Callback<void(std::string)> &&callback) {
     this->slope_callback_.add(std::move(callback));
   }
 
@@ -65,7 +65,7 @@ class EZOSensor : public sensor::Sensor, public PollingComponent, public i2c::I2
   void get_t();
   void set_t(float value);
   void set_tempcomp_value(float temp);  // For backwards compatibility
-  void add_t_callback(std::function<void(std::string)> &&callback) { this->t_callback_.add(std::move(callback)); }
+  void add_t_callback(Callback<void(std::string)> &&callback) { this->t_callback_.add(std::move(callback)); }
 
   // Calibration
   void get_calibration();
@@ -74,18 +74,18 @@ class EZOSensor : public sensor::Sensor, public PollingComponent, public i2c::I2
   void set_calibration_point_high(float value);
   void set_calibration_generic(float value);
   void clear_calibration();
-  void add_calibration_callback(std::function<void(std::string)> &&callback) {
+  void add_calibration_callback(Callback<void(std::string)> &&callback) {
     this->calibration_callback_.add(std::move(callback));
   }
 
   // LED
   void get_led_state();
   void set_led_state(bool on);
-  void add_led_state_callback(std::function<void(bool)> &&callback) { this->led_callback_.add(std::move(callback)); }
+  void add_led_state_callback(Callback<void(bool)> &&callback) { this->led_callback_.add(std::move(callback)); }
 
   // Custom
   void send_custom(const std::string &to_send);
-  void add_custom_callback(std::function<void(std::string)> &&callback) {
+  void add_custom_callback(Callback<void(std::string)> &&callback) {
     this->custom_callback_.add(std::move(callback));
   }
 
@@ -228,6 +228,16 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  light::ESPPixelSpan get_pixel_span_() const override {
+    light::ESPPixelSpan span;
+    span.data = &this->leds_[0].r;
+    span.stride = sizeof(CRGB);
+    span.channels = 3;
+    span.offsets[0] = 0;
+    span.offsets[1] = 1;
+    span.offsets[2] = 2;
+    return span;
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
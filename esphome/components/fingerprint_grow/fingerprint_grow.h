@@ -126,29 +126,29 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
   void set_enrolling_binary_sensor(binary_sensor::BinarySensor *enrolling_binary_sensor) {
     this->enrolling_binary_sensor_ = enrolling_binary_sensor;
   }
-  void add_on_finger_scan_start_callback(std::function<void()> callback) {
+  void add_on_finger_scan_start_callback(Callback<void()> &&callback) {
     this->finger_scan_start_callback_.add(std::move(callback));
   }
-  void add_on_finger_scan_matched_callback(std::function<void(uint16_t, uint16_t)> callback) {
+  void add_on_finger_scan_matched_callback(Callback<void(uint16_t, uint16_t)> &&callback) {
     this->finger_scan_matched_callback_.add(std::move(callback));
   }
-  void add_on_finger_scan_unmatched_callback(std::function<void()> callback) {
+  void add_on_finger_scan_unmatched_callback(Callback<void()> &&callback) {
     this->finger_scan_unmatched_callback_.add(std::move(callback));
   }
-  void add_on_finger_scan_misplaced_callback(std::function<void()> callback) {
+  void add_on_finger_scan_misplaced_callback(Callback<void()> &&callback) {
     this->finger_scan_misplaced_callback_.add(std::move(callback));
   }
-  void add_on_finger_scan_invalid_callback(std::function<void()> callback) {
+  void add_on_finger_scan_invalid_callback(Callback<void()> &&callback) {
     this->finger_scan_invalid_callback_.add(std::move(callback));
   }
-  void add_on_enrollment_scan_callback(std::function<void(uint8_t, uint16_t)> callback) {
+  void add_on_enrollment_scan_callback(Callback<void(uint8_t, uint16_t)> &&callback) {
     this->enrollment_scan_callback_.add(std::move(callback));
   }
-  void add_on_enrollment_done_callback(std::function<void(uint16_t)> callback) {
+  void add_on_enrollment_done_callback(Callback<void(uint16_t)> &&callback) {
     this->enrollment_done_callback_.add(std::move(callback));
   }
 
-  void add_on_enrollment_failed_callback(std::function<void(uint16_t)> callback) {
+  void add_on_enrollment_failed_callback(Callback<void(uint16_t)> &&callback) {
     this->enrollment_failed_callback_.add(std::move(callback));
   }
 
@@ -44,7 +44,7 @@ class GraphicalDisplayMenu : public display_menu_base::DisplayMenuComponent {
   void set_foreground_color(Color foreground_color);
   void set_background_color(Color background_color);
 
-  void add_on_redraw_callback(std::function<void()> &&cb) { this->on_redraw_callbacks_.add(std::move(cb)); }
+  void add_on_redraw_callback(Callback<void()> &&cb) { this->on_redraw_callbacks_.add(std::move(cb)); }
 
   void draw(display::Display *display, const display::Rect *bounds);
 
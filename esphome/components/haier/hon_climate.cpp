@@ -82,11 +82,11 @@ void HonClimate::start_steri_cleaning() {
   }
 }
 
-void HonClimate::add_alarm_start_callback(std::function<void(uint8_t, const char *)> &&callback) {
+void HonClimate::add_alarm_start_callback(Callback<void(uint8_t, const char *)> &&callback) {
   this->alarm_start_callback_.add(std::move(callback));
 }
 
-void HonClimate::add_alarm_end_callback(std::function<void(uint8_t, const char *)> &&callback) {
+void HonClimate::add_alarm_end_callback(Callback<void(uint8_t, const char *)> &&callback) {
   this->alarm_end_callback_.add(std::move(callback));
 }
 
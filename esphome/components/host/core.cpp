@@ -6,8 +6,11 @@
 
 #include <sched.h>
 #include <time.h>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdlib>
+#include <mutex>
 
 namespace esphome {
 
@@ -52,6 +55,23 @@ void IRAM_ATTR HOT arch_feed_wdt() {
   // pass
 }
 
+static std::mutex wake_loop_mutex;                  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static std::condition_variable wake_loop_condition;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static bool wake_loop_pending = false;               // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void arch_sleep_loop(uint32_t ms) {
+  std::unique_lock<std::mutex> lock(wake_loop_mutex);
+  wake_loop_condition.wait_for(lock, std::chrono::milliseconds(ms), []() { return wake_loop_pending; });
+  wake_loop_pending = false;
+}
+void arch_wake_loop() {
+  {
+    std::lock_guard<std::mutex> lock(wake_loop_mutex);
+    wake_loop_pending = true;
+  }
+  wake_loop_condition.notify_one();
+}
+
 uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
 uint32_t arch_get_cpu_cycle_count() {
   struct timespec spec;
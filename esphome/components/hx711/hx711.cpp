@@ -15,16 +15,26 @@ void HX711Sensor::setup() {
 
   // Read sensor once without publishing to set the gain
   this->read_sensor_(nullptr);
+  // loop() only runs while update() is collecting a burst of samples
+  this->disable_loop();
 }
 
 void HX711Sensor::dump_config() {
   LOG_SENSOR("", "HX711", this);
   LOG_PIN("  DOUT Pin: ", this->dout_pin_);
   LOG_PIN("  SCK Pin: ", this->sck_pin_);
+  if (this->sample_count_ > 1)
+    ESP_LOGCONFIG(TAG, "  Samples: %u", this->sample_count_);
   LOG_UPDATE_INTERVAL(this);
 }
 float HX711Sensor::get_setup_priority() const { return setup_priority::DATA; }
 void HX711Sensor::update() {
+  if (this->sample_count_ > 1) {
+    // Collect the conversions in loop() as the HX711 finishes them and publish them together
+    this->samples_.clear();
+    this->enable_loop();
+    return;
+  }
   uint32_t result;
   if (this->read_sensor_(&result)) {
     int32_t value = static_cast<int32_t>(result);
@@ -32,6 +42,20 @@ void HX711Sensor::update() {
     this->publish_state(value);
   }
 }
+void HX711Sensor::loop() {
+  // DOUT stays high until the next conversion is ready
+  if (this->dout_pin_->digital_read())
+    return;
+  uint32_t result;
+  if (!this->read_sensor_(&result))
+    return;
+  this->samples_.push_back(static_cast<int32_t>(result));
+  if (this->samples_.size() < this->sample_count_)
+    return;
+  ESP_LOGD(TAG, "'%s': Got %u values", this->name_.c_str(), this->sample_count_);
+  this->publish_samples(this->samples_.data(), this->samples_.size());
+  this->disable_loop();
+}
 bool HX711Sensor::read_sensor_(uint32_t *result) {
   if (this->dout_pin_->digital_read()) {
     ESP_LOGW(TAG, "HX711 is not ready for new measurements yet!");
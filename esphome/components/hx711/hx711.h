@@ -5,6 +5,7 @@
 #include "esphome/components/sensor/sensor.h"
 
 #include <cinttypes>
+#include <vector>
 
 namespace esphome {
 namespace hx711 {
@@ -20,11 +21,14 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   void set_dout_pin(GPIOPin *dout_pin) { dout_pin_ = dout_pin; }
   void set_sck_pin(GPIOPin *sck_pin) { sck_pin_ = sck_pin; }
   void set_gain(HX711Gain gain) { gain_ = gain; }
+  /// Read this many conversions per update and publish them all with publish_samples().
+  void set_sample_count(uint8_t sample_count) { sample_count_ = sample_count; }
 
   void setup() override;
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
+  void loop() override;
 
  protected:
   bool read_sensor_(uint32_t *result);
@@ -32,6 +36,8 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   GPIOPin *dout_pin_;
   GPIOPin *sck_pin_;
   HX711Gain gain_{HX711_GAIN_128};
+  uint8_t sample_count_{1};
+  std::vector<float> samples_;
 };
 
 }  // namespace hx711
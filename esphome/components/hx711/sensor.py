@@ -13,6 +13,7 @@ hx711_ns = cg.esphome_ns.namespace("hx711")
 HX711Sensor = hx711_ns.class_("HX711Sensor", sensor.Sensor, cg.PollingComponent)
 
 CONF_DOUT_PIN = "dout_pin"
+CONF_SAMPLES = "samples"
 
 HX711Gain = hx711_ns.enum("HX711Gain")
 GAINS = {
@@ -33,6 +34,8 @@ CONFIG_SCHEMA = (
             cv.Required(CONF_DOUT_PIN): pins.gpio_input_pin_schema,
             cv.Required(CONF_CLK_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_GAIN, default=128): cv.enum(GAINS, int=True),
+            # Pass this many conversions per update through the filters
+            cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -48,3 +51,5 @@ async def to_code(config):
     sck_pin = await cg.gpio_pin_expression(config[CONF_CLK_PIN])
     cg.add(var.set_sck_pin(sck_pin))
     cg.add(var.set_gain(config[CONF_GAIN]))
+    if config[CONF_SAMPLES] > 1:
+        cg.add(var.set_sample_count(config[CONF_SAMPLES]))
@@ -90,6 +90,7 @@ CONF_COLOR_PALETTE_IMAGES = "color_palette_images"
 CONF_INVERT_DISPLAY = "invert_display"
 CONF_PIXEL_MODE = "pixel_mode"
 CONF_INIT_SEQUENCE = "init_sequence"
+CONF_BAND_HEIGHT = "band_height"
 
 
 def cmd(c, *args):
@@ -188,6 +189,9 @@ CONFIG_SCHEMA = cv.All(
                 }
             ),
             cv.Optional(CONF_INIT_SEQUENCE): cv.ensure_list(map_sequence),
+            # Draw the page in bands of this many rows instead of keeping a buffer for the whole display.
+            # The lambda then runs once per band on every update, so it must not change state while drawing.
+            cv.Optional(CONF_BAND_HEIGHT): cv.int_range(min=1, max=1024),
         }
     )
     .extend(cv.polling_component_schema("1s"))
@@ -231,6 +235,9 @@ async def to_code(config):
         reset = await cg.gpio_pin_expression(config[CONF_RESET_PIN])
         cg.add(var.set_reset_pin(reset))
 
+    if band_height := config.get(CONF_BAND_HEIGHT):
+        cg.add(var.set_band_height(band_height))
+
     if CONF_DIMENSIONS in config:
         dimensions = config[CONF_DIMENSIONS]
         if isinstance(dimensions, dict):
@@ -57,24 +57,29 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
+  if (this->band_height_ >= this->get_height_internal())
+    this->band_height_ = 0;
+  // Has to be ready before init_internal_() clears the buffer, bands are always sent completely
+  if (this->band_height_ == 0)
+    this->dirty_.init(this->get_width_internal(), this->get_height_internal());
   if (this->buffer_color_mode_ == BITS_16) {
     this->init_internal_(this->get_buffer_length_() * 2);
-    if (this->buffer_ != nullptr) {
-      return;
-    }
-    this->buffer_color_mode_ = BITS_8;
   }
-  this->init_internal_(this->get_buffer_length_());
+  if (this->buffer_ == nullptr) {
+    if (this->buffer_color_mode_ == BITS_16)
+      this->buffer_color_mode_ = BITS_8;
+    this->init_internal_(this->get_buffer_length_());
+  }
   if (this->buffer_ == nullptr) {
     this->mark_failed();
+    return;
   }
+  // The display memory still holds whatever it powered up with
+  if (this->band_height_ == 0)
+    this->dirty_.mark_all();
 }
 
 void ILI9XXXDisplay::setup_pins_() {
@@ -94,6 +99,9 @@ void ILI9XXXDisplay::dump_config() {
   LOG_DISPLAY("", "ili9xxx", this);
   ESP_LOGCONFIG(TAG, "  Width Offset: %u", this->offset_x_);
   ESP_LOGCONFIG(TAG, "  Height Offset: %u", this->offset_y_);
+  if (this->band_height_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Band Height: %u", this->band_height_);
+  }
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       ESP_LOGCONFIG(TAG, "  Color mode: 8bit Indexed");
@@ -130,36 +138,20 @@ float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWA
 void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
-  uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  uint8_t pixel[2];
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      pixel[0] = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
       break;
     case BITS_16:
-      new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
+      put16_be(pixel, display::ColorUtil::color_to_565(color));
+      this->fill_buffer_(pixel, 2);
       return;
-      break;
     default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      pixel[0] = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
       break;
   }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+  this->fill_buffer_(pixel, 1);
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -169,6 +161,12 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
   if (!this->check_buffer_())
     return;
   uint32_t pos = (y * width_) + x;
+  if (this->band_height_ != 0) {
+    // Pixels outside of the band are drawn again when their band is
+    if (y < this->band_start_ || y >= this->band_start_ + this->band_rows_)
+      return;
+    pos -= this->band_start_ * this->width_;
+  }
   uint16_t new_color;
   bool updated = false;
   switch (this->buffer_color_mode_) {
@@ -194,16 +192,9 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     this->buffer_[pos] = new_color;
     updated = true;
   }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+  if (updated && this->band_height_ == 0) {
+    // only the tiles that changed are sent to the display
+    this->dirty_.mark(x, y);
   }
 }
 
@@ -212,24 +203,39 @@ void ILI9XXXDisplay::update() {
     this->need_update_ = true;
     return;
   }
+  if (this->band_height_ != 0 && !this->check_buffer_())
+    return;
   this->prossing_update_ = true;
   do {
     this->need_update_ = false;
-    this->do_update_();
+    if (this->band_height_ != 0) {
+      this->do_update_banded_();
+    } else {
+      this->do_update_();
+    }
   } while (this->need_update_);
   this->prossing_update_ = false;
   this->display_();
 }
 
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
+  if (this->buffer_ == nullptr || this->band_height_ != 0)
     return;
+  display::Rect rect;
+  while (this->dirty_.pop_rect(&rect)) {
+    // Other dirty rectangles in these rows went out with them as well
+    if (this->write_rect_(rect.x, rect.y, rect.x2() - 1, rect.y2() - 1))
+      this->dirty_.clear_rows(rect.y, rect.y2() - 1);
   }
+}
+
+void ILI9XXXDisplay::write_band_() {
+  this->write_rect_(0, this->band_start_, this->width_ - 1, this->band_start_ + this->band_rows_ - 1);
+}
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+bool ILI9XXXDisplay::write_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+  size_t const w = x2 - x1 + 1;
+  size_t const h = y2 - y1 + 1;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -239,22 +245,22 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x1, y1, x2, y2, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
-  if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
+  const bool whole_rows = this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time;
+  if (whole_rows) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y1, this->width_ - 1, y2);
+    this->write_array(this->buffer_ + (y1 - this->band_start_) * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x1, y1, x2, y2);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = (y1 - this->band_start_) * this->width_ + x1;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -296,11 +302,7 @@ void ILI9XXXDisplay::display_() {
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  return whole_rows;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -311,8 +313,9 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
     return;
   // if color mapping or software rotation is required, hand this off to the parent implementation. This will
   // do color conversion pixel-by-pixel into the buffer and draw it later. If this is happening the user has not
-  // configured the renderer well.
-  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian) {
+  // configured the renderer well. While a band is drawn, the pixels have to end up in the band instead.
+  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian ||
+      this->band_rows_ != 0) {
     return display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset,
                                             x_pad);
   }
@@ -363,7 +366,11 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
 
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
 // values per bit is huge
-uint32_t ILI9XXXDisplay::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal(); }
+uint32_t ILI9XXXDisplay::get_buffer_length_() {
+  if (this->band_height_ != 0)
+    return this->get_width_internal() * this->band_height_;
+  return this->get_width_internal() * this->get_height_internal();
+}
 
 void ILI9XXXDisplay::command(uint8_t value) {
   this->start_command_();
@@ -109,6 +109,12 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
 
   virtual void set_madctl();
   void display_();
+  void write_band_() override;
+  /** Send the pixels from \p x1, \p y1 to \p x2, \p y2 (inclusive) from the buffer to the display.
+   *
+   * Returns true if whole rows from \p y1 to \p y2 were sent, because that was estimated to be faster.
+   */
+  bool write_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
   virtual void init_lcd(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -119,10 +125,6 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_{};
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -3,7 +3,7 @@
 namespace esphome {
 namespace key_provider {
 
-void KeyProvider::add_on_key_callback(std::function<void(uint8_t)> &&callback) {
+void KeyProvider::add_on_key_callback(Callback<void(uint8_t)> &&callback) {
   this->key_callback_.add(std::move(callback));
 }
 
@@ -9,7 +9,7 @@ namespace key_provider {
 /// interface for components that provide keypresses
 class KeyProvider {
  public:
-  void add_on_key_callback(std::function<void(uint8_t)> &&callback);
+  void add_on_key_callback(Callback<void(uint8_t)> &&callback);
 
  protected:
   void send_key_(uint8_t key);
@@ -31,6 +31,16 @@ void arch_restart() {
   }
 }
 void IRAM_ATTR HOT arch_feed_wdt() { lt_wdt_feed(); }
+
+static volatile bool wake_loop_pending = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void arch_sleep_loop(uint32_t ms) {
+  const uint32_t start = millis();
+  while (!wake_loop_pending && millis() - start < ms)
+    delay(1);
+  wake_loop_pending = false;
+}
+void IRAM_ATTR HOT arch_wake_loop() { wake_loop_pending = true; }
 uint32_t arch_get_cpu_cycle_count() { return lt_cpu_get_cycle_count(); }
 uint32_t arch_get_cpu_freq_hz() { return lt_cpu_get_freq(); }
 uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
@@ -1,4 +1,5 @@
 #include "addressable_light.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -12,7 +13,8 @@ void AddressableLight::call_setup() {
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
-    ESP_LOGVV(TAG, "Addressable Light '%s' (effect_active=%s)", name, YESNO(this->effect_active_));
+    ESP_LOGVV(TAG, "Addressable Light '%s' (effect_active=%s, fps=%.1f)", name, YESNO(this->effect_active_),
+              this->get_fps());
     for (int i = 0; i < this->size(); i++) {
       auto color = this->get(i);
       ESP_LOGVV(TAG, "  [%2d] Color: R=%3u G=%3u B=%3u W=%3u", i, color.get_red_raw(), color.get_green_raw(),
@@ -23,6 +25,75 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+void AddressableLight::count_frame_() {
+  const uint32_t now = millis();
+  this->fps_frames_++;
+  const uint32_t elapsed = now - this->fps_start_;
+  if (elapsed >= 1000) {
+    this->fps_ = this->fps_start_ == 0 ? 0.0f : this->fps_frames_ * 1000.0f / elapsed;
+    this->fps_start_ = now;
+    this->fps_frames_ = 0;
+  }
+}
+
+float AddressableLight::get_fps() const {
+  // Nothing was sent for a while, e.g. because the light isn't changing
+  if (millis() - this->fps_start_ > 2000)
+    return 0.0f;
+  return this->fps_;
+}
+
+void AddressableLight::fill_range(int32_t from, int32_t to, const Color &color) {
+  from = interpret_index(from, this->size());
+  to = std::min(interpret_index(to, this->size()), this->size());
+  const ESPPixelSpan span = this->get_pixel_span_();
+  if (span.data == nullptr) {
+    for (int32_t i = from; i < to; i++)
+      this->get_view_internal(i) = color;
+    return;
+  }
+  uint8_t corrected[4];
+  for (uint8_t ch = 0; ch < span.channels; ch++)
+    corrected[ch] = this->correction_.color_correct_channel(ch, color.raw[ch]);
+  uint8_t *const end = span.data + to * span.stride;
+  for (uint8_t *led = span.data + from * span.stride; led < end; led += span.stride) {
+    for (uint8_t ch = 0; ch < span.channels; ch++)
+      led[span.offsets[ch]] = corrected[ch];
+  }
+}
+
+void AddressableLight::blend_range(int32_t from, int32_t to, const Color &color, uint8_t alpha) {
+  const Color add = color * alpha;
+  const uint8_t inv_alpha = 255 - alpha;
+  this->map_range(from, to, [add, inv_alpha](uint8_t ch, uint8_t value) -> uint8_t {
+    // Saturating, like Color::operator+()
+    uint16_t sum = uint16_t(add.raw[ch]) + esp_scale8(value, inv_alpha);
+    return sum > 255 ? 255 : sum;
+  });
+}
+
+void AddressableLight::apply_correction_range(int32_t from, const Color *colors, int32_t count) {
+  from = interpret_index(from, this->size());
+  const ESPPixelSpan span = this->get_pixel_span_();
+  if (span.data == nullptr) {
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(from + i) = colors[i];
+    return;
+  }
+  uint8_t *led = span.data + from * span.stride;
+  for (int32_t i = 0; i < count; i++, led += span.stride) {
+    for (uint8_t ch = 0; ch < span.channels; ch++)
+      led[span.offsets[ch]] = this->correction_.color_correct_channel(ch, colors[i].raw[ch]);
+  }
+}
+
+uint8_t *AddressableLight::get_range_lut_() {
+  if (!this->range_lut_) {
+    this->range_lut_ = std::unique_ptr<uint8_t[]>(new (std::nothrow) uint8_t[4 * 256]);  // NOLINT
+  }
+  return this->range_lut_.get();
+}
+
 std::unique_ptr<LightTransformer> AddressableLight::create_default_transition() {
   return make_unique<AddressableLightTransformer>(*this);
 }
@@ -95,13 +166,8 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   alpha255 = clamp(alpha255, 0.0f, 255.0f);
   auto alpha8 = static_cast<uint8_t>(alpha255);
 
-  if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
-  }
+  if (alpha8 != 0)
+    this->light_.blend_range(0, this->light_.size(), this->target_color_, alpha8);
 
   this->last_transition_progress_ = smoothed_progress;
   this->light_.schedule_show();
@@ -109,5 +175,15 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   return {};
 }
 
+bool AddressableFrontBuffer::allocate(size_t size) {
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  this->data_ = allocator.allocate(size);
+  if (this->data_ == nullptr)
+    return false;
+  memset(this->data_, 0, size);
+  this->size_ = size;
+  return true;
+}
+
 }  // namespace light
 }  // namespace esphome
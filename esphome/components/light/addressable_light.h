@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/color.h"
+#include "esphome/core/helpers.h"
 #include "esp_color_correction.h"
 #include "esp_color_view.h"
 #include "esp_range_view.h"
@@ -10,6 +11,9 @@
 #include "light_state.h"
 #include "transformers.h"
 
+#include <algorithm>
+#include <cstring>
+
 #ifdef USE_POWER_SUPPLY
 #include "esphome/components/power_supply/power_supply.h"
 #endif
@@ -28,6 +32,18 @@ class AddressableLightState : public LightState {
   using LightState::LightState;
 };
 
+/// Layout of an LED buffer that stores all LEDs one after another, with a fixed number of bytes per LED.
+struct ESPPixelSpan {
+  /// The first byte of the first LED, nullptr if the LEDs aren't stored like this.
+  uint8_t *data{nullptr};
+  /// Number of bytes per LED.
+  uint8_t stride{0};
+  /// Number of color channels, 3 for RGB or 4 for RGBW.
+  uint8_t channels{0};
+  /// Offset of each channel within an LED, in the order of Color::raw.
+  uint8_t offsets[4]{};
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -60,6 +76,25 @@ class AddressableLight : public LightOutput, public Component {
       amnt = this->size();
     this->range(amnt, this->size()) = this->range(0, -amnt);
   }
+
+  /** Bulk operations on the LEDs in [from, to), which are indexed like range().
+   *
+   * For drivers that expose their buffer through get_pixel_span_() these work on the raw bytes, without going through
+   * an ESPColorView per LED. The color correction is applied once per call for fill_range(), and for the others
+   * through a lookup table per channel on long strips, as their result for a channel only depends on its old value.
+   */
+  void fill_range(int32_t from, int32_t to, const Color &color);
+  /// Scale the LEDs by \p scale, like `led = led.get() * scale`.
+  void scale_range(int32_t from, int32_t to, uint8_t scale) {
+    this->map_range(from, to, [scale](uint8_t, uint8_t value) { return esp_scale8(value, scale); });
+  }
+  /// Blend \p color into the LEDs, like `led = color * alpha + led.get() * (255 - alpha)`.
+  void blend_range(int32_t from, int32_t to, const Color &color, uint8_t alpha);
+  /// Set \p count LEDs starting at \p from to \p colors.
+  void apply_correction_range(int32_t from, const Color *colors, int32_t count);
+  /// Replace every channel of the LEDs by `fn(channel, value)`, where channel is the index in Color::raw.
+  template<typename F> void map_range(int32_t from, int32_t to, F &&fn);
+
   // Indicates whether an effect that directly updates the output buffer is active to prevent overwriting
   bool is_effect_active() const { return this->effect_active_; }
   void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
@@ -79,12 +114,24 @@ class AddressableLight : public LightOutput, public Component {
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
 #endif
 
+  /// The number of frames per second that were actually sent to the LEDs, measured over the last second or so.
+  float get_fps() const;
+
   void call_setup() override;
 
  protected:
   friend class AddressableLightTransformer;
-
+  friend class ESPRangeView;
+
+  /// Count a frame for get_fps().
+  void count_frame_();
+  /** Called by drivers for every frame that is sent to the LEDs.
+   *
+   * Besides counting the frame, this requests the power supply while any LED is on and releases it once all are
+   * off. A driver that doesn't call it ignores the light's power_supply option.
+   */
   void mark_shown_() {
+    this->count_frame_();
 #ifdef USE_POWER_SUPPLY
     for (const auto &c : *this) {
       if (c.get_red_raw() > 0 || c.get_green_raw() > 0 || c.get_blue_raw() > 0 || c.get_white_raw() > 0) {
@@ -96,6 +143,10 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// The layout of the LED buffer, for drivers that keep all LEDs in one buffer with a fixed stride.
+  virtual ESPPixelSpan get_pixel_span_() const { return {}; }
+  /// Lookup table of 256 bytes for each of the 4 channels for map_range(), allocated on first use on a long strip.
+  uint8_t *get_range_lut_();
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
@@ -103,6 +154,78 @@ class AddressableLight : public LightOutput, public Component {
   power_supply::PowerSupplyRequester power_;
 #endif
   LightState *state_parent_{nullptr};
+  float fps_{0.0f};
+  uint32_t fps_start_{0};
+  uint16_t fps_frames_{0};
+  std::unique_ptr<uint8_t[]> range_lut_;
+};
+
+template<typename F> void AddressableLight::map_range(int32_t from, int32_t to, F &&fn) {
+  from = interpret_index(from, this->size());
+  to = std::min(interpret_index(to, this->size()), this->size());
+  const ESPPixelSpan span = this->get_pixel_span_();
+  if (span.data == nullptr) {
+    for (int32_t i = from; i < to; i++) {
+      ESPColorView view = this->get_view_internal(i);
+      Color color = view.get();
+      for (uint8_t ch = 0; ch < 4; ch++)
+        color.raw[ch] = fn(ch, color.raw[ch]);
+      view.set(color);
+    }
+    return;
+  }
+
+  // Once there are more LEDs than possible values, it's cheaper to map every value of a channel once
+  const ESPColorCorrection &correction = this->correction_;
+  uint8_t *lut = to - from > 256 ? this->get_range_lut_() : nullptr;
+  uint8_t *const end = span.data + to * span.stride;
+  if (lut != nullptr) {
+    for (uint8_t ch = 0; ch < span.channels; ch++) {
+      for (uint16_t value = 0; value < 256; value++) {
+        uint8_t mapped = fn(ch, correction.color_uncorrect_channel(ch, value));
+        lut[ch * 256 + value] = correction.color_correct_channel(ch, mapped);
+      }
+    }
+    for (uint8_t *led = span.data + from * span.stride; led < end; led += span.stride) {
+      for (uint8_t ch = 0; ch < span.channels; ch++) {
+        uint8_t &value = led[span.offsets[ch]];
+        value = lut[ch * 256 + value];
+      }
+    }
+    return;
+  }
+  for (uint8_t *led = span.data + from * span.stride; led < end; led += span.stride) {
+    for (uint8_t ch = 0; ch < span.channels; ch++) {
+      uint8_t &value = led[span.offsets[ch]];
+      value = correction.color_correct_channel(ch, fn(ch, correction.color_uncorrect_channel(ch, value)));
+    }
+  }
+}
+
+/** Second LED buffer for drivers that send frames in the background, e.g. with DMA or RMT.
+ *
+ * The driver's own buffer stays the back buffer: effects and transitions keep rendering into it, and read the last
+ * frame back from it. Once the previous frame has been sent, present() copies the finished frame into the front
+ * buffer and the transmission is started from there. Copying, rather than swapping the buffers, keeps the back buffer
+ * up to date, at the cost of a copy of a few bytes per LED.
+ */
+class AddressableFrontBuffer {
+ public:
+  /// Allocate the buffer for frames of \p size bytes, returns false if that failed.
+  bool allocate(size_t size);
+  bool is_allocated() const { return this->data_ != nullptr; }
+
+  /// Copy the frame in \p back into the front buffer and return the front buffer, to send it from there.
+  const uint8_t *present(const uint8_t *back) {
+    memcpy(this->data_, back, this->size_);
+    return this->data_;
+  }
+  const uint8_t *data() const { return this->data_; }
+  size_t size() const { return this->size_; }
+
+ protected:
+  uint8_t *data_{nullptr};
+  size_t size_{0};
 };
 
 class AddressableLightTransformer : public LightTransitionTransformer {
@@ -1,6 +1,8 @@
 #include "esp_range_view.h"
 #include "addressable_light.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -17,11 +19,7 @@ ESPColorView ESPRangeView::operator[](int32_t index) const {
 ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
-void ESPRangeView::set(const Color &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
-  }
-}
+void ESPRangeView::set(const Color &color) { this->parent_->fill_range(this->begin_, this->end_, color); }
 
 void ESPRangeView::set_red(uint8_t red) {
   for (auto c : *this)
@@ -45,20 +43,27 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  // Same as Color::gradient() to white for every channel
+  const float amnt_f = float(amnt) / 255.0f;
+  this->parent_->map_range(this->begin_, this->end_, [amnt_f](uint8_t, uint8_t value) -> uint8_t {
+    return amnt_f * (255 - value) + value;
+  });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  const float amnt_f = float(amnt) / 255.0f;
+  this->parent_->map_range(this->begin_, this->end_, [amnt_f](uint8_t, uint8_t value) -> uint8_t {
+    return amnt_f * (0 - value) + value;
+  });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->parent_->map_range(this->begin_, this->end_, [delta](uint8_t, uint8_t value) -> uint8_t {
+    return value + delta > 255 ? 255 : value + delta;
+  });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->parent_->map_range(this->begin_, this->end_, [delta](uint8_t, uint8_t value) -> uint8_t {
+    return value < delta ? 0 : value - delta;
+  });
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
@@ -75,6 +80,13 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  // Within one buffer the raw bytes can be moved as they are, they have the same color correction
+  const ESPPixelSpan span = this->parent_->get_pixel_span_();
+  if (span.data != nullptr) {
+    memmove(span.data + this->begin_ * span.stride, span.data + rhs.begin_ * span.stride, this->size() * span.stride);
+    return *this;
+  }
+
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
@@ -143,7 +143,7 @@ class Lock : public EntityBase {
    *
    * @param callback The void(bool) callback.
    */
-  void add_on_state_callback(std::function<void()> &&callback);
+  void add_on_state_callback(Callback<void()> &&callback);
 
  protected:
   friend LockCall;
@@ -166,19 +166,46 @@ def validate_local_no_higher_than_global(value):
     return value
 
 
+# Every message first reserves room for the longest one, so a smaller buffer drops
+# messages as soon as a few tasks log at the same time
+ASYNC_BUFFER_MESSAGES = 4
+
+
+def validate_async_buffer_size(value):
+    if CONF_ASYNC_BUFFER_SIZE not in value:
+        return value
+    min_size = ASYNC_BUFFER_MESSAGES * value[CONF_TX_BUFFER_SIZE]
+    if value[CONF_ASYNC_BUFFER_SIZE] < min_size:
+        raise cv.Invalid(
+            f"Must be at least {ASYNC_BUFFER_MESSAGES} times {CONF_TX_BUFFER_SIZE} "
+            f"({min_size} bytes)",
+            path=[CONF_ASYNC_BUFFER_SIZE],
+        )
+    return value
+
+
 Logger = logger_ns.class_("Logger", cg.Component)
+LoggerSetLevelAction = logger_ns.class_("LoggerSetLevelAction", automation.Action)
 LoggerMessageTrigger = logger_ns.class_(
     "LoggerMessageTrigger",
     automation.Trigger.template(cg.int_, cg.const_char_ptr, cg.const_char_ptr),
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_ASYNC_BUFFER_SIZE = "async_buffer_size"
+CONF_HARDWARE_UART_LEVEL = "hardware_uart_level"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Logger),
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
             cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+            # Needs atomics, which are only available on all ESP32 variants
+            cv.Optional(CONF_ASYNC_BUFFER_SIZE): cv.All(
+                cv.only_on_esp32,
+                cv.validate_bytes,
+                cv.int_range(min=256, max=32768),
+            ),
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
             cv.SplitDefault(
                 CONF_HARDWARE_UART,
@@ -205,6 +232,8 @@ CONFIG_SCHEMA = cv.All(
                 uart_selection,
             ),
             cv.Optional(CONF_LEVEL, default="DEBUG"): is_log_level,
+            # Less verbose output on the UART, so messages only API clients subscribed to aren't formatted for it
+            cv.Optional(CONF_HARDWARE_UART_LEVEL): is_log_level,
             cv.Optional(CONF_LOGS, default={}): cv.Schema(
                 {
                     cv.string: is_log_level,
@@ -222,6 +251,7 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
+    validate_async_buffer_size,
 )
 
 
@@ -235,6 +265,11 @@ async def to_code(config):
                 HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]]
             )
         )
+    if CONF_HARDWARE_UART_LEVEL in config:
+        cg.add(log.set_uart_level(LOG_LEVELS[config[CONF_HARDWARE_UART_LEVEL]]))
+    if CONF_ASYNC_BUFFER_SIZE in config:
+        cg.add_define("USE_LOGGER_ASYNC")
+        cg.add(log.set_async_buffer_size(config[CONF_ASYNC_BUFFER_SIZE]))
     cg.add(log.pre_setup())
 
     for tag, level in config[CONF_LOGS].items():
@@ -368,3 +403,30 @@ async def logger_log_action_to_code(config, action_id, template_arg, args):
 
     lambda_ = await cg.process_lambda(Lambda(text), args, return_type=cg.void)
     return cg.new_Pvariable(action_id, template_arg, lambda_)
+
+
+@automation.register_action(
+    "logger.set_level",
+    LoggerSetLevelAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(Logger),
+            cv.Required(CONF_LEVEL): cv.templatable(is_log_level),
+            cv.Optional(CONF_TAG): cv.templatable(cv.string),
+        },
+        key=CONF_LEVEL,
+    ),
+)
+async def logger_set_level_to_code(config, action_id, template_arg, args):
+    parent = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, parent)
+    level = config[CONF_LEVEL]
+    if cg.is_template(level):
+        template_ = await cg.templatable(level, args, cg.int_)
+        cg.add(var.set_level(template_))
+    else:
+        cg.add(var.set_level(LOG_LEVELS[level]))
+    if CONF_TAG in config:
+        template_ = await cg.templatable(config[CONF_TAG], args, cg.std_string)
+        cg.add(var.set_tag(template_))
+    return var
@@ -0,0 +1,89 @@
+#include "async_log_buffer.h"
+
+#ifdef USE_LOGGER_ASYNC
+
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+AsyncLogBuffer::AsyncLogBuffer(size_t size) {
+  this->size_ = ALIGNMENT;
+  while (this->size_ < size)
+    this->size_ <<= 1;
+  // Zero-initialized, so every header starts out as WRITING
+  this->data_ = std::unique_ptr<uint8_t[]>(new uint8_t[this->size_]());  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+char *AsyncLogBuffer::reserve(uint8_t level, const char *tag, size_t len) {
+  const size_t entry_size = entry_size_(len);
+  if (entry_size > this->size_ || entry_size > UINT16_MAX)
+    return nullptr;
+
+  uint32_t pos = this->write_pos_.load(std::memory_order_relaxed);
+  uint32_t skip;
+  do {
+    uint32_t tail = this->size_ - (pos & (this->size_ - 1));
+    skip = entry_size <= tail ? 0 : tail;
+    uint32_t used = pos - this->read_pos_.load(std::memory_order_acquire);
+    if (used + skip + entry_size > this->size_)
+      return nullptr;
+  } while (!this->write_pos_.compare_exchange_weak(pos, pos + skip + entry_size, std::memory_order_relaxed));
+
+  if (skip != 0) {
+    Message *padding = this->at_(pos);
+    padding->size = skip;
+    __atomic_store_n(&padding->state, SKIP, __ATOMIC_RELEASE);
+    pos += skip;
+  }
+  Message *msg = this->at_(pos);
+  msg->size = entry_size;
+  msg->level = level;
+  msg->tag = tag;
+  return reinterpret_cast<char *>(msg + 1);
+}
+
+void AsyncLogBuffer::commit(char *text, size_t len) {
+  Message *msg = reinterpret_cast<Message *>(text) - 1;
+  const size_t entry_size = entry_size_(len);
+  if (entry_size < msg->size) {
+    // Less than a buffer size can be reserved past the start of this message, so if the write position is where
+    // this message ends in the buffer, nothing was reserved after it. The room given back was never written to, so it
+    // is still zeroed.
+    const uint32_t end = reinterpret_cast<uint8_t *>(msg) - this->data_.get() + msg->size;
+    uint32_t pos = this->write_pos_.load(std::memory_order_relaxed);
+    if (((pos - end) & (this->size_ - 1)) == 0 &&
+        this->write_pos_.compare_exchange_strong(pos, pos - (msg->size - entry_size), std::memory_order_relaxed))
+      msg->size = entry_size;
+  }
+  __atomic_store_n(&msg->state, READY, __ATOMIC_RELEASE);
+}
+
+const AsyncLogBuffer::Message *AsyncLogBuffer::front() {
+  while (true) {
+    uint32_t pos = this->read_pos_.load(std::memory_order_relaxed);
+    if (pos == this->write_pos_.load(std::memory_order_acquire))
+      return nullptr;
+    Message *msg = this->at_(pos);
+    uint8_t state = __atomic_load_n(&msg->state, __ATOMIC_ACQUIRE);
+    if (state == READY)
+      return msg;
+    if (state == WRITING)
+      return nullptr;
+    this->pop();
+  }
+}
+
+void AsyncLogBuffer::pop() {
+  uint32_t pos = this->read_pos_.load(std::memory_order_relaxed);
+  Message *msg = this->at_(pos);
+  uint16_t size = msg->size;
+  // Headers of later messages can end up anywhere in this space, they have to read as WRITING until written
+  memset(msg, 0, size);
+  this->read_pos_.store(pos + size, std::memory_order_release);
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_ASYNC
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_ASYNC
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** Multi-producer, single-consumer ring buffer of formatted log messages.
+ *
+ * Any task can add messages without taking a lock: room is reserved with a compare-and-swap of the write position,
+ * the message is written into it and then marked as ready. The logger takes the messages out in order from its
+ * loop(), so that the UART and the log callbacks no longer run on the stack of whoever logged.
+ *
+ * Messages are never split. If one does not fit at the end of the buffer, the rest of the buffer is skipped and the
+ * message is stored at the start of it.
+ *
+ * Only tasks may add messages, not interrupt handlers: the logger formats the text with vsnprintf() into the reserved
+ * room, which is not ISR-safe.
+ */
+class AsyncLogBuffer {
+ public:
+  struct Message {
+    /// Size of the message in the buffer, including this header and any padding.
+    uint16_t size;
+    uint8_t level;
+    /// One of the State values, only accessed atomically.
+    uint8_t state;
+    const char *tag;
+
+    /// The null-terminated text, stored right after the header.
+    const char *text() const { return reinterpret_cast<const char *>(this + 1); }
+  };
+
+  /// \p size is rounded up to a power of two.
+  explicit AsyncLogBuffer(size_t size);
+
+  /** Reserve room for a message with a text of \p len characters, not counting the null terminator.
+   *
+   * Returns where to write the text, or nullptr if it does not fit. The message is only passed on once commit()
+   * was called with the returned pointer.
+   */
+  char *reserve(uint8_t level, const char *tag, size_t len);
+  /** Pass on the message with the text at \p text, which is \p len characters long.
+   *
+   * \p len may be shorter than what was reserved. The room that is left over is given back, unless another message
+   * was reserved after this one in the meantime.
+   */
+  void commit(char *text, size_t len);
+
+  /// The oldest message, or nullptr if there is none or it is still being written. Only for the consumer.
+  const Message *front();
+  /// Remove the message returned by front().
+  void pop();
+
+  size_t get_size() const { return this->size_; }
+
+ protected:
+  enum State : uint8_t {
+    /// Reserved, but not yet committed. Free space is kept zeroed, so this is what an unwritten header reads as.
+    WRITING = 0,
+    READY = 1,
+    /// Padding at the end of the buffer that was skipped because a message did not fit there.
+    SKIP = 2,
+  };
+  /// Messages are aligned to this, which is at least the size of the header, so the end of the buffer can always
+  /// hold a SKIP header.
+  static const size_t ALIGNMENT = sizeof(Message) <= 8 ? 8 : (sizeof(Message) <= 16 ? 16 : 32);
+
+  static size_t entry_size_(size_t len) { return (sizeof(Message) + len + 1 + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+  Message *at_(uint32_t pos) { return reinterpret_cast<Message *>(&this->data_[pos & (this->size_ - 1)]); }
+
+  std::unique_ptr<uint8_t[]> data_;
+  size_t size_;
+  /// Positions only ever increase and wrap around at 2^32, which is a multiple of the power-of-two size.
+  std::atomic<uint32_t> write_pos_{0};
+  std::atomic<uint32_t> read_pos_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_ASYNC
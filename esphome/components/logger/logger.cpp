@@ -1,5 +1,7 @@
 #include "logger.h"
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -10,6 +12,10 @@ namespace logger {
 
 static const char *const TAG = "logger";
 
+#ifdef USE_LOGGER_ASYNC
+static const size_t MAX_ASYNC_MESSAGES_PER_LOOP = 16;
+#endif
+
 static const char *const LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
     ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED),       // ERROR
@@ -31,7 +37,15 @@ static const char *const LOG_LEVEL_LETTERS[] = {
     "VV",  // VERY_VERBOSE
 };
 
-void Logger::write_header_(int level, const char *tag, int line) {
+bool Logger::is_main_task_() const {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  return xTaskGetCurrentTaskHandle() == this->main_task_;
+#else
+  return true;
+#endif
+}
+
+int Logger::format_header_(char *buffer, size_t size, int level, const char *tag, int line) const {
   if (level < 0)
     level = 0;
   if (level > 7)
@@ -39,27 +53,43 @@ void Logger::write_header_(int level, const char *tag, int line) {
 
   const char *color = LOG_LEVEL_COLORS[level];
   const char *letter = LOG_LEVEL_LETTERS[level];
-#if defined(USE_ESP32) || defined(USE_LIBRETINY)
-  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
-#else
-  void *current_task = nullptr;
-#endif
-  if (current_task == main_task_) {
-    this->printf_to_buffer_("%s[%s][%s:%03u]: ", color, letter, tag, line);
-  } else {
-    const char *thread_name = "";
+  if (this->is_main_task_())
+    return snprintf(buffer, size, "%s[%s][%s:%03u]: ", color, letter, tag, line);
+
+  const char *thread_name = "";
 #if defined(USE_ESP32)
-    thread_name = pcTaskGetName(current_task);
+  thread_name = pcTaskGetName(xTaskGetCurrentTaskHandle());
 #elif defined(USE_LIBRETINY)
-    thread_name = pcTaskGetTaskName(current_task);
+  thread_name = pcTaskGetTaskName(xTaskGetCurrentTaskHandle());
 #endif
-    this->printf_to_buffer_("%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
-                            ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
-  }
+  return snprintf(buffer, size, "%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
+                  ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
+}
+
+void Logger::write_header_(int level, const char *tag, int line) {
+  if (this->is_buffer_full_())
+    return;
+  int remaining = this->buffer_remaining_capacity_();
+  int ret = this->format_header_(this->tx_buffer_ + this->tx_buffer_at_, remaining, level, tag, line);
+  if (ret < 0)
+    return;
+  if (ret >= remaining)
+    ret = remaining;
+  this->tx_buffer_at_ += ret;
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag) || !this->is_level_consumed_(level))
+    return;
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_buffer_ != nullptr) {
+    // Messages logged by the log callbacks while the buffer is written out are dropped, like in synchronous mode
+    if (!this->is_main_task_() || !this->recursion_guard_)
+      this->log_async_(level, tag, line, format, args);
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
@@ -73,7 +103,7 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag) || recursion_guard_ || !this->is_level_consumed_(level))
     return;
 
   recursion_guard_ = true;
@@ -110,7 +140,17 @@ int HOT Logger::level_for(const char *tag) {
       return it.level;
     }
   }
-  return ESPHOME_LOG_LEVEL;
+  return this->current_level_;
+}
+
+bool HOT Logger::is_level_consumed_(int level) const {
+  if ((this->baud_rate_ > 0 && level <= this->uart_level_) || this->callback_all_levels_)
+    return true;
+  for (const int *max_level : this->callback_levels_) {
+    if (level <= *max_level)
+      return true;
+  }
+  return false;
 }
 
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
@@ -121,9 +161,11 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // make sure null terminator is present
   this->set_null_terminator_();
 
-  const char *msg = this->tx_buffer_ + offset;
+  this->output_message_(level, tag, this->tx_buffer_ + offset);
+}
 
-  if (this->baud_rate_ > 0) {
+void HOT Logger::output_message_(int level, const char *tag, const char *msg) {
+  if (this->baud_rate_ > 0 && level <= this->uart_level_) {
     this->write_msg_(msg);
   }
 
@@ -148,9 +190,90 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#ifdef USE_LOGGER_ASYNC
+void Logger::set_async_buffer_size(size_t size) { this->async_buffer_ = make_unique<AsyncLogBuffer>(size); }
+
+void Logger::log_async_(int level, const char *tag, int line, const char *format, va_list args) {
+  char header[128];
+  int header_len = this->format_header_(header, sizeof(header), level, tag, line);
+  if (header_len < 0)
+    return;
+  header_len = std::min<int>(header_len, sizeof(header) - 1);
+  const size_t footer_len = strlen(ESPHOME_LOG_RESET_COLOR);
+  // Truncate to the same length as synchronous messages. Reserve that much, so the message is only formatted once,
+  // commit() gives back what is left over.
+  size_t len = this->tx_buffer_size_;
+  char *text = this->async_buffer_->reserve(level, tag, len);
+  if (text == nullptr) {
+    // No room for the longest message, find out how much this one needs
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int msg_len = vsnprintf(nullptr, 0, format, args_copy);
+    va_end(args_copy);
+    if (msg_len < 0)
+      return;
+    len = std::min<size_t>(header_len + msg_len + footer_len, this->tx_buffer_size_);
+    text = this->async_buffer_->reserve(level, tag, len);
+    if (text == nullptr && this->is_main_task_() && !this->recursion_guard_) {
+      // Don't drop messages of the main task, make room by writing out the buffered messages instead
+      this->process_async_buffer_(SIZE_MAX);
+      text = this->async_buffer_->reserve(level, tag, len);
+    }
+  }
+  if (text == nullptr) {
+    this->async_dropped_.fetch_add(1, std::memory_order_relaxed);
+    this->enable_loop_soon_any_context();
+    return;
+  }
+
+  size_t pos = std::min<size_t>(header_len, len);
+  memcpy(text, header, pos);
+  if (pos < len) {
+    int msg_len = vsnprintf(text + pos, len - pos + 1, format, args);
+    if (msg_len > 0)
+      pos += std::min<size_t>(msg_len, len - pos);
+  }
+  size_t footer = std::min(footer_len, len - pos);
+  memcpy(text + pos, ESPHOME_LOG_RESET_COLOR, footer);
+  text[pos + footer] = '\0';
+  this->async_buffer_->commit(text, pos + footer);
+  this->enable_loop_soon_any_context();
+}
+
+void Logger::process_async_buffer_(size_t max_messages) {
+  this->recursion_guard_ = true;
+  const AsyncLogBuffer::Message *msg;
+  for (size_t i = 0; i < max_messages && (msg = this->async_buffer_->front()) != nullptr; i++) {
+    this->output_message_(msg->level, msg->tag, msg->text());
+    this->async_buffer_->pop();
+  }
+  this->recursion_guard_ = false;
+}
+#endif
+
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_ASYNC)
 void Logger::loop() {
-#ifdef USE_ARDUINO
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_buffer_ != nullptr) {
+    // Bounded, so tasks that log continuously can't keep the main loop here
+    this->process_async_buffer_(MAX_ASYNC_MESSAGES_PER_LOOP);
+    uint32_t dropped = this->async_dropped_.exchange(0, std::memory_order_relaxed);
+    if (dropped != 0)
+      ESP_LOGW(TAG, "%" PRIu32 " log messages were dropped, the async log buffer was full", dropped);
+
+    bool poll_usb_cdc = false;
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
+    poll_usb_cdc = this->uart_ == UART_SELECTION_USB_CDC;
+#endif
+    if (!poll_usb_cdc) {
+      // Wait for log_async_() to queue the next message. Disable first, so one queued from now on enables it again.
+      this->disable_loop();
+      if (this->async_buffer_->front() != nullptr || this->async_dropped_.load(std::memory_order_relaxed) != 0)
+        this->enable_loop();
+    }
+  }
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
   if (this->uart_ != UART_SELECTION_USB_CDC) {
     return;
   }
@@ -167,15 +290,40 @@ void Logger::loop() {
 #endif
 
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
+void Logger::set_log_level(int log_level) {
+  this->current_level_ = clamp(log_level, ESPHOME_LOG_LEVEL_NONE, ESPHOME_LOG_LEVEL);
+  this->update_global_log_level_();
+}
 void Logger::set_log_level(const std::string &tag, int log_level) {
+  log_level = clamp(log_level, ESPHOME_LOG_LEVEL_NONE, ESPHOME_LOG_LEVEL);
+  for (auto &it : this->log_levels_) {
+    if (it.tag == tag) {
+      it.level = log_level;
+      this->update_global_log_level_();
+      return;
+    }
+  }
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  this->update_global_log_level_();
+}
+void Logger::update_global_log_level_() {
+  int level = this->current_level_;
+  for (auto &it : this->log_levels_)
+    level = std::max(level, it.level);
+  global_log_level = level;
 }
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY)
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
-void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+void Logger::add_on_log_callback(Callback<void(int, const char *, const char *)> &&callback) {
+  this->callback_all_levels_ = true;
+  this->log_callback_.add(std::move(callback));
+}
+void Logger::add_on_log_callback(Callback<void(int, const char *, const char *)> &&callback,
+                                 const int *max_level) {
+  this->callback_levels_.push_back(max_level);
   this->log_callback_.add(std::move(callback));
 }
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
@@ -183,11 +331,17 @@ const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DE
 
 void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "Logger:");
-  ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
+  ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[this->current_level_]);
 #ifndef USE_HOST
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %" PRIu32, this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", get_uart_selection_());
 #endif
+  if (this->uart_level_ < ESPHOME_LOG_LEVEL)
+    ESP_LOGCONFIG(TAG, "  Hardware UART Level: %s", LOG_LEVELS[this->uart_level_]);
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_buffer_ != nullptr)
+    ESP_LOGCONFIG(TAG, "  Async Buffer Size: %zu", this->async_buffer_->get_size());
+#endif
 
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
@@ -6,6 +6,13 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_LOGGER_ASYNC
+#include <atomic>
+#include <memory>
+#include "async_log_buffer.h"
+#endif
 
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
@@ -56,12 +63,26 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_ASYNC)
   void loop() override;
+#endif
+#ifdef USE_LOGGER_ASYNC
+  /** Only format messages when they are logged, and write them out and pass them to the log callbacks from loop().
+   *
+   * Messages are kept in a buffer of \p size bytes in between. When it is full, messages of other tasks are dropped
+   * while the main task writes out the buffered messages first. Each message reserves tx_buffer_size bytes until it
+   * is formatted, so the config requires at least four times that.
+   *
+   * Like synchronous logging this is not ISR-safe: messages are formatted with vsnprintf() by the caller, so nothing
+   * may be logged from an interrupt handler in this mode either.
+   */
+  void set_async_buffer_size(size_t size);
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
   uint32_t get_baud_rate() const { return baud_rate_; }
+  /// Only write messages up to \p level to the UART, more verbose ones are only passed to the log callbacks.
+  void set_uart_level(int level) { this->uart_level_ = level; }
 #ifdef USE_ARDUINO
   Stream *get_hw_serial() const { return hw_serial_; }
 #endif
@@ -74,7 +95,13 @@ class Logger : public Component {
   UARTSelection get_uart() const;
 #endif
 
-  /// Set the log level of the specified tag.
+  /** Set the log level of all tags without a level of their own.
+   *
+   * Can be changed at runtime, but not above the level the firmware was compiled with.
+   */
+  void set_log_level(int log_level);
+  int get_log_level() const { return this->current_level_; }
+  /// Set the log level of the specified tag, replacing any level it had before.
   void set_log_level(const std::string &tag, int log_level);
 
   // ========== INTERNAL METHODS ==========
@@ -86,7 +113,12 @@ class Logger : public Component {
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  void add_on_log_callback(Callback<void(int, const char *, const char *)> &&callback);
+  /** Register a callback that only needs messages up to the level \p max_level points to.
+   *
+   * The level can change at runtime. Messages that no callback and no UART needs are not formatted at all.
+   */
+  void add_on_log_callback(Callback<void(int, const char *, const char *)> &&callback, const int *max_level);
 
   float get_setup_priority() const override;
 
@@ -96,10 +128,24 @@ class Logger : public Component {
 #endif
 
  protected:
+  bool is_main_task_() const;
+  /// Whether the UART or any of the log callbacks would receive a message of \p level.
+  bool is_level_consumed_(int level) const;
+  /// Update global_log_level after a level changed.
+  void update_global_log_level_();
+  /// Format the message header into \p buffer, with snprintf() semantics.
+  int format_header_(char *buffer, size_t size, int level, const char *tag, int line) const;
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  /// Write a formatted message to the UART and pass it to the log callbacks.
+  void output_message_(int level, const char *tag, const char *msg);
   void write_msg_(const char *msg);
+#ifdef USE_LOGGER_ASYNC
+  void log_async_(int level, const char *tag, int line, const char *format, va_list args);
+  /// Write out the buffered messages, at most \p max_messages of them.
+  void process_async_buffer_(size_t max_messages);
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -164,9 +210,19 @@ class Logger : public Component {
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
+  int current_level_{ESPHOME_LOG_LEVEL};
+  int uart_level_{ESPHOME_LOG_LEVEL};
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+  /// Whether a callback without a maximum level was registered.
+  bool callback_all_levels_{false};
+  std::vector<const int *> callback_levels_;
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
+#ifdef USE_LOGGER_ASYNC
+  std::unique_ptr<AsyncLogBuffer> async_buffer_;
+  /// Messages dropped because the async buffer was full, reported from loop().
+  std::atomic<uint32_t> async_dropped_{0};
+#endif
   void *main_task_ = nullptr;
 };
 
@@ -176,17 +232,37 @@ class LoggerMessageTrigger : public Trigger<int, const char *, const char *> {
  public:
   explicit LoggerMessageTrigger(Logger *parent, int level) {
     this->level_ = level;
-    parent->add_on_log_callback([this](int level, const char *tag, const char *message) {
-      if (level <= this->level_) {
-        this->trigger(level, tag, message);
-      }
-    });
+    parent->add_on_log_callback(
+        [this](int level, const char *tag, const char *message) {
+          if (level <= this->level_) {
+            this->trigger(level, tag, message);
+          }
+        },
+        &this->level_);
   }
 
  protected:
   int level_;
 };
 
+template<typename... Ts> class LoggerSetLevelAction : public Action<Ts...> {
+ public:
+  explicit LoggerSetLevelAction(Logger *parent) : parent_(parent) {}
+  TEMPLATABLE_VALUE(int, level)
+  TEMPLATABLE_VALUE(std::string, tag)
+
+  void play(Ts... x) override {
+    if (this->tag_.has_value()) {
+      this->parent_->set_log_level(this->tag_.value(x...), this->level_.value(x...));
+    } else {
+      this->parent_->set_log_level(this->level_.value(x...));
+    }
+  }
+
+ protected:
+  Logger *parent_;
+};
+
 }  // namespace logger
 
 }  // namespace esphome
@@ -158,11 +158,11 @@ class LTRAlsPsComponent : public PollingComponent, public i2c::I2CDevice {
   CallbackManager<void()> on_ps_high_trigger_callback_;
   CallbackManager<void()> on_ps_low_trigger_callback_;
 
-  void add_on_ps_high_trigger_callback_(std::function<void()> callback) {
+  void add_on_ps_high_trigger_callback_(Callback<void()> &&callback) {
     this->on_ps_high_trigger_callback_.add(std::move(callback));
   }
 
-  void add_on_ps_low_trigger_callback_(std::function<void()> callback) {
+  void add_on_ps_low_trigger_callback_(Callback<void()> &&callback) {
     this->on_ps_low_trigger_callback_.add(std::move(callback));
   }
 };
@@ -118,7 +118,7 @@ MediaPlayerCall &MediaPlayerCall::set_announcement(bool announce) {
   return *this;
 }
 
-void MediaPlayer::add_on_state_callback(std::function<void()> &&callback) {
+void MediaPlayer::add_on_state_callback(Callback<void()> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
@@ -79,7 +79,7 @@ class MediaPlayer : public EntityBase {
 
   void publish_state();
 
-  void add_on_state_callback(std::function<void()> &&callback);
+  void add_on_state_callback(Callback<void()> &&callback);
 
   virtual bool is_muted() const { return false; }
 
@@ -82,6 +82,12 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
   void write_state(light::LightState *state) override {
+    // Methods that send in the background (RMT, I2S, DMA) keep their own copy of the frame, don't block waiting for
+    // the previous frame, but try again next loop iteration
+    if (!this->controller_->CanShow()) {
+      this->schedule_show();
+      return;
+    }
     this->mark_shown_();
     this->controller_->Dirty();
 
@@ -121,6 +127,15 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  light::ESPPixelSpan get_pixel_span_() const override {  // NOLINT
+    light::ESPPixelSpan span;
+    span.data = this->controller_->Pixels();
+    span.stride = 3;
+    span.channels = 3;
+    for (uint8_t ch = 0; ch < 3; ch++)
+      span.offsets[ch] = this->rgb_offsets_[ch];
+    return span;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -138,6 +153,15 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  light::ESPPixelSpan get_pixel_span_() const override {  // NOLINT
+    light::ESPPixelSpan span;
+    span.data = this->controller_->Pixels();
+    span.stride = 4;
+    span.channels = 4;
+    for (uint8_t ch = 0; ch < 4; ch++)
+      span.offsets[ch] = this->rgb_offsets_[ch];
+    return span;
+  }
 };
 
 }  // namespace neopixelbus
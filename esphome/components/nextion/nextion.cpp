@@ -156,23 +156,23 @@ void Nextion::update() {
   }
 }
 
-void Nextion::add_sleep_state_callback(std::function<void()> &&callback) {
+void Nextion::add_sleep_state_callback(Callback<void()> &&callback) {
   this->sleep_callback_.add(std::move(callback));
 }
 
-void Nextion::add_wake_state_callback(std::function<void()> &&callback) {
+void Nextion::add_wake_state_callback(Callback<void()> &&callback) {
   this->wake_callback_.add(std::move(callback));
 }
 
-void Nextion::add_setup_state_callback(std::function<void()> &&callback) {
+void Nextion::add_setup_state_callback(Callback<void()> &&callback) {
   this->setup_callback_.add(std::move(callback));
 }
 
-void Nextion::add_new_page_callback(std::function<void(uint8_t)> &&callback) {
+void Nextion::add_new_page_callback(Callback<void(uint8_t)> &&callback) {
   this->page_callback_.add(std::move(callback));
 }
 
-void Nextion::add_touch_event_callback(std::function<void(uint8_t, uint8_t, bool)> &&callback) {
+void Nextion::add_touch_event_callback(Callback<void(uint8_t, uint8_t, bool)> &&callback) {
   this->touch_callback_.add(std::move(callback));
 }
 
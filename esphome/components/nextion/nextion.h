@@ -1093,31 +1093,31 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    *
    * @param callback The void() callback.
    */
-  void add_sleep_state_callback(std::function<void()> &&callback);
+  void add_sleep_state_callback(Callback<void()> &&callback);
 
   /** Add a callback to be notified of wake state changes.
    *
    * @param callback The void() callback.
    */
-  void add_wake_state_callback(std::function<void()> &&callback);
+  void add_wake_state_callback(Callback<void()> &&callback);
 
   /** Add a callback to be notified when the nextion completes its initialize setup.
    *
    * @param callback The void() callback.
    */
-  void add_setup_state_callback(std::function<void()> &&callback);
+  void add_setup_state_callback(Callback<void()> &&callback);
 
   /** Add a callback to be notified when the nextion changes pages.
    *
    * @param callback The void(std::string) callback.
    */
-  void add_new_page_callback(std::function<void(uint8_t)> &&callback);
+  void add_new_page_callback(Callback<void(uint8_t)> &&callback);
 
   /** Add a callback to be notified when Nextion has a touch event.
    *
    * @param callback The void() callback.
    */
-  void add_touch_event_callback(std::function<void(uint8_t, uint8_t, bool)> &&callback);
+  void add_touch_event_callback(Callback<void(uint8_t, uint8_t, bool)> &&callback);
 
   void update_all_components();
 
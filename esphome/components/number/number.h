@@ -44,7 +44,7 @@ class Number : public EntityBase {
 
   NumberCall make_call() { return NumberCall(this); }
 
-  void add_on_state_callback(std::function<void(float)> &&callback);
+  void add_on_state_callback(Callback<void(float)> &&callback);
 
   NumberTraits traits;
 
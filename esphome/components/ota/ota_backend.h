@@ -62,7 +62,7 @@ class OTABackend {
 class OTAComponent : public Component {
 #ifdef USE_OTA_STATE_CALLBACK
  public:
-  void add_on_state_callback(std::function<void(ota::OTAState, float, uint8_t)> &&callback) {
+  void add_on_state_callback(Callback<void(ota::OTAState, float, uint8_t)> &&callback) {
     this->state_callback_.add(std::move(callback));
   }
 
@@ -79,7 +79,7 @@ class OTAGlobalCallback {
       this->state_callback_.call(state, progress, error, ota_caller);
     });
   }
-  void add_on_state_callback(std::function<void(OTAState, float, uint8_t, OTAComponent *)> &&callback) {
+  void add_on_state_callback(Callback<void(OTAState, float, uint8_t, OTAComponent *)> &&callback) {
     this->state_callback_.add(std::move(callback));
   }
 
@@ -62,7 +62,7 @@ class PIDClimate : public climate::Climate, public Component {
   // float get_deadband() const { return controller_.deadband; }
   // float get_proportional_deadband_multiplier() const { return controller_.proportional_deadband_multiplier; }
 
-  void add_on_pid_computed_callback(std::function<void()> &&callback) {
+  void add_on_pid_computed_callback(Callback<void()> &&callback) {
     pid_computed_callback_.add(std::move(callback));
   }
   void set_default_target_temperature(float default_target_temperature) {
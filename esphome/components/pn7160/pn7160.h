@@ -184,11 +184,11 @@ class PN7160 : public nfc::Nfcc, public Component {
   void register_ontag_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontag_.push_back(trig); }
   void register_ontagremoved_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontagremoved_.push_back(trig); }
 
-  void add_on_emulated_tag_scan_callback(std::function<void()> callback) {
+  void add_on_emulated_tag_scan_callback(Callback<void()> &&callback) {
     this->on_emulated_tag_scan_callback_.add(std::move(callback));
   }
 
-  void add_on_finished_write_callback(std::function<void()> callback) {
+  void add_on_finished_write_callback(Callback<void()> &&callback) {
     this->on_finished_write_callback_.add(std::move(callback));
   }
 
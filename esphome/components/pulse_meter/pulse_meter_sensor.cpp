@@ -7,6 +7,9 @@ namespace pulse_meter {
 
 static const char *const TAG = "pulse_meter";
 
+/// Rates held back before they are published even if the publish interval hasn't passed yet.
+static const size_t MAX_BATCHED_RATES = 64;
+
 void PulseMeterSensor::set_total_pulses(uint32_t pulses) {
   this->total_pulses_ = pulses;
   if (this->total_sensor_ != nullptr) {
@@ -75,7 +78,7 @@ void PulseMeterSensor::loop() {
       case MeterState::RUNNING: {
         uint32_t delta_us = this->get_->last_detected_edge_us_ - this->last_processed_edge_us_;
         float pulse_width_us = delta_us / float(this->get_->count_);
-        this->publish_state((60.0f * 1000000.0f) / pulse_width_us);
+        this->publish_rate_((60.0f * 1000000.0f) / pulse_width_us);
       } break;
     }
 
@@ -93,13 +96,34 @@ void PulseMeterSensor::loop() {
           this->meter_state_ = MeterState::TIMED_OUT;
           ESP_LOGD(TAG, "No pulse detected for %" PRIu32 "s, assuming 0 pulses/min",
                    time_since_valid_edge_us / 1000000);
-          this->publish_state(0.0f);
+          this->publish_rate_(0.0f);
         }
       } break;
       default:
         break;
     }
   }
+
+  if (this->publish_interval_ != 0 && millis() - this->last_publish_ >= this->publish_interval_)
+    this->flush_rates_();
+}
+
+void PulseMeterSensor::publish_rate_(float rate) {
+  if (this->publish_interval_ == 0) {
+    this->publish_state(rate);
+    return;
+  }
+  this->rates_.push_back(rate);
+  if (this->rates_.size() >= MAX_BATCHED_RATES)
+    this->flush_rates_();
+}
+
+void PulseMeterSensor::flush_rates_() {
+  this->last_publish_ = millis();
+  if (this->rates_.empty())
+    return;
+  this->publish_samples(this->rates_.data(), this->rates_.size());
+  this->rates_.clear();
 }
 
 float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA; }
@@ -114,6 +138,8 @@ void PulseMeterSensor::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "  Assuming 0 pulses/min after not receiving a pulse for %" PRIu32 "s",
                 this->timeout_us_ / 1000000);
+  if (this->publish_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Publish Interval: %" PRIu32 "ms", this->publish_interval_);
 }
 
 void IRAM_ATTR PulseMeterSensor::edge_intr(PulseMeterSensor *sensor) {
@@ -6,6 +6,7 @@
 #include "esphome/core/helpers.h"
 
 #include <cinttypes>
+#include <vector>
 
 namespace esphome {
 namespace pulse_meter {
@@ -22,6 +23,8 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
   void set_filter_mode(InternalFilterMode mode) { this->filter_mode_ = mode; }
+  /// Collect the rates measured in each loop and publish them together with publish_samples() at this interval.
+  void set_publish_interval(uint32_t publish_interval) { this->publish_interval_ = publish_interval; }
 
   void set_total_pulses(uint32_t pulses);
 
@@ -34,11 +37,17 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   static void edge_intr(PulseMeterSensor *sensor);
   static void pulse_intr(PulseMeterSensor *sensor);
 
+  void publish_rate_(float rate);
+  void flush_rates_();
+
   InternalGPIOPin *pin_{nullptr};
   uint32_t filter_us_ = 0;
   uint32_t timeout_us_ = 1000000UL * 60UL * 5UL;
   sensor::Sensor *total_sensor_{nullptr};
   InternalFilterMode filter_mode_{FILTER_EDGE};
+  uint32_t publish_interval_{0};
+  uint32_t last_publish_{0};
+  std::vector<float> rates_;
 
   // Variables used in the loop
   enum class MeterState { INITIAL, RUNNING, TIMED_OUT };
@@ -34,6 +34,8 @@ FILTER_MODES = {
     "PULSE": PulseMeterInternalFilterMode.FILTER_PULSE,
 }
 
+CONF_PUBLISH_INTERVAL = "publish_interval"
+
 SetTotalPulsesAction = pulse_meter_ns.class_("SetTotalPulsesAction", automation.Action)
 
 
@@ -77,6 +79,8 @@ CONFIG_SCHEMA = sensor.sensor_schema(
         cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
             FILTER_MODES, upper=True
         ),
+        # Pass every measured rate through the filters, but publish them in batches
+        cv.Optional(CONF_PUBLISH_INTERVAL): cv.positive_time_period_milliseconds,
     }
 )
 
@@ -90,6 +94,8 @@ async def to_code(config):
     cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT]))
     cg.add(var.set_filter_mode(config[CONF_INTERNAL_FILTER_MODE]))
+    if CONF_PUBLISH_INTERVAL in config:
+        cg.add(var.set_publish_interval(config[CONF_PUBLISH_INTERVAL]))
 
     if CONF_TOTAL in config:
         sens = await sensor.new_sensor(config[CONF_TOTAL])
@@ -48,10 +48,10 @@ class RFBridgeComponent : public uart::UARTDevice, public Component {
  public:
   void loop() override;
   void dump_config() override;
-  void add_on_code_received_callback(std::function<void(RFBridgeData)> callback) {
+  void add_on_code_received_callback(Callback<void(RFBridgeData)> &&callback) {
     this->data_callback_.add(std::move(callback));
   }
-  void add_on_advanced_code_received_callback(std::function<void(RFBridgeAdvancedData)> callback) {
+  void add_on_advanced_code_received_callback(Callback<void(RFBridgeAdvancedData)> &&callback) {
     this->advanced_data_callback_.add(std::move(callback));
   }
   void send_code(RFBridgeData data);
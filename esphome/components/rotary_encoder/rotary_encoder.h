@@ -84,11 +84,11 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
 
   float get_setup_priority() const override;
 
-  void add_on_clockwise_callback(std::function<void()> callback) {
+  void add_on_clockwise_callback(Callback<void()> &&callback) {
     this->on_clockwise_callback_.add(std::move(callback));
   }
 
-  void add_on_anticlockwise_callback(std::function<void()> callback) {
+  void add_on_anticlockwise_callback(Callback<void()> &&callback) {
     this->on_anticlockwise_callback_.add(std::move(callback));
   }
 
@@ -22,6 +22,16 @@ void arch_restart() {
 void arch_init() { watchdog_enable(0x7fffff, false); }
 void IRAM_ATTR HOT arch_feed_wdt() { watchdog_update(); }
 
+static volatile bool wake_loop_pending = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void arch_sleep_loop(uint32_t ms) {
+  const uint32_t start = millis();
+  while (!wake_loop_pending && millis() - start < ms)
+    delay(1);
+  wake_loop_pending = false;
+}
+void IRAM_ATTR HOT arch_wake_loop() { wake_loop_pending = true; }
+
 uint8_t progmem_read_byte(const uint8_t *addr) {
   return pgm_read_byte(addr);  // NOLINT
 }
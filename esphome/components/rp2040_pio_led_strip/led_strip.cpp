@@ -44,6 +44,12 @@ void RP2040PIOLEDStripLightOutput::setup() {
     return;
   }
 
+  if (!this->front_buffer_.allocate(buffer_size)) {
+    ESP_LOGE(TAG, "Failed to allocate transmit buffer of size %u", buffer_size);
+    this->mark_failed();
+    return;
+  }
+
   // Initialize the PIO program
 
   // Select PIO instance to use (0 or 1)
@@ -104,7 +110,7 @@ void RP2040PIOLEDStripLightOutput::setup() {
 
   dma_channel_configure(this->dma_chan_, &this->dma_config_,
                         &this->pio_->txf[this->sm_],                     // write to the state machine's TX FIFO
-                        this->buf_,                                      // read from memory
+                        this->front_buffer_.data(),                      // read from memory
                         this->is_rgbw_ ? num_leds_ * 4 : num_leds_ * 3,  // number of bytes to transfer
                         false                                            // don't start yet
   );
@@ -125,12 +131,32 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
     return;
   }
 
+  // the previous frame is still being sent, try again next loop iteration so that this change won't get lost
+  if (dma_channel_is_busy(this->dma_chan_)) {
+    this->schedule_show();
+    return;
+  }
+  // Counts the frame and switches the power supply, if one is configured, with the LEDs
+  this->mark_shown_();
+
   // the bits are already in the correct order for the pio program so we can just copy the buffer using DMA
-  dma_channel_transfer_from_buffer_now(this->dma_chan_, this->buf_, this->get_buffer_size_());
+  const uint8_t *frame = this->front_buffer_.present(this->buf_);
+  dma_channel_transfer_from_buffer_now(this->dma_chan_, frame, this->front_buffer_.size());
 }
 
 light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0, w = 0;
+  light::ESPPixelSpan span = this->get_pixel_span_();
+  uint8_t *led = span.data + index * span.stride;
+  return {led + span.offsets[0],
+          led + span.offsets[1],
+          led + span.offsets[2],
+          span.channels == 4 ? led + span.offsets[3] : nullptr,
+          &this->effect_data_[index],
+          &this->correction_};
+}
+
+light::ESPPixelSpan RP2040PIOLEDStripLightOutput::get_pixel_span_() const {
+  uint8_t r = 0, g = 0, b = 0;
   switch (this->rgb_order_) {
     case ORDER_RGB:
       r = 0;
@@ -163,13 +189,15 @@ light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t inde
       b = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ ? 4 : 3;
-  return {this->buf_ + (index * multiplier) + r,
-          this->buf_ + (index * multiplier) + g,
-          this->buf_ + (index * multiplier) + b,
-          this->is_rgbw_ ? this->buf_ + (index * multiplier) + 3 : nullptr,
-          &this->effect_data_[index],
-          &this->correction_};
+  light::ESPPixelSpan span;
+  span.data = this->buf_;
+  span.stride = this->is_rgbw_ ? 4 : 3;
+  span.channels = span.stride;
+  span.offsets[0] = r;
+  span.offsets[1] = g;
+  span.offsets[2] = b;
+  span.offsets[3] = 3;
+  return span;
 }
 
 void RP2040PIOLEDStripLightOutput::dump_config() {
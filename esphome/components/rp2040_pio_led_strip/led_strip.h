@@ -92,11 +92,14 @@ class RP2040PIOLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPPixelSpan get_pixel_span_() const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (3 + this->is_rgbw_); }
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
+  /// The frame that DMA is sending, so the next frame can be prepared in buf_ in the meantime.
+  light::AddressableFrontBuffer front_buffer_;
 
   uint8_t pin_;
   uint32_t num_leds_;
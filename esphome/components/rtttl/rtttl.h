@@ -45,7 +45,7 @@ class Rtttl : public Component {
   bool is_playing() { return this->note_duration_ != 0; }
   void loop() override;
 
-  void add_on_finished_playback_callback(std::function<void()> callback) {
+  void add_on_finished_playback_callback(Callback<void()> &&callback) {
     this->on_finished_playback_callback_.add(std::move(callback));
   }
 
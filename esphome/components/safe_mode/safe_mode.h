@@ -25,7 +25,7 @@ class SafeModeComponent : public Component {
 
   void on_safe_shutdown() override;
 
-  void add_on_safe_mode_callback(std::function<void()> &&callback) {
+  void add_on_safe_mode_callback(Callback<void()> &&callback) {
     this->safe_mode_callback_.add(std::move(callback));
   }
 
@@ -28,6 +28,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_WINDOW_SIZE,
     CONF_MQTT_ID,
@@ -93,7 +94,11 @@ from esphome.const import (
 )
 from esphome.core import CORE, coroutine_with_priority
 from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import (
+    build_registry_entry,
+    extract_registry_entry_config,
+    setup_entity,
+)
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -177,6 +182,26 @@ def validate_send_first_at(value):
 
 FILTER_REGISTRY = Registry()
 validate_filters = cv.validate_registry("filter", FILTER_REGISTRY)
+# Builders of the constructor arguments of filters that can be fused, by filter name
+FUSIBLE_FILTERS = {}
+
+
+def register_fusible_filter(name, type_id, schema):
+    """Register a filter that only produces values from new_value().
+
+    Consecutive filters registered like this are fused into a single FusedFilter. The
+    decorated function returns the constructor arguments of the filter, not the filter.
+    """
+
+    def decorator(fun):
+        async def to_code(config, filter_id):
+            return cg.new_Pvariable(filter_id, *await fun(config))
+
+        FILTER_REGISTRY.register(name, type_id, schema)(to_code)
+        FUSIBLE_FILTERS[name] = fun
+        return fun
+
+    return decorator
 
 
 def validate_datapoint(value):
@@ -249,6 +274,7 @@ CalibratePolynomialFilter = sensor_ns.class_("CalibratePolynomialFilter", Filter
 SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
+FusedFilter = sensor_ns.class_("FusedFilter", Filter)
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -333,25 +359,25 @@ def sensor_schema(
     return SENSOR_SCHEMA.extend(schema)
 
 
-@FILTER_REGISTRY.register("offset", OffsetFilter, cv.float_)
-async def offset_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+@register_fusible_filter("offset", OffsetFilter, cv.float_)
+async def offset_filter_to_code(config):
+    return [config]
 
 
-@FILTER_REGISTRY.register("multiply", MultiplyFilter, cv.float_)
-async def multiply_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+@register_fusible_filter("multiply", MultiplyFilter, cv.float_)
+async def multiply_filter_to_code(config):
+    return [config]
 
 
-@FILTER_REGISTRY.register("filter_out", FilterOutValueFilter, cv.float_)
-async def filter_out_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+@register_fusible_filter("filter_out", FilterOutValueFilter, cv.float_)
+async def filter_out_filter_to_code(config):
+    return [config]
 
 
 QUANTILE_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65535),
             cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
             cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
             cv.Optional(CONF_QUANTILE, default=0.9): cv.zero_to_one_float,
@@ -361,21 +387,20 @@ QUANTILE_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("quantile", QuantileFilter, QUANTILE_SCHEMA)
-async def quantile_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@register_fusible_filter("quantile", QuantileFilter, QUANTILE_SCHEMA)
+async def quantile_filter_to_code(config):
+    return [
         config[CONF_WINDOW_SIZE],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
         config[CONF_QUANTILE],
-    )
+    ]
 
 
 MEDIAN_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65535),
             cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
             cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
         }
@@ -384,20 +409,19 @@ MEDIAN_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("median", MedianFilter, MEDIAN_SCHEMA)
-async def median_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@register_fusible_filter("median", MedianFilter, MEDIAN_SCHEMA)
+async def median_filter_to_code(config):
+    return [
         config[CONF_WINDOW_SIZE],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
-    )
+    ]
 
 
 MIN_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65535),
             cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
             cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
         }
@@ -406,25 +430,24 @@ MIN_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("skip_initial", SkipInitialFilter, cv.positive_not_null_int)
-async def skip_initial_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+@register_fusible_filter("skip_initial", SkipInitialFilter, cv.positive_not_null_int)
+async def skip_initial_filter_to_code(config):
+    return [config]
 
 
-@FILTER_REGISTRY.register("min", MinFilter, MIN_SCHEMA)
-async def min_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@register_fusible_filter("min", MinFilter, MIN_SCHEMA)
+async def min_filter_to_code(config):
+    return [
         config[CONF_WINDOW_SIZE],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
-    )
+    ]
 
 
 MAX_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65535),
             cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
             cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
         }
@@ -433,14 +456,13 @@ MAX_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("max", MaxFilter, MAX_SCHEMA)
-async def max_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@register_fusible_filter("max", MaxFilter, MAX_SCHEMA)
+async def max_filter_to_code(config):
+    return [
         config[CONF_WINDOW_SIZE],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
-    )
+    ]
 
 
 SLIDING_AVERAGE_SCHEMA = cv.All(
@@ -455,18 +477,17 @@ SLIDING_AVERAGE_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "sliding_window_moving_average",
     SlidingWindowMovingAverageFilter,
     SLIDING_AVERAGE_SCHEMA,
 )
-async def sliding_window_moving_average_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+async def sliding_window_moving_average_filter_to_code(config):
+    return [
         config[CONF_WINDOW_SIZE],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
-    )
+    ]
 
 
 EXPONENTIAL_AVERAGE_SCHEMA = cv.All(
@@ -481,18 +502,17 @@ EXPONENTIAL_AVERAGE_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "exponential_moving_average",
     ExponentialMovingAverageFilter,
     EXPONENTIAL_AVERAGE_SCHEMA,
 )
-async def exponential_moving_average_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+async def exponential_moving_average_filter_to_code(config):
+    return [
         config[CONF_ALPHA],
         config[CONF_SEND_EVERY],
         config[CONF_SEND_FIRST_AT],
-    )
+    ]
 
 
 @FILTER_REGISTRY.register(
@@ -504,12 +524,12 @@ async def throttle_average_filter_to_code(config, filter_id):
     return var
 
 
-@FILTER_REGISTRY.register("lambda", LambdaFilter, cv.returning_lambda)
-async def lambda_filter_to_code(config, filter_id):
+@register_fusible_filter("lambda", LambdaFilter, cv.returning_lambda)
+async def lambda_filter_to_code(config):
     lambda_ = await cg.process_lambda(
         config, [(float, "x")], return_type=cg.optional.template(float)
     )
-    return cg.new_Pvariable(filter_id, lambda_)
+    return [lambda_]
 
 
 DELTA_SCHEMA = cv.Schema(
@@ -536,14 +556,13 @@ def validate_delta(config):
     raise cv.Invalid("Delta filter requires a positive number or percentage value.")
 
 
-@FILTER_REGISTRY.register("delta", DeltaFilter, cv.Any(DELTA_SCHEMA, validate_delta))
-async def delta_filter_to_code(config, filter_id):
+@register_fusible_filter("delta", DeltaFilter, cv.Any(DELTA_SCHEMA, validate_delta))
+async def delta_filter_to_code(config):
     percentage = config[CONF_TYPE] == "percentage"
-    return cg.new_Pvariable(
-        filter_id,
+    return [
         config[CONF_VALUE],
         percentage,
-    )
+    ]
 
 
 @FILTER_REGISTRY.register("or", OrFilter, validate_filters)
@@ -552,11 +571,11 @@ async def or_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, filters)
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "throttle", ThrottleFilter, cv.positive_time_period_milliseconds
 )
-async def throttle_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+async def throttle_filter_to_code(config):
+    return [config]
 
 
 @FILTER_REGISTRY.register(
@@ -618,7 +637,7 @@ def validate_calibrate_linear(config):
     return config
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "calibrate_linear",
     CalibrateLinearFilter,
     cv.maybe_simple_value(
@@ -634,7 +653,7 @@ def validate_calibrate_linear(config):
         key=CONF_DATAPOINTS,
     ),
 )
-async def calibrate_linear_filter_to_code(config, filter_id):
+async def calibrate_linear_filter_to_code(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
@@ -644,7 +663,7 @@ async def calibrate_linear_filter_to_code(config, filter_id):
         linear_functions = [[k, b, float("NaN")]]
     elif config[CONF_METHOD] == "exact":
         linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+    return [linear_functions]
 
 
 CONF_DEGREE = "degree"
@@ -659,7 +678,7 @@ def validate_calibrate_polynomial(config):
     return config
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "calibrate_polynomial",
     CalibratePolynomialFilter,
     cv.All(
@@ -674,7 +693,7 @@ def validate_calibrate_polynomial(config):
         validate_calibrate_polynomial,
     ),
 )
-async def calibrate_polynomial_filter_to_code(config, filter_id):
+async def calibrate_polynomial_filter_to_code(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
     degree = config[CONF_DEGREE]
@@ -682,7 +701,7 @@ async def calibrate_polynomial_filter_to_code(config, filter_id):
     # Column vector
     b = [[v] for v in y]
     res = [v[0] for v in _lstsq(a, b)]
-    return cg.new_Pvariable(filter_id, res)
+    return [res]
 
 
 def validate_clamp(config):
@@ -707,17 +726,16 @@ CLAMP_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("clamp", ClampFilter, CLAMP_SCHEMA)
-async def clamp_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@register_fusible_filter("clamp", ClampFilter, CLAMP_SCHEMA)
+async def clamp_filter_to_code(config):
+    return [
         config[CONF_MIN_VALUE],
         config[CONF_MAX_VALUE],
         config[CONF_IGNORE_OUT_OF_RANGE],
-    )
+    ]
 
 
-@FILTER_REGISTRY.register(
+@register_fusible_filter(
     "round",
     RoundFilter,
     cv.maybe_simple_value(
@@ -727,15 +745,41 @@ async def clamp_filter_to_code(config, filter_id):
         key=CONF_ACCURACY_DECIMALS,
     ),
 )
-async def round_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+async def round_filter_to_code(config):
+    return [
         config[CONF_ACCURACY_DECIMALS],
-    )
+    ]
 
 
 async def build_filters(config):
-    return await cg.build_registry_list(FILTER_REGISTRY, config)
+    filters = []
+    # Consecutive filters that can be fused, as (type id, constructor arguments)
+    fusible = []
+
+    def fuse():
+        if len(fusible) == 1:
+            filter_id, args = fusible[0]
+            filters.append(cg.new_Pvariable(filter_id, *args))
+        elif fusible:
+            fused_id = fusible[0][0].copy()
+            fused_id.type = FusedFilter.template(*(id_.type for id_, _ in fusible))
+            filters.append(
+                cg.new_Pvariable(fused_id, *(id_.type(*args) for id_, args in fusible))
+            )
+        fusible.clear()
+
+    for conf in config:
+        registry_entry, filter_config = extract_registry_entry_config(
+            FILTER_REGISTRY, conf
+        )
+        if registry_entry.name in FUSIBLE_FILTERS:
+            args = await FUSIBLE_FILTERS[registry_entry.name](filter_config)
+            fusible.append((conf[CONF_TYPE_ID], args))
+        else:
+            fuse()
+            filters.append(await build_registry_entry(FILTER_REGISTRY, conf))
+    fuse()
+    return filters
 
 
 async def setup_sensor_core_(var, config):
@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -31,40 +32,136 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// SortedWindow
+void SortedWindow::set_window_size(size_t window_size) {
+  this->nodes_.set_capacity(std::min<size_t>(window_size, NIL));
+  this->root_ = NIL;
+}
+void SortedWindow::push(float value) {
+  if (this->nodes_.capacity() == 0)
+    return;
+  if (this->nodes_.full()) {
+    if (!std::isnan(this->nodes_.front().value))
+      this->root_ = this->erase_(this->root_, this->nodes_.front_pos());
+    this->nodes_.pop_front();
+  }
+  const uint16_t n = this->nodes_.push_back(Node{value, NIL, NIL, 1});
+  if (!std::isnan(value))
+    this->root_ = this->insert_(this->root_, n);
+}
+float SortedWindow::get(size_t k) const {
+  uint16_t n = this->root_;
+  while (true) {
+    const Node &node = this->nodes_.at(n);
+    size_t left = this->size_of_(node.left);
+    if (k < left) {
+      n = node.left;
+    } else if (k == left) {
+      return node.value;
+    } else {
+      k -= left + 1;
+      n = node.right;
+    }
+  }
+}
+bool SortedWindow::less_(uint16_t a, uint16_t b) const {
+  float va = this->nodes_.at(a).value, vb = this->nodes_.at(b).value;
+  return va < vb || (va == vb && a < b);
+}
+uint32_t SortedWindow::priority_(uint16_t n) {
+  // Finalizer of MurmurHash3, so that priorities look random whatever order values arrive in
+  uint32_t h = n;
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+void SortedWindow::update_(uint16_t n) {
+  Node &node = this->nodes_.at(n);
+  node.size = this->size_of_(node.left) + this->size_of_(node.right) + 1;
+}
+void SortedWindow::split_(uint16_t root, uint16_t n, uint16_t *left, uint16_t *right) {
+  if (root == NIL) {
+    *left = *right = NIL;
+    return;
+  }
+  Node &node = this->nodes_.at(root);
+  if (this->less_(root, n)) {
+    this->split_(node.right, n, &node.right, right);
+    *left = root;
+  } else {
+    this->split_(node.left, n, left, &node.left);
+    *right = root;
+  }
+  this->update_(root);
+}
+uint16_t SortedWindow::merge_(uint16_t left, uint16_t right) {
+  if (left == NIL)
+    return right;
+  if (right == NIL)
+    return left;
+  if (priority_(left) > priority_(right)) {
+    this->nodes_.at(left).right = this->merge_(this->nodes_.at(left).right, right);
+    this->update_(left);
+    return left;
+  }
+  this->nodes_.at(right).left = this->merge_(left, this->nodes_.at(right).left);
+  this->update_(right);
+  return right;
+}
+uint16_t SortedWindow::insert_(uint16_t root, uint16_t n) {
+  if (root == NIL)
+    return n;
+  if (priority_(n) > priority_(root)) {
+    this->split_(root, n, &this->nodes_.at(n).left, &this->nodes_.at(n).right);
+    this->update_(n);
+    return n;
+  }
+  Node &node = this->nodes_.at(root);
+  if (this->less_(n, root)) {
+    node.left = this->insert_(node.left, n);
+  } else {
+    node.right = this->insert_(node.right, n);
+  }
+  this->update_(root);
+  return root;
+}
+uint16_t SortedWindow::erase_(uint16_t root, uint16_t n) {
+  Node &node = this->nodes_.at(root);
+  if (root == n)
+    return this->merge_(node.left, node.right);
+  if (this->less_(n, root)) {
+    node.left = this->erase_(node.left, n);
+  } else {
+    node.right = this->erase_(node.right, n);
+  }
+  this->update_(root);
+  return root;
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t size = this->window_.size();
+    if (size) {
+      if (size % 2) {
+        median = this->window_.get(size / 2);
+      } else {
+        median = (this->window_.get(size / 2) + this->window_.get((size / 2) - 1)) / 2.0f;
       }
     }
 
@@ -89,38 +186,25 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {
+  this->window_.set_window_size(window_size);
+}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t size = this->window_.size();
+    if (size) {
+      size_t position = std::max(ceilf(size * this->quantile_), 1.0f) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, size);
+      result = this->window_.get(position);
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -129,28 +213,53 @@ optional<float> QuantileFilter::new_value(float value) {
   return {};
 }
 
+// ExtremumWindow
+void ExtremumWindow::set_window_size(size_t window_size) {
+  window_size = std::min<size_t>(window_size, UINT16_MAX);
+  this->values_.set_capacity(window_size);
+  this->candidates_.set_capacity(window_size);
+}
+void ExtremumWindow::push(float value) {
+  if (this->values_.capacity() == 0)
+    return;
+  if (this->values_.full()) {
+    if (!this->candidates_.empty() && this->candidates_.front() == this->values_.front_pos())
+      this->candidates_.pop_front();
+    this->values_.pop_front();
+  }
+  const uint16_t pos = this->values_.push_back(value);
+  if (std::isnan(value))
+    return;
+  // Older values that are not more extreme than this one can never be the extremum again
+  while (!this->candidates_.empty()) {
+    float last = this->values_.at(this->candidates_.back());
+    if (this->max_ ? last > value : last < value)
+      break;
+    this->candidates_.pop_back();
+  }
+  this->candidates_.push_back(pos);
+}
+float ExtremumWindow::get() {
+  if (this->candidates_.empty())
+    return NAN;
+  return this->values_.at(this->candidates_.front());
+}
+
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
-
+    float min = this->window_.get();
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
   }
@@ -159,26 +268,19 @@ optional<float> MinFilter::new_value(float value) {
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
-
+    float max = this->window_.get();
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
   }
@@ -188,31 +290,76 @@ optional<float> MaxFilter::new_value(float value) {
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
+}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  this->sum_ = 0.0f;
+  this->sum_compensation_ = 0.0f;
+  this->finite_count_ = 0;
+  this->positive_infinity_count_ = 0;
+  this->negative_infinity_count_ = 0;
+  this->since_resum_ = 0;
+}
+void SlidingWindowMovingAverageFilter::add_to_sum_(float value) {
+  const float y = value - this->sum_compensation_;
+  const float t = this->sum_ + y;
+  this->sum_compensation_ = (t - this->sum_) - y;
+  this->sum_ = t;
+}
+void SlidingWindowMovingAverageFilter::resum_() {
+  this->sum_ = 0.0f;
+  this->sum_compensation_ = 0.0f;
+  for (size_t i = 0, pos = this->queue_.front_pos(); i < this->queue_.size(); i++) {
+    if (std::isfinite(this->queue_.at(pos)))
+      this->add_to_sum_(this->queue_.at(pos));
+    pos = pos + 1 == this->queue_.capacity() ? 0 : pos + 1;
+  }
+  this->since_resum_ = 0;
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
+  if (this->queue_.capacity() == 0)
+    return {};
+  if (this->queue_.full()) {
+    const float old = this->queue_.front();
     this->queue_.pop_front();
+    if (std::isfinite(old)) {
+      this->add_to_sum_(-old);
+      this->finite_count_--;
+    } else if (old > 0) {
+      this->positive_infinity_count_--;
+    } else if (old < 0) {
+      this->negative_infinity_count_--;
+    }
   }
   this->queue_.push_back(value);
+  if (std::isfinite(value)) {
+    this->add_to_sum_(value);
+    this->finite_count_++;
+  } else if (value > 0) {
+    this->positive_infinity_count_++;
+  } else if (value < 0) {
+    this->negative_infinity_count_++;
+  }
+  // Once per window, so this stays O(1) per value on average
+  if (++this->since_resum_ >= this->queue_.capacity())
+    this->resum_();
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float sum = 0;
-    size_t valid_count = 0;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        sum += v;
-        valid_count++;
-      }
-    }
-
+    // With infinities of both signs the average stays NaN, like their sum
     float average = NAN;
-    if (valid_count) {
-      average = sum / valid_count;
+    if (this->positive_infinity_count_ == 0 && this->negative_infinity_count_ == 0) {
+      if (this->finite_count_)
+        average = this->sum_ / this->finite_count_;
+    } else if (this->negative_infinity_count_ == 0) {
+      average = INFINITY;
+    } else if (this->positive_infinity_count_ == 0) {
+      average = -INFINITY;
     }
 
     ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f) SENDING %f", this, value, average);
@@ -290,13 +437,9 @@ optional<float> LambdaFilter::new_value(float value) {
 // OffsetFilter
 OffsetFilter::OffsetFilter(float offset) : offset_(offset) {}
 
-optional<float> OffsetFilter::new_value(float value) { return value + this->offset_; }
-
 // MultiplyFilter
 MultiplyFilter::MultiplyFilter(float multiplier) : multiplier_(multiplier) {}
 
-optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_; }
-
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(float value_to_filter_out) : value_to_filter_out_(value_to_filter_out) {}
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <queue>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include "esphome/core/component.h"
@@ -43,6 +45,122 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** Double-ended queue of fixed capacity in a ring, allocated once when the capacity is set.
+ *
+ * Holds the windows of the sliding window filters, so that they don't allocate after setup. Elements stay at the same
+ * position until they are removed, so positions can be used to refer to them.
+ */
+template<typename T> class FilterRing {
+ public:
+  /// Clear the ring and make room for \p capacity elements.
+  void set_capacity(size_t capacity) {
+    this->data_ = std::unique_ptr<T[]>(new T[capacity]);  // NOLINT(cppcoreguidelines-owning-memory)
+    this->capacity_ = capacity;
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+  size_t capacity() const { return this->capacity_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+  /// Position of the oldest element.
+  size_t front_pos() const { return this->head_; }
+  /// Position of the newest element.
+  size_t back_pos() const { return this->wrap_(this->head_ + this->size_ - 1); }
+  T &at(size_t pos) { return this->data_[pos]; }
+  const T &at(size_t pos) const { return this->data_[pos]; }
+  T &front() { return this->data_[this->front_pos()]; }
+  T &back() { return this->data_[this->back_pos()]; }
+
+  /// Append an element and return its position. The ring must not be full.
+  size_t push_back(const T &value) {
+    const size_t pos = this->wrap_(this->head_ + this->size_);
+    this->data_[pos] = value;
+    this->size_++;
+    return pos;
+  }
+  void pop_front() {
+    this->head_ = this->wrap_(this->head_ + 1);
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+
+ protected:
+  size_t wrap_(size_t pos) const { return pos >= this->capacity_ ? pos - this->capacity_ : pos; }
+
+  std::unique_ptr<T[]> data_;
+  size_t capacity_{0};
+  size_t head_{0};
+  size_t size_{0};
+};
+
+/** The last values of a sensor, ordered so that the k-th smallest of them can be looked up.
+ *
+ * Values are stored in a ring of nodes that are at the same time the nodes of a treap ordered by value.
+ * Adding a value, which drops the oldest one once the window is full, and looking up a value by its rank both take
+ * O(log n) and never allocate. NaN values take up room in the window, but are not ranked.
+ */
+class SortedWindow {
+ public:
+  /// Clear the window and make room for \p window_size values, at most 65535.
+  void set_window_size(size_t window_size);
+  /// Add a value, dropping the oldest one if the window is full.
+  void push(float value);
+  /// Number of values in the window that are not NaN.
+  size_t size() const { return this->size_of_(this->root_); }
+  /// The \p k-th smallest value that is not NaN, starting at 0. Must be less than size().
+  float get(size_t k) const;
+
+ protected:
+  static const uint16_t NIL = UINT16_MAX;
+  struct Node {
+    float value;
+    uint16_t left;
+    uint16_t right;
+    /// Number of nodes in the subtree of this node.
+    uint16_t size;
+  };
+
+  uint16_t size_of_(uint16_t n) const { return n == NIL ? 0 : this->nodes_.at(n).size; }
+  /// Order of the nodes, ties are broken by position so that every node can be found again.
+  bool less_(uint16_t a, uint16_t b) const;
+  /// Heap priority of a node, derived from its position instead of stored.
+  static uint32_t priority_(uint16_t n);
+  void update_(uint16_t n);
+  /// Split \p root into the nodes ordered before \p n and the rest.
+  void split_(uint16_t root, uint16_t n, uint16_t *left, uint16_t *right);
+  uint16_t merge_(uint16_t left, uint16_t right);
+  uint16_t insert_(uint16_t root, uint16_t n);
+  uint16_t erase_(uint16_t root, uint16_t n);
+
+  FilterRing<Node> nodes_;
+  uint16_t root_{NIL};
+};
+
+/** The last values of a sensor, keeping track of the smallest or largest of them.
+ *
+ * Besides the values, a monotonic queue holds the positions of the values that can still become the extremum, in
+ * the order they were added. Each value enters and leaves it at most once, so adding a value takes amortized O(1)
+ * and the extremum is always at the front. NaN values are ignored.
+ */
+class ExtremumWindow {
+ public:
+  explicit ExtremumWindow(bool max) : max_(max) {}
+  /// Clear the window and make room for \p window_size values, at most 65535.
+  void set_window_size(size_t window_size);
+  /// Add a value, dropping the oldest one if the window is full.
+  void push(float value);
+  /// The smallest or largest value in the window, NaN if there is none.
+  float get();
+
+ protected:
+  bool max_;
+  FilterRing<float> values_;
+  /// Positions in values_, the values they point to are strictly ordered from the extremum at the front.
+  FilterRing<uint16_t> candidates_;
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -67,10 +185,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -96,10 +213,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -142,10 +258,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  ExtremumWindow window_{false};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -170,10 +285,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  ExtremumWindow window_{true};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -199,10 +313,24 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Add \p value to the running sum with Kahan summation.
+  void add_to_sum_(float value);
+  /// Sum up the window again, so the rounding errors of values that left it don't add up over time.
+  void resum_();
+
+  FilterRing<float> queue_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
+  float sum_{0.0f};
+  /// Running compensation of the low-order bits lost in sum_.
+  float sum_compensation_{0.0f};
+  /// Number of finite values in the window.
+  size_t finite_count_{0};
+  /// Infinite values are counted instead of summed, a sum that once was infinite can't be brought back.
+  size_t positive_infinity_count_{0};
+  size_t negative_infinity_count_{0};
+  /// Values added since the last resum_().
+  size_t since_resum_{0};
 };
 
 /** Simple exponential moving average filter.
@@ -275,7 +403,7 @@ class OffsetFilter : public Filter {
  public:
   explicit OffsetFilter(float offset);
 
-  optional<float> new_value(float value) override;
+  optional<float> new_value(float value) override { return value + this->offset_; }
 
  protected:
   float offset_;
@@ -286,7 +414,7 @@ class MultiplyFilter : public Filter {
  public:
   explicit MultiplyFilter(float multiplier);
 
-  optional<float> new_value(float value) override;
+  optional<float> new_value(float value) override { return value * this->multiplier_; }
 
  protected:
   float multiplier_;
@@ -431,5 +559,48 @@ class RoundFilter : public Filter {
   uint8_t precision_;
 };
 
+/** Several filters that follow each other in a chain, fused into a single filter.
+ *
+ * The filters are stored by value and called directly one after the other, instead of through a virtual call and
+ * output() per filter. Like in a chain, a filter that returns an empty optional stops the value. Only filters that
+ * produce their output solely from new_value() can be fused, not ones that call output() themselves.
+ *
+ * Generated by the code generator for consecutive filters of a sensor that support it.
+ */
+template<typename... Fs> class FusedFilter : public Filter {
+ public:
+  explicit FusedFilter(Fs... filters) : filters_(std::move(filters)...) {}
+
+  void initialize(Sensor *parent, Filter *next) override {
+    Filter::initialize(parent, next);
+    this->initialize_(parent, Index<0>{});
+  }
+
+  optional<float> new_value(float value) override { return this->new_value_(value, Index<0>{}); }
+
+ protected:
+  template<size_t I> struct Index {};
+  using Tuple = std::tuple<Fs...>;
+
+  void initialize_(Sensor * /*parent*/, Index<sizeof...(Fs)> /*unused*/) {}
+  template<size_t I> void initialize_(Sensor *parent, Index<I> /*unused*/) {
+    // The fused filters only need their parent, their output is returned to this filter
+    std::get<I>(this->filters_).initialize(parent, nullptr);
+    this->initialize_(parent, Index<I + 1>{});
+  }
+
+  optional<float> new_value_(float value, Index<sizeof...(Fs)> /*unused*/) { return value; }
+  template<size_t I> optional<float> new_value_(float value, Index<I> /*unused*/) {
+    using F = typename std::tuple_element<I, Tuple>::type;
+    // Qualified, so this is never a virtual call
+    optional<float> out = std::get<I>(this->filters_).F::new_value(value);
+    if (!out.has_value())
+      return {};
+    return this->new_value_(*out, Index<I + 1>{});
+  }
+
+  Tuple filters_;
+};
+
 }  // namespace sensor
 }  // namespace esphome
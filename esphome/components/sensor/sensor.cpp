@@ -49,10 +49,38 @@ void Sensor::publish_state(float state) {
   }
 }
 
-void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
-void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
+void Sensor::publish_samples(const float *samples, size_t count) {
+  if (count == 0)
+    return;
+  ESP_LOGV(TAG, "'%s': Received %zu samples, last %f", this->name_.c_str(), count, samples[count - 1]);
+
+  this->in_burst_ = true;
+  this->burst_has_state_ = false;
+  for (size_t i = 0; i < count; i++) {
+    this->raw_state = samples[i];
+    this->raw_callback_.call(samples[i]);
+    if (this->filter_list_ == nullptr) {
+      this->internal_send_state_to_frontend(samples[i]);
+    } else {
+      this->filter_list_->input(samples[i]);
+    }
+  }
+  this->in_burst_ = false;
+
+  if (this->burst_has_state_) {
+    ESP_LOGD(TAG, "'%s': Sending state %.5f %s with %d decimals of accuracy", this->get_name().c_str(), this->state,
+             this->get_unit_of_measurement().c_str(), this->get_accuracy_decimals());
+    this->frontend_callback_.call(this->state);
+  }
+}
+
+void Sensor::add_on_state_callback(Callback<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
+void Sensor::add_on_raw_state_callback(Callback<void(float)> &&callback) {
   this->raw_callback_.add(std::move(callback));
 }
+void Sensor::add_on_frontend_state_callback(Callback<void(float)> &&callback) {
+  this->frontend_callback_.add(std::move(callback));
+}
 
 void Sensor::add_filter(Filter *filter) {
   // inefficient, but only happens once on every sensor setup and nobody's going to have massive amounts of
@@ -90,9 +118,16 @@ std::string Sensor::unique_id() { return ""; }
 void Sensor::internal_send_state_to_frontend(float state) {
   this->has_state_ = true;
   this->state = state;
+  if (this->in_burst_) {
+    // The front-ends get the last value once publish_samples() is done
+    this->burst_has_state_ = true;
+    this->callback_.call(state);
+    return;
+  }
   ESP_LOGD(TAG, "'%s': Sending state %.5f %s with %d decimals of accuracy", this->get_name().c_str(), state,
            this->get_unit_of_measurement().c_str(), this->get_accuracy_decimals());
   this->callback_.call(state);
+  this->frontend_callback_.call(state);
 }
 bool Sensor::has_state() const { return this->has_state_; }
 
@@ -114,12 +114,22 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a burst of \p count raw samples at once, for sensors that read several samples at a time.
+   *
+   * Every sample is passed through the filters like with publish_state(), and the raw state and state callbacks are
+   * called for every sample and every value that comes out of the filters. Only the front-ends (the frontend state
+   * callbacks) are notified once after the whole burst, with the last value.
+   */
+  void publish_samples(const float *samples, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
-  void add_on_state_callback(std::function<void(float)> &&callback);
+  void add_on_state_callback(Callback<void(float)> &&callback);
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(float)> &&callback);
+  void add_on_raw_state_callback(Callback<void(float)> &&callback);
+  /// Add a callback for front-ends, like add_on_state_callback() but only called once per publish_samples().
+  void add_on_frontend_state_callback(Callback<void(float)> &&callback);
 
   /** This member variable stores the last state that has passed through all filters.
    *
@@ -148,8 +158,9 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
   void internal_send_state_to_frontend(float state);
 
  protected:
-  CallbackManager<void(float)> raw_callback_;  ///< Storage for raw state callbacks.
-  CallbackManager<void(float)> callback_;      ///< Storage for filtered state callbacks.
+  CallbackManager<void(float)> raw_callback_;       ///< Storage for raw state callbacks.
+  CallbackManager<void(float)> callback_;           ///< Storage for filtered state callbacks.
+  CallbackManager<void(float)> frontend_callback_;  ///< Storage for front-end state callbacks.
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
@@ -157,6 +168,10 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
   optional<StateClass> state_class_{STATE_CLASS_NONE};  ///< State class override
   bool force_update_{false};                            ///< Force update mode
   bool has_state_{false};
+  /// Whether publish_samples() is running the filters, which holds back the front-ends until the burst is done.
+  bool in_burst_{false};
+  /// Whether a value came out of the filters during the current burst.
+  bool burst_has_state_{false};
 };
 
 }  // namespace sensor
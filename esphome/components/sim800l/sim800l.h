@@ -61,19 +61,19 @@ class Sim800LComponent : public uart::UARTDevice, public PollingComponent {
 #ifdef USE_SENSOR
   void set_rssi_sensor(sensor::Sensor *rssi_sensor) { rssi_sensor_ = rssi_sensor; }
 #endif
-  void add_on_sms_received_callback(std::function<void(std::string, std::string)> callback) {
+  void add_on_sms_received_callback(Callback<void(std::string, std::string)> &&callback) {
     this->sms_received_callback_.add(std::move(callback));
   }
-  void add_on_incoming_call_callback(std::function<void(std::string)> callback) {
+  void add_on_incoming_call_callback(Callback<void(std::string)> &&callback) {
     this->incoming_call_callback_.add(std::move(callback));
   }
-  void add_on_call_connected_callback(std::function<void()> callback) {
+  void add_on_call_connected_callback(Callback<void()> &&callback) {
     this->call_connected_callback_.add(std::move(callback));
   }
-  void add_on_call_disconnected_callback(std::function<void()> callback) {
+  void add_on_call_disconnected_callback(Callback<void()> &&callback) {
     this->call_disconnected_callback_.add(std::move(callback));
   }
-  void add_on_ussd_received_callback(std::function<void(std::string)> callback) {
+  void add_on_ussd_received_callback(Callback<void(std::string)> &&callback) {
     this->ussd_received_callback_.add(std::move(callback));
   }
   void send_sms(const std::string &recipient, const std::string &message);
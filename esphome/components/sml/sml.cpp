@@ -62,7 +62,7 @@ void Sml::loop() {
   }
 }
 
-void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
+void Sml::add_on_data_callback(Callback<void(const std::vector<uint8_t> &, bool)> &&callback) {
   this->data_callbacks_.add(std::move(callback));
 }
 
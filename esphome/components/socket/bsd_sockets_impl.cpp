@@ -59,6 +59,7 @@ class BSDSocketImpl : public Socket {
     return ret;
   }
   int shutdown(int how) override { return ::shutdown(fd_, how); }
+  int get_fd() const override { return fd_; }
 
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override { return ::getpeername(fd_, addr, addrlen); }
   std::string getpeername() override {
@@ -6,6 +6,9 @@
 #include "headers.h"
 
 namespace esphome {
+
+class Component;
+
 namespace socket {
 
 class Socket {
@@ -41,6 +44,9 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /// The underlying file descriptor, or -1 if the implementation has none.
+  virtual int get_fd() const { return -1; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -55,5 +61,19 @@ socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::stri
 /// Set a sockaddr to the any address and specified port for the IP version used by socket_ip().
 socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port);
 
+/** Re-enable the loop of a component once a socket becomes readable (data or a pending connection).
+ *
+ * This lets components that would otherwise poll a socket call disable_loop() while they wait. The watch fires
+ * once: it is dropped after waking the component, which must call this again before disabling its loop the next
+ * time. A background task select()s on all watched sockets, so this is only available with BSD sockets on ESP32
+ * and host; elsewhere it returns false and the caller has to keep polling.
+ *
+ * Must be called from the main loop. The socket must stay open until the watch fired or was cancelled.
+ */
+bool wake_on_readable(Socket *sock, Component *component);
+
+/// Drop a pending wake_on_readable() watch, e.g. before closing the socket.
+void cancel_wake_on_readable(Socket *sock);
+
 }  // namespace socket
 }  // namespace esphome
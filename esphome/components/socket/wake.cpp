@@ -0,0 +1,200 @@
+#include "socket.h"
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) && (defined(USE_ESP32) || defined(USE_HOST))
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+#include <sys/select.h>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <thread>
+#endif
+
+namespace esphome {
+namespace socket {
+
+static const char *const TAG = "socket.wake";
+
+/** Background task that select()s on the watched sockets and wakes their components.
+ *
+ * Changes to the watch list are signalled through a UDP socket connected to itself on the loopback interface, so
+ * the task can sleep in select() without a timeout and still pick up new watches.
+ */
+class ReadableWatcher {
+ public:
+  bool start() {
+    if (this->ctrl_fd_ >= 0)
+      return true;
+    if (this->failed_)
+      return false;
+
+    int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+      this->fail_("socket", -1);
+      return false;
+    }
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (::bind(fd, (struct sockaddr *) &addr, len) != 0 || ::getsockname(fd, (struct sockaddr *) &addr, &len) != 0 ||
+        ::connect(fd, (struct sockaddr *) &addr, len) != 0) {
+      this->fail_("loopback", fd);
+      return false;
+    }
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    this->ctrl_fd_ = fd;
+
+#ifdef USE_ESP32
+    if (xTaskCreate([](void *arg) { static_cast<ReadableWatcher *>(arg)->run_(); }, "socket_wake", 2048, this, 1,
+                    nullptr) != pdPASS) {
+      this->ctrl_fd_ = -1;
+      this->fail_("task", fd);
+      return false;
+    }
+#else
+    std::thread([this]() { this->run_(); }).detach();
+#endif
+    return true;
+  }
+
+  void add(int fd, Component *component) {
+    {
+      LockGuard guard(this->lock_);
+      bool found = false;
+      for (auto &watch : this->watches_) {
+        if (watch.fd == fd) {
+          watch.component = component;
+          found = true;
+        }
+      }
+      if (!found)
+        this->watches_.push_back({fd, component});
+    }
+    this->notify_();
+  }
+
+  void remove(int fd) {
+    {
+      LockGuard guard(this->lock_);
+      for (auto it = this->watches_.begin(); it != this->watches_.end(); ++it) {
+        if (it->fd == fd) {
+          this->watches_.erase(it);
+          break;
+        }
+      }
+    }
+    this->notify_();
+  }
+
+ protected:
+  struct Watch {
+    int fd;
+    Component *component;
+  };
+
+  void fail_(const char *step, int fd) {
+    ESP_LOGW(TAG, "Setting up the socket watcher failed at %s: errno %d; components will keep polling", step, errno);
+    if (fd >= 0)
+      ::close(fd);
+    this->failed_ = true;
+  }
+
+  void notify_() {
+    uint8_t byte = 0;
+    ::send(this->ctrl_fd_, &byte, 1, 0);
+  }
+
+  void run_() {
+    while (true) {
+      fd_set read_fds;
+      FD_ZERO(&read_fds);
+      FD_SET(this->ctrl_fd_, &read_fds);
+      int max_fd = this->ctrl_fd_;
+      {
+        LockGuard guard(this->lock_);
+        for (auto &watch : this->watches_) {
+          FD_SET(watch.fd, &read_fds);
+          if (watch.fd > max_fd)
+            max_fd = watch.fd;
+        }
+      }
+
+      if (::select(max_fd + 1, &read_fds, nullptr, nullptr, nullptr) < 0) {
+        // A watched socket was closed before its watch was cancelled; wait for the owner to fix up the list
+        // instead of spinning on the error.
+        delay(10);  // NOLINT
+        continue;
+      }
+
+      if (FD_ISSET(this->ctrl_fd_, &read_fds)) {
+        uint8_t buf[16];
+        while (::recv(this->ctrl_fd_, buf, sizeof(buf), 0) > 0) {
+        }
+      }
+
+      LockGuard guard(this->lock_);
+      for (auto it = this->watches_.begin(); it != this->watches_.end();) {
+        if (FD_ISSET(it->fd, &read_fds)) {
+          it->component->enable_loop_soon_any_context();
+          it = this->watches_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+  }
+
+  Mutex lock_;
+  std::vector<Watch> watches_;
+  int ctrl_fd_{-1};
+  bool failed_{false};
+};
+
+static ReadableWatcher *global_watcher = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+bool wake_on_readable(Socket *sock, Component *component) {
+  int fd = sock->get_fd();
+  if (fd < 0)
+    return false;
+  if (global_watcher == nullptr)
+    global_watcher = new ReadableWatcher();  // NOLINT(cppcoreguidelines-owning-memory)
+  if (!global_watcher->start())
+    return false;
+  global_watcher->add(fd, component);
+  return true;
+}
+
+void cancel_wake_on_readable(Socket *sock) {
+  int fd = sock->get_fd();
+  if (fd < 0 || global_watcher == nullptr || !global_watcher->start())
+    return;
+  global_watcher->remove(fd);
+}
+
+}  // namespace socket
+}  // namespace esphome
+
+#else
+
+namespace esphome {
+namespace socket {
+
+bool wake_on_readable(Socket *sock, Component *component) { return false; }
+void cancel_wake_on_readable(Socket *sock) {}
+
+}  // namespace socket
+}  // namespace esphome
+
+#endif
@@ -64,6 +64,8 @@ class SpiLedStrip : public light::AddressableLight,
       }
       esph_log_v(TAG, "write_state: buf = %s", strbuf);
     }
+    // Counts the frame and switches the power supply, if one is configured, with the LEDs
+    this->mark_shown_();
     this->enable();
     this->write_array(this->buf_, this->buffer_size_);
     this->disable();
@@ -80,6 +82,16 @@ class SpiLedStrip : public light::AddressableLight,
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
             this->effect_data_ + index, &this->correction_};
   }
+  light::ESPPixelSpan get_pixel_span_() const override {
+    light::ESPPixelSpan span;
+    span.data = this->buf_ + 5;
+    span.stride = 4;
+    span.channels = 3;
+    span.offsets[0] = 2;
+    span.offsets[1] = 1;
+    span.offsets[2] = 0;
+    return span;
+  }
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
@@ -48,6 +48,8 @@ static const uint8_t SSD1351_STOPSCROLL = 0x9E;
 static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
 void SSD1351::setup() {
+  // Has to be ready before init_internal_() clears the buffer
+  this->dirty_.init(this->get_width_internal(), this->get_height_internal());
   this->init_internal_(this->get_buffer_length_());
 
   this->command(SSD1351_COMMANDLOCK);
@@ -86,18 +88,23 @@ void SSD1351::setup() {
   this->data(0xC8);
   set_brightness(this->brightness_);
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
+  this->dirty_.mark_all();   // ...all of it, not only what differs from the buffer
   this->display();           // ...write buffer, which actually clears the display's memory
   this->turn_on();           // display ON
 }
 void SSD1351::display() {
+  // Every command takes a few ms here, so all changes are sent in one window instead of a window per tile
+  display::Rect rect;
+  if (!this->dirty_.pop_bounds(&rect))
+    return;
   this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
+  this->data(rect.x);                // set column start address
+  this->data(rect.x2() - 1);         // set column end address
   this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
+  this->data(rect.y);                // set row start address
+  this->data(rect.y2() - 1);         // set last row
   this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  this->write_display_data(rect);
 }
 void SSD1351::update() {
   this->do_update_();
@@ -156,18 +163,16 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   // where should the bits go in the big buffer array? math...
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
+  if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+    return;
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
+  this->dirty_.mark(x, y);
 }
 void SSD1351::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
-    if (i & 1) {
-      this->buffer_[i] = color565 & 0xff;
-    } else {
-      this->buffer_[i] = (color565 >> 8) & 0xff;
-    }
-  }
+  const uint8_t pixel[SSD1351_BYTESPERPIXEL] = {(uint8_t) ((color565 >> 8) & 0xff), (uint8_t) (color565 & 0xff)};
+  this->fill_buffer_(pixel, SSD1351_BYTESPERPIXEL);
 }
 void SSD1351::init_reset_() {
   if (this->reset_pin_ != nullptr) {
@@ -36,7 +36,8 @@ class SSD1351 : public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Send the pixels of \p rect from the buffer, after the display was told to expect them.
+  virtual void write_display_data(const display::Rect &rect) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
@@ -53,7 +53,7 @@ void SPISSD1351::data(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1351::write_display_data() {
+void HOT SPISSD1351::write_display_data(const display::Rect &rect) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -61,7 +61,13 @@ void HOT SPISSD1351::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const int width = this->get_width_internal();
+  if (rect.w == width) {
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
+  } else {
+    for (int line = rect.y; line < rect.y2(); line++)
+      this->write_array(this->buffer_ + (line * width + rect.x) * 2, rect.w * 2);
+  }
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
@@ -287,8 +287,12 @@ void ST7735::setup() {
   if (this->invert_colors_)
     sendcommand_(ST77XX_INVON, nullptr, 0);
 
+  // Has to be ready before init_internal_() clears the buffer
+  this->dirty_.init(this->get_width_internal(), this->get_height_internal());
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  // The display memory still holds whatever it powered up with
+  this->dirty_.mark_all();
 }
 
 void ST7735::update() {
@@ -314,13 +318,18 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     const uint32_t color332 = display::ColorUtil::color_to_332(color);
     uint16_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     const uint32_t color565 = display::ColorUtil::color_to_565(color);
     uint16_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->dirty_.mark(x, y);
 }
 
 void ST7735::init_reset_() {
@@ -418,13 +427,20 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
+  display::Rect rect;
+  while (this->dirty_.pop_rect(&rect)) {
+    this->write_rect_(rect.x, rect.y, rect.w, rect.h);
+  }
+}
+
+void HOT ST7735::write_rect_(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  uint16_t x1 = offsetx + x;
+  uint16_t x2 = x1 + w - 1;
+  uint16_t y1 = offsety + y;
+  uint16_t y2 = y1 + h - 1;
 
   this->enable();
 
@@ -445,9 +461,10 @@ void HOT ST7735::write_display_data_() {
   this->write_byte(ST77XX_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const size_t width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (size_t line = y * width; line < (y + h) * width; line = line + width) {
+      for (size_t index = x; index < x + w; ++index) {
         auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
@@ -457,8 +474,11 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (w == width) {
+    this->write_array(this->buffer_ + y * width * 2, h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (size_t line = y; line < y + h; line++)
+      this->write_array(this->buffer_ + (line * width + x) * 2, w * 2);
   }
   this->disable();
 }
@@ -62,6 +62,8 @@ class ST7735 : public display::DisplayBuffer,
   void writedata_(uint8_t value);
 
   void write_display_data_();
+  /// Send the area of \p w by \p h pixels at \p x, \p y from the buffer to the display.
+  void write_rect_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
@@ -116,8 +116,12 @@ void ST7789V::setup() {
 
   backlight_(true);
 
+  // Has to be ready before init_internal_() clears the buffer
+  this->dirty_.init(this->get_width_internal(), this->get_height_internal());
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // The display was cleared above, so it matches the buffer
+  this->dirty_.clear();
 }
 
 void ST7789V::dump_config() {
@@ -149,10 +153,17 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  display::Rect rect;
+  while (this->dirty_.pop_rect(&rect)) {
+    this->write_rect_(rect.x, rect.y, rect.w, rect.h);
+  }
+}
+
+void ST7789V::write_rect_(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  uint16_t x1 = this->offset_height_ + x;
+  uint16_t x2 = x1 + w - 1;
+  uint16_t y1 = this->offset_width_ + y;
+  uint16_t y2 = y1 + h - 1;
 
   this->enable();
 
@@ -171,11 +182,12 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const size_t width = this->get_width_internal();
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (size_t line = y * width; line < (y + h) * width; line = line + width) {
+      for (size_t index = x; index < x + w; ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -189,8 +201,11 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (w == width) {
+    this->write_array(this->buffer_ + y * width * 2, h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (size_t line = y; line < y + h; line++)
+      this->write_array(this->buffer_ + (line * width + x) * 2, w * 2);
   }
 
   this->disable();
@@ -296,13 +311,18 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->dirty_.mark(x, y);
 }
 
 }  // namespace st7789v
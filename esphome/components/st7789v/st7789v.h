@@ -156,6 +156,8 @@ class ST7789V : public display::DisplayBuffer,
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
   void write_color_(uint16_t color, uint16_t size);
+  /// Send the area of \p w by \p h pixels at \p x, \p y from the buffer to the display.
+  void write_rect_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
   int get_height_internal() override { return this->height_; }
   int get_width_internal() override { return this->width_; }
@@ -57,7 +57,7 @@ void Switch::publish_state(bool state) {
 }
 bool Switch::assumed_state() { return false; }
 
-void Switch::add_on_state_callback(std::function<void(bool)> &&callback) {
+void Switch::add_on_state_callback(Callback<void(bool)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 void Switch::set_inverted(bool inverted) { this->inverted_ = inverted; }
@@ -86,7 +86,7 @@ class Switch : public EntityBase, public EntityBase_DeviceClass {
    *
    * @param callback The void(bool) callback.
    */
-  void add_on_state_callback(std::function<void(bool)> &&callback);
+  void add_on_state_callback(Callback<void(bool)> &&callback);
 
   /** Returns the initial state of the switch, as persisted previously,
     or empty if never persisted.
@@ -34,7 +34,7 @@ class Text : public EntityBase {
   /// Instantiate a TextCall object to modify this text component's state.
   TextCall make_call() { return TextCall(this); }
 
-  void add_on_state_callback(std::function<void(std::string)> &&callback);
+  void add_on_state_callback(Callback<void(std::string)> &&callback);
 
  protected:
   friend class TextCall;
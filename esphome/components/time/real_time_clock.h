@@ -37,7 +37,7 @@ class RealTimeClock : public PollingComponent {
 
   void call_setup() override;
 
-  void add_on_time_sync_callback(std::function<void()> callback) {
+  void add_on_time_sync_callback(Callback<void()> &&callback) {
     this->time_sync_callback_.add(std::move(callback));
   };
 
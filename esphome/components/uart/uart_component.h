@@ -150,7 +150,7 @@ class UARTComponent {
 #endif  // USE_ESP8266 || USE_ESP32
 
 #ifdef USE_UART_DEBUGGER
-  void add_debug_callback(std::function<void(UARTDirection, uint8_t)> &&callback) {
+  void add_debug_callback(Callback<void(UARTDirection, uint8_t)> &&callback) {
     this->debug_callback_.add(std::move(callback));
   }
 #endif
@@ -37,7 +37,7 @@ class UpdateEntity : public EntityBase, public EntityBase_DeviceClass {
   const UpdateInfo &update_info = update_info_;
   const UpdateState &state = state_;
 
-  void add_on_state_callback(std::function<void()> &&callback) { this->state_callback_.add(std::move(callback)); }
+  void add_on_state_callback(Callback<void()> &&callback) { this->state_callback_.add(std::move(callback)); }
 
  protected:
   UpdateState state_{UPDATE_STATE_UNKNOWN};
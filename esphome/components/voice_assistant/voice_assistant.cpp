@@ -313,7 +313,7 @@ void VoiceAssistant::loop() {
         size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
         if (this->audio_mode_ == AUDIO_MODE_API) {
           api::VoiceAssistantAudio msg;
-          msg.data.assign((char *) this->send_buffer_, read_bytes);
+          msg.data = StringRef(this->send_buffer_, read_bytes);
           this->api_client_->send_voice_assistant_audio(msg);
         } else {
           if (!this->udp_socket_running_) {
@@ -796,12 +796,12 @@ void VoiceAssistant::on_event(const api::VoiceAssistantEventResponse &msg) {
 
 void VoiceAssistant::on_audio(const api::VoiceAssistantAudio &msg) {
 #ifdef USE_SPEAKER  // We should never get to this function if there is no speaker anyway
-  if (this->speaker_buffer_index_ + msg.data.length() < SPEAKER_BUFFER_SIZE) {
-    memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data.data(), msg.data.length());
-    this->speaker_buffer_index_ += msg.data.length();
-    this->speaker_buffer_size_ += msg.data.length();
-    this->speaker_bytes_received_ += msg.data.length();
-    ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data.length());
+  if (this->speaker_buffer_index_ + msg.data.size() < SPEAKER_BUFFER_SIZE) {
+    memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data.c_str(), msg.data.size());
+    this->speaker_buffer_index_ += msg.data.size();
+    this->speaker_buffer_size_ += msg.data.size();
+    this->speaker_bytes_received_ += msg.data.size();
+    ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data.size());
   } else {
     ESP_LOGE(TAG, "Cannot receive audio, buffer is full");
   }
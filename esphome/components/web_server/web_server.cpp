@@ -139,7 +139,8 @@ void WebServer::setup() {
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr && this->expose_log_) {
     logger::global_logger->add_on_log_callback(
-        [this](int level, const char *tag, const char *message) { this->events_.send(message, "log", millis()); });
+        [this](int level, const char *tag, const char *message) { this->events_.send(message, "log", millis()); },
+        &this->log_level_);
   }
 #endif
   this->base_->add_handler(&this->events_);
@@ -166,6 +167,11 @@ void WebServer::loop() {
       fn();
     }
   }
+#endif
+#ifdef USE_LOGGER
+  // Only ask the logger to format messages for us while someone is listening on the event stream
+  if (this->expose_log_)
+    this->log_level_ = this->events_.count() > 0 ? ESPHOME_LOG_LEVEL : ESPHOME_LOG_LEVEL_NONE;
 #endif
   this->entities_iterator_.advance();
 }
@@ -6,6 +6,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/log.h"
 
 #include <map>
 #include <vector>
@@ -358,6 +359,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool include_internal_{false};
   bool allow_ota_{true};
   bool expose_log_{true};
+#ifdef USE_LOGGER
+  int log_level_{ESPHOME_LOG_LEVEL_NONE};
+#endif
 #ifdef USE_ESP32
   std::deque<std::function<void()>> to_schedule_;
   SemaphoreHandle_t to_schedule_lock_;
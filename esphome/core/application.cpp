@@ -11,6 +11,9 @@ namespace esphome {
 
 static const char *const TAG = "app";
 
+// Upper bound for sleeping while all components are idle, so the watchdog keeps being fed.
+static const uint32_t MAX_IDLE_SLEEP_MS = 1000;
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -36,7 +39,6 @@ void Application::setup() {
     Component *component = this->components_[i];
 
     component->call();
-    this->scheduler.process_to_add();
     this->feed_wdt();
     if (component->can_proceed())
       continue;
@@ -68,7 +70,15 @@ void Application::loop() {
 
   this->scheduler.call();
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+  if (this->has_pending_enable_loop_requests_)
+    this->process_pending_enable_loop_requests_();
+
+  // Components may disable or enable their loop while we iterate, which moves them around in looping_components_.
+  // Always index through current_loop_index_ so that those moves can keep it pointing at the right component.
+  this->in_loop_ = true;
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
+       this->current_loop_index_++) {
+    Component *component = this->looping_components_[this->current_loop_index_];
     {
       WarnIfComponentBlockingGuard guard{component};
       component->call();
@@ -77,21 +87,34 @@ void Application::loop() {
     this->app_state_ |= new_app_state;
     this->feed_wdt();
   }
+  this->in_loop_ = false;
   this->app_state_ = new_app_state;
 
   const uint32_t now = millis();
 
   auto elapsed = now - this->last_loop_;
-  if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
+  if (HighFrequencyLoopRequester::is_high_frequency()) {
+    yield();
+  } else if (this->looping_components_active_end_ == 0 && !this->has_pending_enable_loop_requests_ &&
+             this->dump_config_at_ >= this->components_.size()) {
+    // Nothing to poll: sleep until the next timeout/interval is due, or until something wakes us up. Anything
+    // scheduled from another task from here on wakes the loop, see Scheduler.
+    this->loop_sleeping_ = true;
+    uint32_t sleep_time = this->scheduler.next_schedule_in().value_or(MAX_IDLE_SLEEP_MS);
+    arch_sleep_loop(std::min(sleep_time, MAX_IDLE_SLEEP_MS));
+    this->loop_sleeping_ = false;
+  } else if (elapsed >= this->loop_interval_) {
     yield();
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
+    this->loop_sleeping_ = true;
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
     // next_schedule is max 0.5*delay_time
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    arch_sleep_loop(delay_time);
+    this->loop_sleeping_ = false;
   }
   this->last_loop_ = now;
 
@@ -103,7 +126,14 @@ void Application::loop() {
 #endif
     }
 
+#ifdef USE_COMPONENT_TIMING
+    Component *component = this->components_[this->dump_config_at_];
+    uint32_t started = micros();
+    component->call_dump_config();
+    component->get_timing_stats()[TIMING_DUMP_CONFIG].record(micros() - started);
+#else
     this->components_[this->dump_config_at_]->call_dump_config();
+#endif
     this->dump_config_at_++;
   }
 }
@@ -144,12 +174,59 @@ void Application::run_safe_shutdown_hooks() {
 }
 
 void Application::calculate_looping_components_() {
+  // Components that already disabled their loop, e.g. in setup(), go after the enabled ones.
+  for (auto *obj : this->components_) {
+    if (obj->has_overridden_loop() && obj->is_loop_enabled())
+      this->looping_components_.push_back(obj);
+  }
+  this->looping_components_active_end_ = this->looping_components_.size();
   for (auto *obj : this->components_) {
-    if (obj->has_overridden_loop())
+    if (obj->has_overridden_loop() && !obj->is_loop_enabled())
       this->looping_components_.push_back(obj);
   }
 }
 
+void Application::disable_component_loop_(Component *component) {
+  for (uint16_t i = 0; i < this->looping_components_active_end_; i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    // Move it to the end of the enabled ones, keeping the order of the others, then shrink the enabled range.
+    std::rotate(this->looping_components_.begin() + i, this->looping_components_.begin() + i + 1,
+                this->looping_components_.begin() + this->looping_components_active_end_);
+    this->looping_components_active_end_--;
+    // Everything from i on moved one slot to the front: step back so the next iteration doesn't skip a component.
+    if (this->in_loop_ && i <= this->current_loop_index_)
+      this->current_loop_index_--;
+    return;
+  }
+}
+
+void Application::enable_component_loop_(Component *component) {
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    // Append it to the enabled ones. When called during loop(), it is run later in the same iteration.
+    std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
+    this->looping_components_active_end_++;
+    return;
+  }
+}
+
+void Application::process_pending_enable_loop_requests_() {
+  // Clear first, so that a request arriving while we scan is handled on the next iteration.
+  this->has_pending_enable_loop_requests_ = false;
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
+    if (!component->pending_enable_loop_)
+      continue;
+    component->pending_enable_loop_ = false;
+    component->loop_disabled_ = false;
+    // Slot i gets the component from the first disabled slot, which was already checked.
+    std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
+    this->looping_components_active_end_++;
+  }
+}
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
@@ -231,6 +231,15 @@ class Application {
 
   uint32_t get_loop_interval() const { return this->loop_interval_; }
 
+  /** Wake the main loop if it is sleeping, e.g. because new work arrived from another task or an interrupt.
+   *
+   * Safe to call from other tasks and from interrupts.
+   */
+  void wake_loop() { arch_wake_loop(); }
+
+  /// Whether the main loop is about to sleep or sleeping, i.e. new work must call wake_loop() to be noticed in time.
+  bool is_loop_sleeping() const { return this->loop_sleeping_; }
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt();
@@ -243,6 +252,8 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
@@ -446,11 +457,20 @@ class Application {
   void register_component_(Component *comp);
 
   void calculate_looping_components_();
+  void disable_component_loop_(Component *component);
+  void enable_component_loop_(Component *component);
+  void process_pending_enable_loop_requests_();
 
   void feed_wdt_arch_();
 
   std::vector<Component *> components_{};
+  /// Components that override loop(), the ones in [0, looping_components_active_end_) have their loop enabled.
   std::vector<Component *> looping_components_{};
+  uint16_t looping_components_active_end_{0};
+  /// Index in looping_components_ of the component whose loop() is currently being called.
+  uint16_t current_loop_index_{0};
+  bool in_loop_{false};
+  volatile bool has_pending_enable_loop_requests_{false};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
@@ -525,6 +545,7 @@ class Application {
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
+  volatile bool loop_sleeping_{false};
   uint32_t app_state_{0};
 };
 
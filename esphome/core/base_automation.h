@@ -157,7 +157,7 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   void play_complex(Ts... x) override {
     auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
-    this->set_timeout(this->delay_.value(x...), f);
+    this->set_timeout(this->delay_.value(x...), std::move(f));
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
@@ -324,15 +324,19 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
 
     if (this->timeout_value_.has_value()) {
       auto f = std::bind(&WaitUntilAction<Ts...>::play_next_, this, x...);
-      this->set_timeout("timeout", this->timeout_value_.value(x...), f);
+      this->set_timeout("timeout", this->timeout_value_.value(x...), std::move(f));
     }
 
+    this->enable_loop();
     this->loop();
   }
 
   void loop() override {
-    if (this->num_running_ == 0)
+    if (this->num_running_ == 0) {
+      // Nothing to wait for until play_complex() is called again
+      this->disable_loop();
       return;
+    }
 
     if (!this->condition_->check_tuple(this->var_)) {
       return;
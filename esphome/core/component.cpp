@@ -49,7 +49,11 @@ void Component::setup() {}
 
 void Component::loop() {}
 
-void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+void Component::set_interval(const std::string &name, uint32_t interval, SchedulerCallback &&f) {  // NOLINT
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+
+void Component::set_interval(const char *name, uint32_t interval, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_interval(this, name, interval, std::move(f));
 }
 
@@ -57,6 +61,10 @@ bool Component::cancel_interval(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_interval(this, name);
 }
 
+bool Component::cancel_interval(const char *name) {  // NOLINT
+  return App.scheduler.cancel_interval(this, name);
+}
+
 void Component::set_retry(const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                           std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor) {  // NOLINT
   App.scheduler.set_retry(this, name, initial_wait_time, max_attempts, std::move(f), backoff_increase_factor);
@@ -66,7 +74,11 @@ bool Component::cancel_retry(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_retry(this, name);
 }
 
-void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+void Component::set_timeout(const std::string &name, uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
+  return App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
+void Component::set_timeout(const char *name, uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
   return App.scheduler.set_timeout(this, name, timeout, std::move(f));
 }
 
@@ -74,6 +86,10 @@ bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+bool Component::cancel_timeout(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+
 void Component::call_loop() { this->loop(); }
 void Component::call_setup() { this->setup(); }
 void Component::call_dump_config() {
@@ -91,7 +107,16 @@ void Component::call() {
       // State Construction: Call setup and set state to setup
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_SETUP;
+#ifdef USE_COMPONENT_TIMING
+      {
+        // Not using WarnIfComponentBlockingGuard, setup() is allowed to block for longer.
+        uint32_t started = micros();
+        this->call_setup();
+        this->timing_stats_[TIMING_SETUP].record(micros() - started);
+      }
+#else
       this->call_setup();
+#endif
       break;
     case COMPONENT_STATE_SETUP:
       // State setup: Call first loop and set state to loop
@@ -121,19 +146,25 @@ void Component::mark_failed() {
   this->component_state_ |= COMPONENT_STATE_FAILED;
   this->status_set_error();
 }
-void Component::defer(std::function<void()> &&f) {  // NOLINT
+void Component::defer(SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", 0, std::move(f));
 }
 bool Component::cancel_defer(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
-void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
+bool Component::cancel_defer(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+void Component::defer(const std::string &name, SchedulerCallback &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+}
+void Component::defer(const char *name, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
-void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+void Component::set_timeout(uint32_t timeout, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", timeout, std::move(f));
 }
-void Component::set_interval(uint32_t interval, std::function<void()> &&f) {  // NOLINT
+void Component::set_interval(uint32_t interval, SchedulerCallback &&f) {  // NOLINT
   App.scheduler.set_interval(this, "", interval, std::move(f));
 }
 void Component::set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std::function<RetryResult(uint8_t)> &&f,
@@ -205,6 +236,27 @@ bool Component::has_overridden_loop() const {
   return loop_overridden || call_loop_overridden;
 }
 
+void Component::disable_loop() {
+  if (this->loop_disabled_)
+    return;
+  this->loop_disabled_ = true;
+  this->pending_enable_loop_ = false;
+  App.disable_component_loop_(this);
+}
+void Component::enable_loop() {
+  if (!this->loop_disabled_)
+    return;
+  this->loop_disabled_ = false;
+  App.enable_component_loop_(this);
+}
+void IRAM_ATTR HOT Component::enable_loop_soon_any_context() {
+  if (!this->loop_disabled_)
+    return;
+  this->pending_enable_loop_ = true;
+  App.has_pending_enable_loop_requests_ = true;
+  App.wake_loop();
+}
+
 PollingComponent::PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
 
 void PollingComponent::call_setup() {
@@ -228,9 +280,20 @@ void PollingComponent::stop_poller() {
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+#ifdef USE_COMPONENT_TIMING
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
+    : WarnIfComponentBlockingGuard(component, TIMING_LOOP) {}
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, TimingCategory category)
+    : started_(millis()), component_(component), started_us_(micros()), category_(category) {}
+#else
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
     : started_(millis()), component_(component) {}
+#endif
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
+#ifdef USE_COMPONENT_TIMING
+  if (this->component_ != nullptr)
+    this->component_->get_timing_stats()[this->category_].record(micros() - this->started_us_);
+#endif
   uint32_t now = millis();
   if (now - started_ > 50) {
     const char *src = component_ == nullptr ? "<null>" : component_->get_component_source();
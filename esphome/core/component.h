@@ -5,7 +5,10 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/optional.h"
+#include "esphome/core/timing_stats.h"
 
 namespace esphome {
 
@@ -65,6 +68,9 @@ extern const uint32_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+/// Callback type of timeouts and intervals, stores small lambdas without allocating.
+using SchedulerCallback = SmallFunction<void()>;
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -142,6 +148,30 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() of this component, until enable_loop() is called.
+   *
+   * Meant for components that only need loop() while something is going on. Disabled components are moved out of
+   * the list of looping components, so they cost nothing per main loop iteration. Once the loop of every component
+   * is disabled, the main loop blocks until the next timeout/interval is due or a loop is enabled again. Components
+   * waiting on a socket can use socket::wake_on_readable() to get their loop back (api does so while no client is
+   * connected, on ESP32 and host). Components that poll other inputs without a wake up, like wifi, never disable
+   * their loop, so with those the main loop still runs every loop interval.
+   *
+   * Must be called from the main loop, it is safe to call from within loop() itself.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() after disable_loop(). Must be called from the main loop.
+  void enable_loop();
+
+  /** Resume calling loop() after disable_loop(), from any context.
+   *
+   * Safe to call from other tasks and from interrupts. loop() is resumed from the next main loop iteration on.
+   */
+  void enable_loop_soon_any_context();
+
+  bool is_loop_enabled() const { return !this->loop_disabled_; }
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -153,6 +183,11 @@ class Component {
    */
   const char *get_component_source() const;
 
+#ifdef USE_COMPONENT_TIMING
+  /// Execution time statistics of setup(), loop(), scheduler callbacks and dump_config() of this component.
+  ComponentTimingStats &get_timing_stats() { return this->timing_stats_; }
+#endif
+
  protected:
   friend class Application;
 
@@ -175,9 +210,12 @@ class Component {
    *
    * @see cancel_interval()
    */
-  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(const std::string &name, uint32_t interval, SchedulerCallback &&f);  // NOLINT
+
+  /// Same as above, but \p name must have static storage duration (e.g. a string literal) and is not copied.
+  void set_interval(const char *name, uint32_t interval, SchedulerCallback &&f);  // NOLINT
 
-  void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(uint32_t interval, SchedulerCallback &&f);  // NOLINT
 
   /** Cancel an interval function.
    *
@@ -185,6 +223,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   /** Set an retry function with a unique name. Empty name means no cancelling possible.
    *
@@ -243,9 +282,12 @@ class Component {
    *
    * @see cancel_timeout()
    */
-  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(const std::string &name, uint32_t timeout, SchedulerCallback &&f);  // NOLINT
 
-  void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  /// Same as above, but \p name must have static storage duration (e.g. a string literal) and is not copied.
+  void set_timeout(const char *name, uint32_t timeout, SchedulerCallback &&f);  // NOLINT
+
+  void set_timeout(uint32_t timeout, SchedulerCallback &&f);  // NOLINT
 
   /** Cancel a timeout function.
    *
@@ -253,6 +295,7 @@ class Component {
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -261,17 +304,27 @@ class Component {
    * @param name The name of the defer function.
    * @param f The callback.
    */
-  void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const std::string &name, SchedulerCallback &&f);  // NOLINT
+
+  /// Same as above, but \p name must have static storage duration (e.g. a string literal) and is not copied.
+  void defer(const char *name, SchedulerCallback &&f);  // NOLINT
 
   /// Defer a callback to the next loop() call.
-  void defer(std::function<void()> &&f);  // NOLINT
+  void defer(SchedulerCallback &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
+  bool loop_disabled_{false};
+  /// Set by enable_loop_soon_any_context(), handled by Application::loop().
+  volatile bool pending_enable_loop_{false};
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_COMPONENT_TIMING
+  ComponentTimingStats timing_stats_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -319,14 +372,26 @@ class PollingComponent : public Component {
   uint32_t update_interval_;
 };
 
+/** Warns when a component blocks the main loop for too long.
+ *
+ * With USE_COMPONENT_TIMING, also records the time spent in the guarded block into the timing statistics of the
+ * component, under the given category.
+ */
 class WarnIfComponentBlockingGuard {
  public:
   WarnIfComponentBlockingGuard(Component *component);
+#ifdef USE_COMPONENT_TIMING
+  WarnIfComponentBlockingGuard(Component *component, TimingCategory category);
+#endif
   ~WarnIfComponentBlockingGuard();
 
  protected:
   uint32_t started_;
   Component *component_;
+#ifdef USE_COMPONENT_TIMING
+  uint32_t started_us_;
+  TimingCategory category_;
+#endif
 };
 
 }  // namespace esphome
@@ -20,6 +20,8 @@ class ComponentIterator {
  public:
   void begin(bool include_internal = false);
   void advance();
+  /// Whether all entities have been iterated over, or iteration was never started.
+  bool completed() const { return this->state_ == IteratorState::NONE; }
   virtual bool on_begin();
 #ifdef USE_BINARY_SENSOR
   virtual bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) = 0;
@@ -60,6 +60,10 @@ ProjectUpdateTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_SCHEDULER_POOL_SIZE = "scheduler_pool_size"
+
+# Upper bound for the automatic scheduler pool size, larger configs fall back to the heap
+SCHEDULER_POOL_SIZE_AUTO_MAX = 64
 
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
@@ -170,11 +174,26 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_COMPILE_PROCESS_LIMIT, default=_compile_process_limit_default
             ): cv.int_range(min=1, max=multiprocessing.cpu_count()),
+            cv.Optional(CONF_SCHEDULER_POOL_SIZE): cv.int_range(min=1, max=1024),
         }
     ),
     validate_hostname,
 )
 
+
+def _final_validate(config):
+    if CONF_SCHEDULER_POOL_SIZE not in config:
+        # All components are known once the IDs have been resolved. Size the static scheduler
+        # item pool so that every component can keep a couple of timeouts/intervals scheduled
+        # without falling back to the heap, but don't reserve more RAM than that for large configs.
+        config[CONF_SCHEDULER_POOL_SIZE] = min(
+            max(16, 2 * len(CORE.component_ids)), SCHEDULER_POOL_SIZE_AUTO_MAX
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 PRELOAD_CONFIG_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_NAME): cv.valid_name,
@@ -363,6 +382,8 @@ async def to_code(config):
 
     CORE.add_job(_add_automations, config)
 
+    cg.add_define("ESPHOME_SCHEDULER_POOL_SIZE", config[CONF_SCHEDULER_POOL_SIZE])
+
     cg.add_build_flag("-fno-exceptions")
 
     # Libraries
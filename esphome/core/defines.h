@@ -14,6 +14,9 @@
 #define ESPHOME_PROJECT_VERSION_30 "v2"
 #define ESPHOME_VARIANT "ESP32"
 
+// Sizing
+#define ESPHOME_SCHEDULER_POOL_SIZE 16  // NOLINT
+
 // Feature flags
 #define USE_ALARM_CONTROL_PANEL
 #define USE_API
@@ -22,6 +25,7 @@
 #define USE_BINARY_SENSOR
 #define USE_BUTTON
 #define USE_CLIMATE
+#define USE_COMPONENT_TIMING
 #define USE_COVER
 #define USE_DATETIME
 #define USE_DATETIME_DATE
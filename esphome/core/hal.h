@@ -41,6 +41,15 @@ void delayMicroseconds(uint32_t us);  // NOLINT(readability-identifier-naming)
 void __attribute__((noreturn)) arch_restart();
 void arch_init();
 void arch_feed_wdt();
+/** Block the loop task for at most \p ms milliseconds, returning early once arch_wake_loop() is called.
+ *
+ * The loop task really blocks on ESP32, ESP8266 and host. LibreTiny and RP2040 check for the wake up every
+ * millisecond instead.
+ */
+void arch_sleep_loop(uint32_t ms);
+/// Wake the loop task from arch_sleep_loop(), or make the next call return immediately. Safe to call from other
+/// tasks and interrupts.
+void arch_wake_loop();
 uint32_t arch_get_cpu_cycle_count();
 uint32_t arch_get_cpu_freq_hz();
 uint8_t progmem_read_byte(const uint8_t *addr);
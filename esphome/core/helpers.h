@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -165,6 +167,8 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t p
 
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of the null-terminated string \p str.
+uint32_t fnv1_hash(const char *str);
 
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
@@ -471,29 +475,148 @@ constexpr float fahrenheit_to_celsius(float value) { return (value - 32.0f) / 1.
 /// @name Utilities
 /// @{
 
+template<typename F, size_t N = 4 * sizeof(void *)> class SmallFunction;
+
+/** Move-only replacement for std::function with inline storage for small callables.
+ *
+ * Callables of up to \p N bytes (e.g. a lambda capturing `this` and a few values, or an std::function) are stored
+ * inside the object itself, so constructing and moving them doesn't allocate. Larger callables fall back to the heap.
+ *
+ * @tparam R The return type of the callable.
+ * @tparam Args The argument types of the callable.
+ * @tparam N The size of the inline storage in bytes.
+ */
+template<typename R, typename... Args, size_t N> class SmallFunction<R(Args...), N> {
+ public:
+  SmallFunction() = default;
+  SmallFunction(std::nullptr_t) {}  // NOLINT(google-explicit-constructor)
+  template<typename F, typename D = typename std::decay<F>::type,
+           enable_if_t<!std::is_same<D, SmallFunction>::value, int> = 0>
+  SmallFunction(F &&f) {  // NOLINT(google-explicit-constructor)
+    this->emplace_<D>(std::forward<F>(f));
+  }
+  SmallFunction(SmallFunction &&other) noexcept { this->move_from_(other); }
+  SmallFunction &operator=(SmallFunction &&other) noexcept {
+    if (this != &other) {
+      this->reset();
+      this->move_from_(other);
+    }
+    return *this;
+  }
+  SmallFunction(const SmallFunction &) = delete;
+  SmallFunction &operator=(const SmallFunction &) = delete;
+  ~SmallFunction() { this->reset(); }
+
+  /// Destroy the stored callable, if any.
+  void reset() {
+    if (this->manager_ != nullptr)
+      this->manager_(Op::DESTROY, this->storage_, nullptr);
+    this->manager_ = nullptr;
+    this->invoker_ = nullptr;
+  }
+
+  explicit operator bool() const { return this->invoker_ != nullptr; }
+
+  R operator()(Args... args) const { return this->invoker_(this->storage_, std::forward<Args>(args)...); }
+
+  /// Whether a callable of type \p F is stored inline, without allocating.
+  template<typename F> static constexpr bool fits_inline() {
+    return sizeof(F) <= N && ALIGN % alignof(F) == 0 && std::is_nothrow_move_constructible<F>::value;
+  }
+
+ protected:
+  /// Small storage is only pointer-aligned, so it isn't padded up to the size of std::max_align_t.
+  static constexpr size_t ALIGN = N % alignof(std::max_align_t) == 0 ? alignof(std::max_align_t) : alignof(void *);
+
+  enum class Op { MOVE, DESTROY };
+  using Invoker = R (*)(void *, Args &&...);
+  using Manager = void (*)(Op, void *, void *);
+
+  template<typename F, typename A, enable_if_t<fits_inline<F>(), int> = 0> void emplace_(A &&f) {
+    new (this->storage_) F(std::forward<A>(f));
+    this->invoker_ = [](void *storage, Args &&...args) -> R {
+      return (*static_cast<F *>(storage))(std::forward<Args>(args)...);
+    };
+    this->manager_ = [](Op op, void *dst, void *src) {
+      if (op == Op::MOVE) {
+        new (dst) F(std::move(*static_cast<F *>(src)));
+        static_cast<F *>(src)->~F();
+      } else {
+        static_cast<F *>(dst)->~F();
+      }
+    };
+  }
+  template<typename F, typename A, enable_if_t<!fits_inline<F>(), int> = 0> void emplace_(A &&f) {
+    *reinterpret_cast<F **>(this->storage_) = new F(std::forward<A>(f));  // NOLINT(cppcoreguidelines-owning-memory)
+    this->invoker_ = [](void *storage, Args &&...args) -> R {
+      return (**static_cast<F **>(storage))(std::forward<Args>(args)...);
+    };
+    this->manager_ = [](Op op, void *dst, void *src) {
+      if (op == Op::MOVE) {
+        *static_cast<F **>(dst) = *static_cast<F **>(src);
+      } else {
+        delete *static_cast<F **>(dst);  // NOLINT(cppcoreguidelines-owning-memory)
+      }
+    };
+  }
+  void move_from_(SmallFunction &other) {
+    if (other.manager_ != nullptr)
+      other.manager_(Op::MOVE, this->storage_, other.storage_);
+    this->invoker_ = other.invoker_;
+    this->manager_ = other.manager_;
+    other.invoker_ = nullptr;
+    other.manager_ = nullptr;
+  }
+
+  alignas(ALIGN) mutable uint8_t storage_[N < sizeof(void *) ? sizeof(void *) : N];
+  Invoker invoker_{nullptr};
+  Manager manager_{nullptr};
+};
+
 template<typename... X> class CallbackManager;
 
+/// A callback stored in a CallbackManager, which holds callables of up to two pointers (e.g. a lambda capturing
+/// `this` and an entity) without allocating. Take this instead of std::function when registering a callback, so
+/// lambdas aren't wrapped in an std::function first.
+template<typename F> using Callback = SmallFunction<F, 2 * sizeof(void *)>;
+
 /** Helper class to allow having multiple subscribers to a callback.
+ *
+ * Callbacks are kept in an array that doubles in size when full, so adding N callbacks only reallocates log2(N)
+ * times. An empty manager is just a null pointer and two counts.
  *
  * @tparam Ts The arguments for the callbacks, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
   /// Add a callback to the list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void add(Callback<void(Ts...)> &&callback) {
+    if (this->size_ == this->capacity_) {
+      uint16_t capacity = this->capacity_ == 0 ? 1 : this->capacity_ * 2;
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      std::unique_ptr<Callback<void(Ts...)>[]> callbacks(new Callback<void(Ts...)>[capacity]);
+      for (uint16_t i = 0; i < this->size_; i++)
+        callbacks[i] = std::move(this->callbacks_[i]);
+      this->callbacks_ = std::move(callbacks);
+      this->capacity_ = capacity;
+    }
+    this->callbacks_[this->size_++] = std::move(callback);
+  }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
-    for (auto &cb : this->callbacks_)
-      cb(args...);
+    for (uint16_t i = 0; i < this->size_; i++)
+      this->callbacks_[i](args...);
   }
-  size_t size() const { return this->callbacks_.size(); }
+  size_t size() const { return this->size_; }
 
   /// Call all callbacks in this manager.
   void operator()(Ts... args) { call(args...); }
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  std::unique_ptr<Callback<void(Ts...)>[]> callbacks_;
+  uint16_t size_{0};
+  uint16_t capacity_{0};
 };
 
 /// Helper class to deduplicate items in a series of values.
@@ -8,6 +8,8 @@
 
 namespace esphome {
 
+uint8_t global_log_level = ESPHOME_LOG_LEVEL;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 void HOT esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {  // NOLINT
   va_list arg;
   va_start(arg, format);
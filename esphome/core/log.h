@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cstdarg>
+#include <cstdint>
 #include <string>
 
 #ifdef USE_STORE_LOG_STR_IN_FLASH
@@ -66,6 +67,15 @@ void esp_log_vprintf_(int level, const char *tag, int line, const __FlashStringH
 int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
+/** Most verbose level any tag currently logs at, maintained by the logger.
+ *
+ * Checked by the logging macros before anything else, so that messages which are compiled in but disabled at runtime
+ * cost a single comparison, without evaluating their arguments.
+ */
+extern uint8_t global_log_level;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+#define ESPHOME_LOG_ENABLED(level) ((level) <= ::esphome::global_log_level)
+
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 #define ESPHOME_LOG_FORMAT(format) F(format)
 #else
@@ -74,7 +84,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERY_VERBOSE
 #define esph_log_vv(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_VERY_VERBOSE) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_VERY_VERBOSE
 #else
@@ -83,7 +95,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
 #define esph_log_v(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_VERBOSE) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_VERBOSE
 #else
@@ -92,9 +106,13 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
 #define esph_log_d(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_DEBUG) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 #define esph_log_config(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_CONFIG) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_DEBUG
 #define ESPHOME_LOG_HAS_CONFIG
@@ -105,7 +123,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO
 #define esph_log_i(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_INFO) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_INFO
 #else
@@ -114,7 +134,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_WARN
 #define esph_log_w(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_WARN) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_WARN
 #else
@@ -123,7 +145,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR
 #define esph_log_e(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  (ESPHOME_LOG_ENABLED(ESPHOME_LOG_LEVEL_ERROR) \
+       ? esp_log_printf_(ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__) \
+       : (void) 0)
 
 #define ESPHOME_LOG_HAS_ERROR
 #else
@@ -1,4 +1,5 @@
 #include "scheduler.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
@@ -9,74 +10,88 @@ namespace esphome {
 
 static const char *const TAG = "scheduler";
 
-static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
-
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
-// A note on locking: the `lock_` lock protects the `items_` and `to_add_` containers. It must be taken when writing to
-// them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
-// iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
-// avoid the main thread modifying the list while it is being accessed.
+// A note on locking: the `lock_` lock protects the wheel, the ready/running queues and the name index. It must be
+// taken whenever items are linked into or out of them. The only item that is ever touched without holding the lock
+// is the one whose callback is currently executing (location CURRENT); cancelling it only sets its `remove` flag and
+// it is then released by the loop task once the callback returns.
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
-                                std::function<void()> func) {
-  const uint32_t now = this->millis_();
-
-  if (!name.empty())
-    this->cancel_timeout(component, name);
-
-  if (timeout == SCHEDULER_DONT_RUN)
-    return;
-
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
-
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
-  item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+                                SchedulerCallback func) {
+  this->set_item_(component, name.c_str(), false, SchedulerItem::TIMEOUT, timeout, std::move(func));
+}
+void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout, SchedulerCallback func) {
+  this->set_item_(component, name, true, SchedulerItem::TIMEOUT, timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_item_(component, name.c_str(), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
   return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> func) {
-  const uint32_t now = this->millis_();
+                                 SchedulerCallback func) {
+  this->set_item_(component, name.c_str(), false, SchedulerItem::INTERVAL, interval, std::move(func));
+}
+void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval, SchedulerCallback func) {
+  this->set_item_(component, name, true, SchedulerItem::INTERVAL, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, name.c_str(), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, const char *name) {
+  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+}
+void HOT Scheduler::set_item_(Component *component, const char *name, bool static_name, SchedulerItem::Type type,
+                              uint32_t delay, SchedulerCallback &&func) {
+  const uint64_t now = this->millis_();
+  const bool named = name != nullptr && name[0] != '\0';
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (named)
+    this->cancel_item_(component, name, type);
 
-  if (interval == SCHEDULER_DONT_RUN)
+  if (delay == SCHEDULER_DONT_RUN)
     return;
 
-  // only put offset in lower half
-  uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
-
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
+  uint64_t next_execution = now + delay;
+  if (type == SchedulerItem::INTERVAL) {
+    // only put offset in lower half
+    uint32_t offset = 0;
+    if (delay != 0)
+      offset = (random_uint32() % delay) / 2;
+    ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", named ? name : "", delay,
+              offset);
+    // First execution is immediate, the offset only shifts the phase of the following ones.
+    next_execution = now > offset ? now - offset : 0;
+  } else {
+    ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", named ? name : "", delay);
+  }
 
-  auto item = make_unique<SchedulerItem>();
+  LockGuard guard{this->lock_};
+  SchedulerItem *item = this->alloc_item_();
   item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
-  item->interval = interval;
-  item->last_execution = now - offset - interval;
-  item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
+  if (!named) {
+    item->name = nullptr;
+  } else if (static_name) {
+    item->name = name;
+  } else {
+    // Reuses the capacity of the pooled string, so this only allocates the first time an item sees a long name
+    item->name_storage.assign(name);
+    item->name = item->name_storage.c_str();
+  }
+  item->type = type;
+  item->interval = delay;
+  item->next_execution = next_execution;
   item->callback = std::move(func);
   item->remove = false;
-  this->push_(std::move(item));
-}
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+  this->index_(item);
+  this->wheel_insert_(item);
+
+  // Added from another task while the loop goes to sleep, it may need to run earlier than the loop planned to wake
+  if (App.is_loop_sleeping())
+    App.wake_loop();
 }
 
 struct RetryArgs {
@@ -135,230 +150,323 @@ bool HOT Scheduler::cancel_retry(Component *component, const std::string &name)
 }
 
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
-  if (this->empty_())
+  const uint64_t now = this->millis_();
+  LockGuard guard{this->lock_};
+  if (!this->ready_.empty())
+    return 0;
+  // The next tick is either a slot of the lowest level or a cascade point, so this may be slightly early but never
+  // late.
+  const uint64_t next_tick = this->wheel_next_tick_();
+  if (next_tick == UINT64_MAX)
     return {};
-  auto &item = this->items_[0];
-  const uint32_t now = this->millis_();
-  uint32_t next_time = item->last_execution + item->interval;
-  if (next_time < now)
+  if (next_tick <= now)
     return 0;
-  return next_time - now;
+  return static_cast<uint32_t>(std::min<uint64_t>(next_tick - now, UINT32_MAX));
 }
 void HOT Scheduler::call() {
-  const uint32_t now = this->millis_();
-  this->process_to_add();
+  const uint64_t now = this->millis_();
+
+  {
+    LockGuard guard{this->lock_};
+    this->wheel_advance_(now);
+    // Only run what is due right now, items that become ready during the callbacks wait for the next call.
+    this->running_ = this->ready_;
+    this->ready_ = ItemList{};
+    for (auto *item = this->running_.head; item != nullptr; item = item->next)
+      item->location = SchedulerItem::RUNNING;
+  }
 
 #ifdef ESPHOME_DEBUG_SCHEDULER
-  static uint32_t last_print = 0;
+  static uint64_t last_print = 0;
 
   if (now - last_print > 2000) {
     last_print = now;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%" PRIu32, this->items_.size(), now);
-    while (!this->empty_()) {
-      this->lock_.lock();
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      this->lock_.unlock();
-
-      ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " last_execution=%" PRIu32 " (%u) next=%" PRIu32 " (%u)",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution,
-                item->last_execution_major, item->next_execution(), item->next_execution_major());
-
-      old_items.push_back(std::move(item));
+    LockGuard guard{this->lock_};
+    ESP_LOGVV(TAG, "Items: count=%zu, wheel_time=%" PRIu64 ", now=%" PRIu64, this->items_in_use_, this->wheel_time_,
+              now);
+    for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+      for (uint8_t slot = 0; slot < WHEEL_SIZE; slot++) {
+        for (auto *item = this->wheel_[level][slot].head; item != nullptr; item = item->next) {
+          ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " next=%" PRIu64 " (level %u slot %u)", item->get_type_str(),
+                    item->has_name() ? item->name : "", item->interval, item->next_execution, level, slot);
+        }
+      }
     }
     ESP_LOGVV(TAG, "\n");
-
-    {
-      LockGuard guard{this->lock_};
-      this->items_ = std::move(old_items);
-    }
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = this->items_.size();
-  // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      LockGuard guard{this->lock_};
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-
+  while (true) {
+    SchedulerItem *item;
     {
       LockGuard guard{this->lock_};
-      this->items_ = std::move(valid_items);
+      item = this->running_.pop_front();
+      if (item == nullptr)
+        break;
+      item->location = SchedulerItem::CURRENT;
     }
 
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %" PRIu32 " now: %" PRIu32 " items where %zu now %zu. Please report this",
-               to_remove_was, to_remove_, items_was, items_.size());
-      to_remove_ = 0;
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      LockGuard guard{this->lock_};
+      this->unindex_(item);
+      this->free_item_(item);
+      continue;
     }
-  }
-
-  while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
-    {
-      // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval) {
-        // Not reached timeout yet, done for this call
-        break;
-      }
-      uint8_t major = item->next_execution_major();
-      if (this->millis_major_ - major > 1)
-        break;
-
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        LockGuard guard{this->lock_};
-        this->pop_raw_();
-        continue;
-      }
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " last_execution=%" PRIu32 " (now=%" PRIu32 ")",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
+    ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " next_execution=%" PRIu64 " (now=%" PRIu64 ")",
+              item->get_type_str(), item->has_name() ? item->name : "", item->interval, item->next_execution, now);
 #endif
 
-      // Warning: During callback(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
-      {
-        WarnIfComponentBlockingGuard guard{item->component};
-        item->callback();
-      }
-    }
-
+    // Warning: During callback(), a lot of stuff can happen, including:
+    //  - timeouts/intervals get added
+    //  - timeouts/intervals get cancelled, including this one
     {
-      this->lock_.lock();
-
-      // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
-      // Only pop after function call, this ensures we were reachable
-      // during the function call and know if we were cancelled.
-      this->pop_raw_();
-
-      this->lock_.unlock();
+#ifdef USE_COMPONENT_TIMING
+      WarnIfComponentBlockingGuard guard{item->component, TIMING_SCHEDULER};
+#else
+      WarnIfComponentBlockingGuard guard{item->component};
+#endif
+      item->callback();
+    }
 
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        to_remove_--;
-        continue;
-      }
+    LockGuard guard{this->lock_};
+    if (item->remove) {
+      // We were cancelled in the function call and already removed from the index
+      this->free_item_(item);
+      continue;
+    }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
+    if (item->type == SchedulerItem::INTERVAL) {
+      if (item->interval != 0) {
+        // Skip executions that were missed, but keep the phase of the interval
+        const uint64_t amount = (now - item->next_execution) / item->interval + 1;
+        item->next_execution += amount * item->interval;
       }
+      this->wheel_insert_(item);
+    } else {
+      this->unindex_(item);
+      this->free_item_(item);
     }
   }
-
-  this->process_to_add();
 }
-void HOT Scheduler::process_to_add() {
+bool HOT Scheduler::cancel_item_(Component *component, const char *name, Scheduler::SchedulerItem::Type type) {
+  if (name == nullptr)
+    name = "";
+  // An empty name cancels all unnamed items of the component, e.g. all pending delays of a DelayAction
+  const bool named = name[0] != '\0';
+  const uint32_t name_hash = fnv1_hash(name);
+  bool ret = false;
+  // obtain lock because this function can be called from non-loop task context
   LockGuard guard{this->lock_};
-  for (auto &it : this->to_add_) {
-    if (it->remove) {
+  SchedulerItem *next;
+  for (auto *item = this->names_[this->name_bucket_(component, name_hash, type)]; item != nullptr; item = next) {
+    next = item->name_next;
+    if (item->component != component || item->type != type || item->name_hash != name_hash ||
+        strcmp(item->has_name() ? item->name : "", name) != 0)
       continue;
+    this->unindex_(item);
+    if (item->location == SchedulerItem::CURRENT) {
+      // Currently executing, released by call() once the callback returns
+      item->remove = true;
+    } else {
+      this->unlink_(item);
+      this->free_item_(item);
     }
-
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+    ret = true;
+    if (named)
+      break;
+  }
+  return ret;
+}
+Scheduler::SchedulerItem *HOT Scheduler::alloc_item_() {
+  SchedulerItem *item;
+  if (this->pool_used_ < ESPHOME_SCHEDULER_POOL_SIZE) {
+    item = &this->pool_[this->pool_used_++];
+  } else if (this->free_list_ != nullptr) {
+    item = this->free_list_;
+    this->free_list_ = item->next;
+  } else {
+    item = new SchedulerItem();  // NOLINT(cppcoreguidelines-owning-memory)
+    this->heap_allocations_++;
+  }
+  this->items_in_use_++;
+  if (this->items_in_use_ > this->items_high_water_)
+    this->items_high_water_ = this->items_in_use_;
+  item->location = SchedulerItem::NONE;
+  item->prev = nullptr;
+  item->next = nullptr;
+  item->name_next = nullptr;
+  return item;
+}
+void HOT Scheduler::free_item_(Scheduler::SchedulerItem *item) {
+  this->items_in_use_--;
+  if (item < &this->pool_[0] || item >= &this->pool_[ESPHOME_SCHEDULER_POOL_SIZE]) {
+    delete item;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
   }
-  this->to_add_.clear();
+  // Release captured state now, but keep the name buffer around for the next user of this item
+  item->callback.reset();
+  item->name_storage.clear();
+  item->name = nullptr;
+  item->location = SchedulerItem::NONE;
+  item->next = this->free_list_;
+  this->free_list_ = item;
+}
+size_t HOT Scheduler::name_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type) const {
+  const uint32_t component_hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 2654435761UL;
+  const uint32_t key = name_hash ^ component_hash ^ type;
+  return (key ^ (key >> 16)) & (NAME_BUCKETS - 1);
 }
-void HOT Scheduler::cleanup_() {
-  while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
+void HOT Scheduler::index_(Scheduler::SchedulerItem *item) {
+  item->name_hash = fnv1_hash(item->has_name() ? item->name : "");
+  SchedulerItem *&head = this->names_[this->name_bucket_(item->component, item->name_hash, item->type)];
+  item->name_next = head;
+  head = item;
+}
+void HOT Scheduler::unindex_(Scheduler::SchedulerItem *item) {
+  SchedulerItem **link = &this->names_[this->name_bucket_(item->component, item->name_hash, item->type)];
+  while (*link != nullptr) {
+    if (*link == item) {
+      *link = item->name_next;
+      item->name_next = nullptr;
       return;
-
-    to_remove_--;
-
-    {
-      LockGuard guard{this->lock_};
-      this->pop_raw_();
     }
+    link = &(*link)->name_next;
   }
 }
-void HOT Scheduler::pop_raw_() {
-  std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
-  this->items_.pop_back();
+void HOT Scheduler::unlink_(Scheduler::SchedulerItem *item) {
+  switch (item->location) {
+    case SchedulerItem::WHEEL: {
+      ItemList &list = this->wheel_[item->level][item->slot];
+      list.unlink(item);
+      if (list.empty())
+        this->wheel_bitmap_[item->level] &= ~(1ULL << item->slot);
+      break;
+    }
+    case SchedulerItem::READY:
+      this->ready_.unlink(item);
+      break;
+    case SchedulerItem::RUNNING:
+      this->running_.unlink(item);
+      break;
+    default:
+      break;
+  }
+  item->location = SchedulerItem::NONE;
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
-  LockGuard guard{this->lock_};
-  this->to_add_.push_back(std::move(item));
+void HOT Scheduler::wheel_insert_(Scheduler::SchedulerItem *item) {
+  if (item->next_execution <= this->wheel_time_) {
+    item->location = SchedulerItem::READY;
+    this->ready_.push_back(item);
+    return;
+  }
+  const uint64_t delta = item->next_execution - this->wheel_time_;
+  uint8_t level = 0;
+  while (level < WHEEL_LEVELS - 1 && delta >= (1ULL << ((level + 1) * WHEEL_BITS)))
+    level++;
+  const uint8_t slot = (item->next_execution >> (level * WHEEL_BITS)) & WHEEL_MASK;
+  item->location = SchedulerItem::WHEEL;
+  item->level = level;
+  item->slot = slot;
+  this->wheel_[level][slot].push_back(item);
+  this->wheel_bitmap_[level] |= 1ULL << slot;
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  // obtain lock because this function iterates and can be called from non-loop task context
-  LockGuard guard{this->lock_};
-  bool ret = false;
-  for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
+void HOT Scheduler::wheel_cascade_(uint8_t level) {
+  const uint8_t slot = (this->wheel_time_ >> (level * WHEEL_BITS)) & WHEEL_MASK;
+  ItemList list = this->wheel_[level][slot];
+  this->wheel_[level][slot] = ItemList{};
+  this->wheel_bitmap_[level] &= ~(1ULL << slot);
+  while (auto *item = list.pop_front())
+    this->wheel_insert_(item);
+}
+void HOT Scheduler::wheel_advance_(uint64_t now) {
+  while (true) {
+    const uint64_t tick = this->wheel_next_tick_();
+    if (tick > now) {
+      // Nothing happens between the last processed tick and now
+      if (now > this->wheel_time_)
+        this->wheel_time_ = now;
+      return;
     }
-  }
-  for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+    this->wheel_time_ = tick;
+    // Cascade from the highest level that wrapped so items can fall through several levels at once
+    for (uint8_t level = WHEEL_LEVELS - 1; level > 0; level--) {
+      if ((tick & ((1ULL << (level * WHEEL_BITS)) - 1)) == 0)
+        this->wheel_cascade_(level);
     }
+    const uint8_t slot = tick & WHEEL_MASK;
+    ItemList &list = this->wheel_[0][slot];
+    while (auto *item = list.pop_front()) {
+      item->location = SchedulerItem::READY;
+      this->ready_.push_back(item);
+    }
+    this->wheel_bitmap_[0] &= ~(1ULL << slot);
+  }
+}
+uint64_t HOT Scheduler::wheel_next_tick_() const {
+  const uint64_t next = this->wheel_time_ + 1;
+  uint8_t lowest = 0;
+  while (lowest < WHEEL_LEVELS && this->wheel_bitmap_[lowest] == 0)
+    lowest++;
+  if (lowest == WHEEL_LEVELS)
+    return UINT64_MAX;
+
+  if (lowest > 0) {
+    // Nothing can expire before the lowest non-empty level cascades
+    const uint64_t granularity = 1ULL << (lowest * WHEEL_BITS);
+    return (next + granularity - 1) & ~(granularity - 1);
   }
 
-  return ret;
+  const uint8_t index = next & WHEEL_MASK;
+  if (index == 0)
+    return next;  // higher levels may need to cascade here
+  const uint64_t pending = this->wheel_bitmap_[0] >> index;
+  if (pending != 0)
+    return next + __builtin_ctzll(pending);
+  // Remaining slots belong to the next rotation
+  return (next + WHEEL_MASK) & ~static_cast<uint64_t>(WHEEL_MASK);
 }
-uint32_t Scheduler::millis_() {
+uint64_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
     ESP_LOGD(TAG, "Incrementing scheduler major");
     this->millis_major_++;
   }
   this->last_millis_ = now;
-  return now;
+  return (static_cast<uint64_t>(this->millis_major_) << 32) | now;
 }
 
-bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
-                                       const std::unique_ptr<SchedulerItem> &b) {
-  // min-heap
-  // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
+void HOT Scheduler::ItemList::push_back(Scheduler::SchedulerItem *item) {
+  item->prev = this->tail;
+  item->next = nullptr;
+  if (this->tail != nullptr) {
+    this->tail->next = item;
+  } else {
+    this->head = item;
   }
-
-  return a_next_exec > b_next_exec;
+  this->tail = item;
+}
+Scheduler::SchedulerItem *HOT Scheduler::ItemList::pop_front() {
+  SchedulerItem *item = this->head;
+  if (item != nullptr)
+    this->unlink(item);
+  return item;
+}
+void HOT Scheduler::ItemList::unlink(Scheduler::SchedulerItem *item) {
+  if (item->prev != nullptr) {
+    item->prev->next = item->next;
+  } else {
+    this->head = item->next;
+  }
+  if (item->next != nullptr) {
+    item->next->prev = item->prev;
+  } else {
+    this->tail = item->prev;
+  }
+  item->prev = nullptr;
+  item->next = nullptr;
 }
 
 }  // namespace esphome
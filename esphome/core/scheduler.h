@@ -4,18 +4,43 @@
 #include <memory>
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+// Number of scheduler items allocated statically, set by codegen based on the number of components.
+#ifndef ESPHOME_SCHEDULER_POOL_SIZE
+#define ESPHOME_SCHEDULER_POOL_SIZE 16
+#endif
+
 namespace esphome {
 
 class Component;
 
+/** Timeout/interval scheduler backed by a hierarchical timer wheel.
+ *
+ * Items are kept in WHEEL_LEVELS wheels of WHEEL_SIZE slots each, level n having a granularity of
+ * WHEEL_SIZE^n milliseconds. Items are placed in the lowest level that can hold their expiry, and are cascaded
+ * down one level whenever the wheel of the level below wraps around. Items are additionally indexed by
+ * (component, hash of name, type) in an intrusive hash table, so that adding, cancelling and finding the next
+ * expiry are all O(1) amortised. Unnamed items share the empty name, cancelling it cancels all of them.
+ *
+ * Time is tracked internally as a 64 bit millisecond counter, built from millis() and the number of times it
+ * rolled over (every ~49.7 days), so rollovers need no special handling in the wheel itself.
+ *
+ * Items are taken from a fixed pool of ESPHOME_SCHEDULER_POOL_SIZE entries and only fall back to the heap once it
+ * is exhausted. Together with the inline storage of SchedulerCallback and the `const char *` name overloads (which
+ * must be passed strings with static storage duration, e.g. literals), rescheduling does not allocate.
+ */
 class Scheduler {
  public:
-  void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
+  void set_timeout(Component *component, const std::string &name, uint32_t timeout, SchedulerCallback func);
+  void set_timeout(Component *component, const char *name, uint32_t timeout, SchedulerCallback func);
   bool cancel_timeout(Component *component, const std::string &name);
-  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
+  bool cancel_timeout(Component *component, const char *name);
+  void set_interval(Component *component, const std::string &name, uint32_t interval, SchedulerCallback func);
+  void set_interval(Component *component, const char *name, uint32_t interval, SchedulerCallback func);
   bool cancel_interval(Component *component, const std::string &name);
+  bool cancel_interval(Component *component, const char *name);
 
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                  std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
@@ -25,32 +50,47 @@ class Scheduler {
 
   void call();
 
-  void process_to_add();
+  /// Number of items in the statically allocated pool.
+  size_t get_pool_size() const { return ESPHOME_SCHEDULER_POOL_SIZE; }
+  /// Highest number of items that were scheduled at the same time.
+  size_t get_items_high_water() const { return this->items_high_water_; }
+  /// Number of items that did not fit in the pool and had to be allocated on the heap.
+  uint32_t get_heap_allocations() const { return this->heap_allocations_; }
 
  protected:
+  static const uint8_t WHEEL_BITS = 6;
+  static const uint8_t WHEEL_SIZE = 1 << WHEEL_BITS;
+  static const uint8_t WHEEL_MASK = WHEEL_SIZE - 1;
+  /// 6 levels of 64 slots cover 2^36 ms, more than any uint32_t timeout or interval.
+  static const uint8_t WHEEL_LEVELS = 6;
+  /// Number of buckets of the name index, must be a power of two.
+  static const size_t NAME_BUCKETS = ESPHOME_SCHEDULER_POOL_SIZE > 64 ? 256 : 64;
+
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
+    /// Either a string with static storage duration or name_storage, nullptr or empty if unnamed.
+    const char *name;
+    std::string name_storage;
+    uint32_t name_hash;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
+    /// Which container currently holds this item.
+    enum Location : uint8_t { NONE, WHEEL, READY, RUNNING, CURRENT } location;
+    uint8_t level;
+    uint8_t slot;
+    bool remove;
     union {
       uint32_t interval;
       uint32_t timeout;
     };
-    uint32_t last_execution;
-    std::function<void()> callback;
-    bool remove;
-    uint8_t last_execution_major;
-
-    inline uint32_t next_execution() { return this->last_execution + this->timeout; }
-    inline uint8_t next_execution_major() {
-      uint32_t next_exec = this->next_execution();
-      uint8_t next_exec_major = this->last_execution_major;
-      if (next_exec < this->last_execution)
-        next_exec_major++;
-      return next_exec_major;
-    }
+    uint64_t next_execution;
+    SchedulerCallback callback;
+    SchedulerItem *prev;
+    SchedulerItem *next;
+    /// Next item in the same bucket of the name index.
+    SchedulerItem *name_next;
+
+    bool has_name() const { return this->name != nullptr && this->name[0] != '\0'; }
 
-    static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
     const char *get_type_str() {
       switch (this->type) {
         case SchedulerItem::INTERVAL:
@@ -63,22 +103,53 @@ class Scheduler {
     }
   };
 
-  uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
-  bool empty_() {
-    this->cleanup_();
-    return this->items_.empty();
-  }
+  /// Intrusive FIFO list of scheduler items, used for the wheel slots and the ready queues.
+  struct ItemList {
+    SchedulerItem *head{nullptr};
+    SchedulerItem *tail{nullptr};
+
+    bool empty() const { return this->head == nullptr; }
+    void push_back(SchedulerItem *item);
+    SchedulerItem *pop_front();
+    void unlink(SchedulerItem *item);
+  };
+
+  uint64_t millis_();
+  void set_item_(Component *component, const char *name, bool static_name, SchedulerItem::Type type, uint32_t delay,
+                 SchedulerCallback &&func);
+  bool cancel_item_(Component *component, const char *name, SchedulerItem::Type type);
+  SchedulerItem *alloc_item_();
+  void free_item_(SchedulerItem *item);
+  size_t name_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type) const;
+  void index_(SchedulerItem *item);
+  void unindex_(SchedulerItem *item);
+  void unlink_(SchedulerItem *item);
+
+  void wheel_insert_(SchedulerItem *item);
+  void wheel_cascade_(uint8_t level);
+  void wheel_advance_(uint64_t now);
+  uint64_t wheel_next_tick_() const;
 
   Mutex lock_;
-  std::vector<std::unique_ptr<SchedulerItem>> items_;
-  std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  ItemList wheel_[WHEEL_LEVELS][WHEEL_SIZE];
+  /// One bit per non-empty slot, per level.
+  uint64_t wheel_bitmap_[WHEEL_LEVELS]{};
+  /// All ticks up to and including this time have been processed.
+  uint64_t wheel_time_{0};
+  /// Items that are due and will be run on the next call().
+  ItemList ready_;
+  /// Items that are being run by the current call().
+  ItemList running_;
+  SchedulerItem *names_[NAME_BUCKETS]{};
+  SchedulerItem pool_[ESPHOME_SCHEDULER_POOL_SIZE];
+  /// Unused pool items, linked through SchedulerItem::next.
+  SchedulerItem *free_list_{nullptr};
+  size_t pool_used_{0};
+  size_t items_in_use_{0};
+  size_t items_high_water_{0};
+  uint32_t heap_allocations_{0};
   uint32_t last_millis_{0};
-  uint8_t millis_major_{0};
-  uint32_t to_remove_{0};
+  uint32_t millis_major_{0};
 };
 
 }  // namespace esphome
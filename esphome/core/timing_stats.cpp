@@ -0,0 +1,76 @@
+#include "esphome/core/timing_stats.h"
+
+#ifdef USE_COMPONENT_TIMING
+
+namespace esphome {
+
+const char *timing_category_to_string(TimingCategory category) {
+  switch (category) {
+    case TIMING_SETUP:
+      return "setup";
+    case TIMING_LOOP:
+      return "loop";
+    case TIMING_SCHEDULER:
+      return "scheduler";
+    case TIMING_DUMP_CONFIG:
+      return "dump_config";
+    default:
+      return "unknown";
+  }
+}
+
+static uint8_t timing_bucket(uint32_t us) {
+  uint8_t bits = us == 0 ? 0 : 32 - __builtin_clz(us);
+  if (bits <= 4)
+    return 0;
+  if (bits - 4 >= TimingHistogram::BUCKETS)
+    return TimingHistogram::BUCKETS - 1;
+  return bits - 4;
+}
+
+void TimingHistogram::record(uint32_t us) {
+  this->count_++;
+  this->total_ += us;
+  if (us < this->min_)
+    this->min_ = us;
+  if (us > this->max_)
+    this->max_ = us;
+
+  uint16_t &bucket = this->buckets_[timing_bucket(us)];
+  if (bucket == UINT16_MAX) {
+    for (auto &b : this->buckets_)
+      b >>= 1;
+  }
+  bucket++;
+}
+
+void TimingHistogram::reset() { *this = TimingHistogram(); }
+
+uint32_t TimingHistogram::get_percentile(uint8_t percentile) const {
+  uint32_t samples = 0;
+  for (auto b : this->buckets_)
+    samples += b;
+  if (samples == 0)
+    return 0;
+
+  // Rank of the sample we're looking for, rounded up.
+  uint32_t rank = (samples * percentile + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < BUCKETS - 1; i++) {
+    seen += this->buckets_[i];
+    if (seen >= rank) {
+      uint32_t upper = 1UL << (i + 4);
+      return upper < this->max_ ? upper : this->max_;
+    }
+  }
+  return this->max_;
+}
+
+void ComponentTimingStats::reset() {
+  for (auto &histogram : this->histograms)
+    histogram.reset();
+}
+
+}  // namespace esphome
+
+#endif  // USE_COMPONENT_TIMING
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include "esphome/core/defines.h"
+
+#ifdef USE_COMPONENT_TIMING
+
+namespace esphome {
+
+/// What a component was doing while it was being timed.
+enum TimingCategory : uint8_t {
+  TIMING_SETUP = 0,
+  TIMING_LOOP,
+  TIMING_SCHEDULER,
+  TIMING_DUMP_CONFIG,
+  TIMING_CATEGORY_COUNT,
+};
+
+const char *timing_category_to_string(TimingCategory category);
+
+/** Compact histogram of execution times in microseconds.
+ *
+ * Bucket 0 holds everything below 16us, bucket n > 0 holds [2^(n+3), 2^(n+4)) us and the last bucket is open
+ * ended (>= 262ms). Recording a sample is a handful of integer operations. Buckets are 16 bit wide, once one of them
+ * saturates all of them are halved, so the histogram slowly forgets old samples while keeping its shape. Count,
+ * total, min and max are exact.
+ */
+class TimingHistogram {
+ public:
+  static const uint8_t BUCKETS = 16;
+
+  void record(uint32_t us);
+  void reset();
+
+  uint32_t get_count() const { return this->count_; }
+  uint32_t get_min() const { return this->count_ == 0 ? 0 : this->min_; }
+  uint32_t get_max() const { return this->max_; }
+  uint32_t get_avg() const { return this->count_ == 0 ? 0 : this->total_ / this->count_; }
+  uint64_t get_total() const { return this->total_; }
+  /// Upper bound of the bucket that contains the given percentile, clamped to the maximum seen.
+  uint32_t get_percentile(uint8_t percentile) const;
+
+ protected:
+  uint32_t count_{0};
+  uint32_t min_{UINT32_MAX};
+  uint32_t max_{0};
+  uint64_t total_{0};
+  uint16_t buckets_[BUCKETS]{};
+};
+
+/// Execution time statistics of one component, one histogram per TimingCategory.
+struct ComponentTimingStats {
+  TimingHistogram histograms[TIMING_CATEGORY_COUNT];
+
+  TimingHistogram &operator[](TimingCategory category) { return this->histograms[category]; }
+  const TimingHistogram &operator[](TimingCategory category) const { return this->histograms[category]; }
+  void reset();
+};
+
+}  // namespace esphome
+
+#endif  // USE_COMPONENT_TIMING
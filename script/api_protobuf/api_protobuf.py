@@ -17,19 +17,36 @@ then run this script with python3 and the files
 will be generated, they still need to be formatted
 """
 
+import importlib
 import os
 import re
 import sys
-from abc import ABC, abstractmethod
+import tempfile
+from abc import ABC
 from pathlib import Path
 from subprocess import call
 from textwrap import dedent
 
-# Generate with
-# protoc --python_out=script/api_protobuf -I esphome/components/api/ api_options.proto
-import aioesphomeapi.api_options_pb2 as pb
 import google.protobuf.descriptor_pb2 as descriptor
 
+API_DIR = Path(__file__).resolve().parent.parent.parent / "esphome" / "components" / "api"
+
+
+def load_api_options():
+    """Compile api_options.proto of this tree.
+
+    The copy in the aioesphomeapi package lags behind, it can lack options used in api.proto.
+    """
+    out_dir = tempfile.mkdtemp()
+    if call(["protoc", f"--python_out={out_dir}", "-I", str(API_DIR), "api_options.proto"]) != 0:
+        sys.exit("Could not compile api_options.proto")
+    sys.path.insert(0, out_dir)
+    return importlib.import_module("api_options_pb2")
+
+
+# Has to be loaded before api.proto is parsed, so that the options are known
+pb = load_api_options()
+
 FILE_HEADER = """// This file was automatically generated with a tool.
 // See scripts/api_protobuf/api_protobuf.py
 """
@@ -110,82 +127,39 @@ class TypeInfo(ABC):
     def class_member(self) -> str:
         return f"{self.cpp_type} {self.field_name}{{{self.default_value}}};"
 
-    @property
-    def decode_varint_content(self) -> str:
-        content = self.decode_varint
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name} = {content};
-          return true;
-        }}"""
-        )
-
-    decode_varint = None
-
-    @property
-    def decode_length_content(self) -> str:
-        content = self.decode_length
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name} = {content};
-          return true;
-        }}"""
-        )
-
-    decode_length = None
-
-    @property
-    def decode_32bit_content(self) -> str:
-        content = self.decode_32bit
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name} = {content};
-          return true;
-        }}"""
-        )
-
-    decode_32bit = None
+    # Name of the ProtoFieldType the generic encoder and decoder handle this field as
+    proto_type = None
 
     @property
-    def decode_64bit_content(self) -> str:
-        content = self.decode_64bit
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name} = {content};
-          return true;
-        }}"""
-        )
-
-    decode_64bit = None
+    def field_ops(self):
+        """Type-erased access the generic code needs for this field, None if it handles the type directly."""
+        return None
 
     @property
-    def encode_content(self):
-        return f"buffer.{self.encode_func}({self.number}, this->{self.field_name});"
-
-    encode_func = None
+    def enum_name(self):
+        """Function that prints the values of an enum field, None for other fields."""
+        return None
 
-    @property
-    def dump_content(self):
-        o = f'out.append("  {self.name}: ");\n'
-        o += self.dump(f"this->{self.field_name}") + "\n"
-        o += 'out.append("\\n");\n'
+    def descriptor_field(self, message_name, ops_index=None):
+        """Entry of this field in the descriptor table of its message."""
+        if self.proto_type is None:
+            raise ValueError(
+                f"Field {message_name}.{self.name} has a type that is not supported"
+            )
+        if self.number > 0x7F:
+            raise ValueError(f"Field {message_name}.{self.name} has a number above 127")
+        o = f"proto_field(offsetof({message_name}, {self.field_name}), {self.number}, ProtoFieldType::{self.proto_type}"
+        if self.repeated or ops_index is not None:
+            o += f", {'true' if self.repeated else 'false'}"
+            if ops_index is not None:
+                o += f", {ops_index}"
+        o += ")"
         return o
 
-    @abstractmethod
-    def dump(self, name: str):
-        pass
+    def dump_field(self):
+        """Entry of this field in the dump table of its message."""
+        enum_name = self.enum_name
+        return f'{{"{self.name}", {enum_name if enum_name is not None else "nullptr"}}}'
 
 
 TYPE_INFO = {}
@@ -203,126 +177,73 @@ def register_type(name):
 class DoubleType(TypeInfo):
     cpp_type = "double"
     default_value = "0.0"
-    decode_64bit = "value.as_double()"
-    encode_func = "encode_double"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%g", {name});\n'
-        o += "out.append(buffer);"
-        return o
 
 
 @register_type(2)
 class FloatType(TypeInfo):
     cpp_type = "float"
     default_value = "0.0f"
-    decode_32bit = "value.as_float()"
-    encode_func = "encode_float"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%g", {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "FLOAT"
 
 
 @register_type(3)
 class Int64Type(TypeInfo):
     cpp_type = "int64_t"
     default_value = "0"
-    decode_varint = "value.as_int64()"
-    encode_func = "encode_int64"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%lld", {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "INT64"
 
 
 @register_type(4)
 class UInt64Type(TypeInfo):
     cpp_type = "uint64_t"
     default_value = "0"
-    decode_varint = "value.as_uint64()"
-    encode_func = "encode_uint64"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%llu", {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "UINT64"
 
 
 @register_type(5)
 class Int32Type(TypeInfo):
     cpp_type = "int32_t"
     default_value = "0"
-    decode_varint = "value.as_int32()"
-    encode_func = "encode_int32"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%" PRId32, {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "INT32"
 
 
 @register_type(6)
 class Fixed64Type(TypeInfo):
     cpp_type = "uint64_t"
     default_value = "0"
-    decode_64bit = "value.as_fixed64()"
-    encode_func = "encode_fixed64"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%llu", {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "FIXED64"
 
 
 @register_type(7)
 class Fixed32Type(TypeInfo):
     cpp_type = "uint32_t"
     default_value = "0"
-    decode_32bit = "value.as_fixed32()"
-    encode_func = "encode_fixed32"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%" PRIu32, {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "FIXED32"
 
 
 @register_type(8)
 class BoolType(TypeInfo):
     cpp_type = "bool"
     default_value = "false"
-    decode_varint = "value.as_bool()"
-    encode_func = "encode_bool"
-
-    def dump(self, name):
-        o = f"out.append(YESNO({name}));"
-        return o
+    proto_type = "BOOL"
 
 
 @register_type(9)
 class StringType(TypeInfo):
-    cpp_type = "std::string"
     default_value = ""
-    reference_type = "std::string &"
-    const_reference_type = "const std::string &"
-    decode_length = "value.as_string()"
-    encode_func = "encode_string"
-
-    def dump(self, name):
-        o = f'out.append("\'").append({name}).append("\'");'
-        return o
 
+    @property
+    def view(self):
+        """Whether the field is a StringRef pointing into a buffer owned by someone else."""
+        return self._field.options.Extensions[pb.view]
 
-@register_type(11)
-class MessageType(TypeInfo):
     @property
     def cpp_type(self):
-        return self._field.type_name[1:]
+        return "StringRef" if self.view else "std::string"
 
-    default_value = ""
+    @property
+    def proto_type(self):
+        return "STRING_REF" if self.view else "STRING"
 
     @property
     def reference_type(self):
@@ -332,44 +253,39 @@ class MessageType(TypeInfo):
     def const_reference_type(self):
         return f"const {self.cpp_type} &"
 
+
+@register_type(11)
+class MessageType(TypeInfo):
+    @property
+    def cpp_type(self):
+        return self._field.type_name[1:]
+
+    default_value = ""
+    proto_type = "MESSAGE"
+
     @property
-    def encode_func(self):
-        return f"encode_message<{self.cpp_type}>"
+    def field_ops(self):
+        return f"&ProtoNestedMessage<{self.cpp_type}>::OPS"
 
     @property
-    def decode_length(self):
-        return f"value.as_message<{self.cpp_type}>()"
+    def reference_type(self):
+        return f"{self.cpp_type} &"
 
-    def dump(self, name):
-        o = f"{name}.dump_to(out);"
-        return o
+    @property
+    def const_reference_type(self):
+        return f"const {self.cpp_type} &"
 
 
 @register_type(12)
-class BytesType(TypeInfo):
-    cpp_type = "std::string"
-    default_value = ""
-    reference_type = "std::string &"
-    const_reference_type = "const std::string &"
-    decode_length = "value.as_string()"
-    encode_func = "encode_string"
-
-    def dump(self, name):
-        o = f'out.append("\'").append({name}).append("\'");'
-        return o
+class BytesType(StringType):
+    pass
 
 
 @register_type(13)
 class UInt32Type(TypeInfo):
     cpp_type = "uint32_t"
     default_value = "0"
-    decode_varint = "value.as_uint32()"
-    encode_func = "encode_uint32"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%" PRIu32, {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "UINT32"
 
 
 @register_type(14)
@@ -378,71 +294,38 @@ class EnumType(TypeInfo):
     def cpp_type(self):
         return f"enums::{self._field.type_name[1:]}"
 
-    @property
-    def decode_varint(self):
-        return f"value.as_enum<{self.cpp_type}>()"
-
     default_value = ""
+    proto_type = "ENUM"
 
     @property
-    def encode_func(self):
-        return f"encode_enum<{self.cpp_type}>"
-
-    def dump(self, name):
-        o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
-        return o
+    def enum_name(self):
+        return f"&proto_enum_name<{self.cpp_type}>"
 
 
 @register_type(15)
 class SFixed32Type(TypeInfo):
     cpp_type = "int32_t"
     default_value = "0"
-    decode_32bit = "value.as_sfixed32()"
-    encode_func = "encode_sfixed32"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%" PRId32, {name});\n'
-        o += "out.append(buffer);"
-        return o
 
 
 @register_type(16)
 class SFixed64Type(TypeInfo):
     cpp_type = "int64_t"
     default_value = "0"
-    decode_64bit = "value.as_sfixed64()"
-    encode_func = "encode_sfixed64"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%lld", {name});\n'
-        o += "out.append(buffer);"
-        return o
 
 
 @register_type(17)
 class SInt32Type(TypeInfo):
     cpp_type = "int32_t"
     default_value = "0"
-    decode_varint = "value.as_sint32()"
-    encode_func = "encode_sint32"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%" PRId32, {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "SINT32"
 
 
 @register_type(18)
 class SInt64Type(TypeInfo):
     cpp_type = "int64_t"
     default_value = "0"
-    decode_varint = "value.as_sint64()"
-    encode_func = "encode_sint64"
-
-    def dump(self, name):
-        o = f'sprintf(buffer, "%lld", {name});\n'
-        o += "out.append(buffer);"
-        return o
+    proto_type = "SINT64"
 
 
 class RepeatedTypeInfo(TypeInfo):
@@ -463,80 +346,20 @@ class RepeatedTypeInfo(TypeInfo):
         return f"const {self.cpp_type} &"
 
     @property
-    def decode_varint_content(self) -> str:
-        content = self._ti.decode_varint
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name}.push_back({content});
-          return true;
-        }}"""
-        )
-
-    @property
-    def decode_length_content(self) -> str:
-        content = self._ti.decode_length
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name}.push_back({content});
-          return true;
-        }}"""
-        )
-
-    @property
-    def decode_32bit_content(self) -> str:
-        content = self._ti.decode_32bit
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name}.push_back({content});
-          return true;
-        }}"""
-        )
-
-    @property
-    def decode_64bit_content(self) -> str:
-        content = self._ti.decode_64bit
-        if content is None:
-            return None
-        return dedent(
-            f"""\
-        case {self.number}: {{
-          this->{self.field_name}.push_back({content});
-          return true;
-        }}"""
-        )
+    def proto_type(self):
+        return self._ti.proto_type
 
     @property
-    def _ti_is_bool(self):
-        # std::vector is specialized for bool, reference does not work
-        return isinstance(self._ti, BoolType)
+    def field_ops(self):
+        if self.proto_type == "ENUM":
+            return f"&ProtoRepeatedEnum<{self._ti.cpp_type}>::OPS"
+        if self.proto_type == "MESSAGE":
+            return f"&ProtoRepeatedMessage<{self._ti.cpp_type}>::OPS"
+        return None
 
     @property
-    def encode_content(self):
-        o = f"for (auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
-        o += f"  buffer.{self._ti.encode_func}({self.number}, it, true);\n"
-        o += "}"
-        return o
-
-    @property
-    def dump_content(self):
-        o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
-        o += f'  out.append("  {self.name}: ");\n'
-        o += indent(self._ti.dump("it")) + "\n"
-        o += '  out.append("\\n");\n'
-        o += "}\n"
-        return o
-
-    def dump(self, _: str):
-        pass
+    def enum_name(self):
+        return self._ti.enum_name
 
 
 def build_enum_type(desc):
@@ -564,11 +387,8 @@ def build_enum_type(desc):
 def build_message_type(desc):
     public_content = []
     protected_content = []
-    decode_varint = []
-    decode_length = []
-    decode_32bit = []
-    decode_64bit = []
-    encode = []
+    fields = []
+    field_ops = []
     dump = []
 
     for field in desc.field:
@@ -578,107 +398,60 @@ def build_message_type(desc):
             ti = TYPE_INFO[field.type](field)
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
-        encode.append(ti.encode_content)
-
-        if ti.decode_varint_content:
-            decode_varint.append(ti.decode_varint_content)
-        if ti.decode_length_content:
-            decode_length.append(ti.decode_length_content)
-        if ti.decode_32bit_content:
-            decode_32bit.append(ti.decode_32bit_content)
-        if ti.decode_64bit_content:
-            decode_64bit.append(ti.decode_64bit_content)
-        if ti.dump_content:
-            dump.append(ti.dump_content)
 
+        if ti.field_ops is not None:
+            if len(field_ops) > 7:
+                raise ValueError(f"Message {desc.name} has too many enum and message fields")
+            fields.append(ti.descriptor_field(desc.name, len(field_ops)))
+            field_ops.append(ti.field_ops)
+        else:
+            fields.append(ti.descriptor_field(desc.name))
+        dump.append(ti.dump_field())
+
+    snake = camel_to_snake(desc.name).upper()
     cpp = ""
-    if decode_varint:
-        decode_varint.append("default:\n  return false;")
-        o = f"bool {desc.name}::decode_varint(uint32_t field_id, ProtoVarInt value) {{\n"
-        o += "  switch (field_id) {\n"
-        o += indent("\n".join(decode_varint), "    ") + "\n"
-        o += "  }\n"
-        o += "}\n"
-        cpp += o
-        prot = "bool decode_varint(uint32_t field_id, ProtoVarInt value) override;"
-        protected_content.insert(0, prot)
-    if decode_length:
-        decode_length.append("default:\n  return false;")
-        o = f"bool {desc.name}::decode_length(uint32_t field_id, ProtoLengthDelimited value) {{\n"
-        o += "  switch (field_id) {\n"
-        o += indent("\n".join(decode_length), "    ") + "\n"
-        o += "  }\n"
-        o += "}\n"
-        cpp += o
-        prot = "bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;"
-        protected_content.insert(0, prot)
-    if decode_32bit:
-        decode_32bit.append("default:\n  return false;")
-        o = f"bool {desc.name}::decode_32bit(uint32_t field_id, Proto32Bit value) {{\n"
-        o += "  switch (field_id) {\n"
-        o += indent("\n".join(decode_32bit), "    ") + "\n"
-        o += "  }\n"
-        o += "}\n"
-        cpp += o
-        prot = "bool decode_32bit(uint32_t field_id, Proto32Bit value) override;"
-        protected_content.insert(0, prot)
-    if decode_64bit:
-        decode_64bit.append("default:\n  return false;")
-        o = f"bool {desc.name}::decode_64bit(uint32_t field_id, Proto64Bit value) {{\n"
-        o += "  switch (field_id) {\n"
-        o += indent("\n".join(decode_64bit), "    ") + "\n"
-        o += "  }\n"
-        o += "}\n"
-        cpp += o
-        prot = "bool decode_64bit(uint32_t field_id, Proto64Bit value) override;"
-        protected_content.insert(0, prot)
-
-    o = f"void {desc.name}::encode(ProtoWriteBuffer buffer) const {{"
-    if encode:
-        if len(encode) == 1 and len(encode[0]) + len(o) + 3 < 120:
-            o += f" {encode[0]} "
+    if fields:
+        cpp += f"static constexpr uint32_t {snake}_FIELDS[] PROGMEM = {{\n"
+        cpp += indent(",\n".join(fields), "    ") + ",\n"
+        cpp += "};\n"
+    if field_ops:
+        o = f"static const ProtoFieldOps *const {snake}_OPS[] PROGMEM = {{"
+        o2 = ", ".join(field_ops)
+        if len(o) + len(o2) + 3 <= 120:
+            cpp += f"{o}{o2}}};\n"
         else:
-            o += "\n"
-            o += indent("\n".join(encode)) + "\n"
-    o += "}\n"
-    cpp += o
-    prot = "void encode(ProtoWriteBuffer buffer) const override;"
-    public_content.append(prot)
-
-    o = f"void {desc.name}::dump_to(std::string &out) const {{"
+            cpp += o + "\n"
+            cpp += indent(",\n".join(field_ops), "    ") + ",\n"
+            cpp += "};\n"
     if dump:
-        if len(dump) == 1 and len(dump[0]) + len(o) + 3 < 120:
-            o += f" {dump[0]} "
-        else:
-            o += "\n"
-            o += "  __attribute__((unused)) char buffer[64];\n"
-            o += f'  out.append("{desc.name} {{\\n");\n'
-            o += indent("\n".join(dump)) + "\n"
-            o += '  out.append("}");\n'
-    else:
-        o2 = f'out.append("{desc.name} {{}}");'
-        if len(o) + len(o2) + 3 < 120:
-            o += f" {o2} "
+        cpp += "#ifdef HAS_PROTO_MESSAGE_DUMP\n"
+        o = f"static const ProtoFieldDump {snake}_DUMP[] PROGMEM = {{"
+        o2 = ", ".join(dump)
+        if len(o) + len(o2) + 3 <= 120:
+            cpp += f"{o}{o2}}};\n"
         else:
-            o += "\n"
-            o += f"  {o2}\n"
-    o += "}\n"
+            cpp += o + "\n"
+            cpp += indent(",\n".join(dump), "    ") + ",\n"
+            cpp += "};\n"
+        cpp += "#endif\n"
+    fields_name = f"{snake}_FIELDS" if fields else "nullptr"
+    ops_name = f"{snake}_OPS" if field_ops else "nullptr"
+    dump_name = f"{snake}_DUMP" if dump else "nullptr"
+    cpp += f"const ProtoMessageDescriptor {desc.name}::DESCRIPTOR PROGMEM = {{\n"
+    cpp += f"    {fields_name}, {ops_name}, {len(fields)},\n"
     cpp += "#ifdef HAS_PROTO_MESSAGE_DUMP\n"
-    cpp += o
+    cpp += f'    "{desc.name}", {dump_name},\n'
     cpp += "#endif\n"
-    prot = "#ifdef HAS_PROTO_MESSAGE_DUMP\n"
-    prot += "void dump_to(std::string &out) const override;\n"
-    prot += "#endif\n"
-    public_content.append(prot)
+    cpp += "};\n"
+    public_content.insert(0, "static const ProtoMessageDescriptor DESCRIPTOR;")
 
-    out = f"class {desc.name} : public ProtoMessage {{\n"
+    out = f"class {desc.name} : public ProtoMessage<{desc.name}> {{\n"
     out += " public:\n"
     out += indent("\n".join(public_content)) + "\n"
-    out += "\n"
-    out += " protected:\n"
-    out += indent("\n".join(protected_content))
-    if len(protected_content) > 0:
+    if protected_content:
         out += "\n"
+        out += " protected:\n"
+        out += indent("\n".join(protected_content)) + "\n"
     out += "};\n"
     return out, cpp
 
@@ -755,8 +528,7 @@ def build_service_message_type(mt):
 
 
 def main():
-    cwd = Path(__file__).resolve().parent
-    root = cwd.parent.parent / "esphome" / "components" / "api"
+    root = API_DIR
     prot_file = root / "api.protoc"
     call(["protoc", "-o", str(prot_file), "-I", str(root), "api.proto"])
     proto_content = prot_file.read_bytes()
@@ -779,9 +551,10 @@ def main():
     cpp = FILE_HEADER
     cpp += """\
     #include "api_pb2.h"
+    #include "esphome/core/hal.h"
     #include "esphome/core/log.h"
 
-    #include <cinttypes>
+    #include <cstddef>
 
     namespace esphome {
     namespace api {